@@ -200,7 +200,11 @@
     #define LV_DRAW_SW_DRAW_UNIT_CNT    0
 
     /** Use Arm-2D to accelerate software (sw) rendering. */
-    #define LV_USE_DRAW_ARM2D_SYNC      1
+    #ifdef NATIVE_HOST
+        #define LV_USE_DRAW_ARM2D_SYNC  0   /**< Pas d'Arm-2D sur hôte (env native, bench, test) */
+    #else
+        #define LV_USE_DRAW_ARM2D_SYNC  1
+    #endif
 
     /** Enable native helium assembly to be compiled. */
     #define LV_USE_NATIVE_HELIUM_ASM    0
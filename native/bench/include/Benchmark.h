@@ -0,0 +1,227 @@
+// Micro-banc d'essai hôte au format Google Benchmark (sans dépendance réseau)
+//
+// Sous-ensemble de l'API de google/benchmark : une fixture écrite ici se
+// compile telle quelle contre la bibliothèque d'origine, et la sortie JSON
+// (--benchmark_format=json / --benchmark_out) a le même schéma, donc
+// tools/compare.py de Google Benchmark et native/tools/bench_compare.py
+// l'acceptent tous les deux.
+//
+//     static void BM_Exemple(benchmark::State& state) {
+//         for (auto _ : state) {
+//             benchmark::DoNotOptimize(travail(state.range(0)));
+//         }
+//         state.SetItemsProcessed(state.iterations());
+//     }
+//     BENCHMARK(BM_Exemple)->ArgName("charge")->Arg(8)->Arg(64);
+//
+// Le nombre d'itérations est calibré jusqu'à dépasser --benchmark_min_time.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <initializer_list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+class State;
+using Function = void (*)(State&);
+
+/**
+ * @brief Empêche le compilateur d'éliminer le calcul d'une valeur
+ */
+template <typename T>
+inline void DoNotOptimize(T&& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Force l'écriture en mémoire des effets de bord en cours
+ */
+inline void ClobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+/**
+ * @brief Compteur utilisateur (state.counters["nom"] = valeur), repris tel quel
+ *        dans la sortie console et JSON
+ */
+class Counter {
+public:
+    Counter(double value = 0.0) : value(value) {}  // NOLINT : conversion implicite voulue
+
+    operator double() const { return value; }
+
+    double value;
+};
+
+using UserCounters = std::map<std::string, Counter>;
+
+/**
+ * @brief État d'une exécution : boucle mesurée, arguments et compteurs
+ */
+class State {
+public:
+    // Attribut de type : pas d'avertissement pour « for (auto _ : state) »
+    struct [[gnu::unused]] Value {};
+
+    class Iterator {
+    public:
+        Iterator(State* state, int64_t remaining) : state_(state), remaining_(remaining) {}
+
+        Value operator*() const { return {}; }
+        void operator++() { --remaining_; }
+
+        bool operator!=(const Iterator&) {
+            if (remaining_ != 0) {
+                return true;
+            }
+            state_->finishTiming();
+            return false;
+        }
+
+    private:
+        State* state_;
+        int64_t remaining_;
+    };
+
+    State(int64_t iterations, std::vector<int64_t> args)
+        : maxIterations_(iterations), args_(std::move(args)) {}
+
+    Iterator begin() {
+        startTiming();
+        return Iterator(this, maxIterations_);
+    }
+
+    Iterator end() { return Iterator(this, 0); }
+
+    /**
+     * @brief Variante historique de la boucle : while (state.KeepRunning())
+     */
+    bool KeepRunning() {
+        if (!started_) {
+            startTiming();
+        }
+        if (remaining_ > 0) {
+            --remaining_;
+            return true;
+        }
+        finishTiming();
+        return false;
+    }
+
+    int64_t range(size_t index = 0) const { return index < args_.size() ? args_[index] : 0; }
+    int64_t iterations() const { return maxIterations_; }
+
+    void SetItemsProcessed(int64_t items) { itemsProcessed_ = items; }
+    void SetBytesProcessed(int64_t bytes) { bytesProcessed_ = bytes; }
+    void SetLabel(const std::string& label) { label_ = label; }
+
+    UserCounters counters;
+
+    /**
+     * @brief Exclut une préparation de la mesure (coûteux, hors boucle chaude)
+     */
+    void PauseTiming();
+    void ResumeTiming();
+
+    // Résultats lus par le lanceur
+    double realSeconds() const { return realSeconds_; }
+    double cpuSeconds() const { return cpuSeconds_; }
+    int64_t itemsProcessed() const { return itemsProcessed_; }
+    int64_t bytesProcessed() const { return bytesProcessed_; }
+    const std::string& label() const { return label_; }
+
+private:
+    void startTiming();
+    void finishTiming();
+
+    int64_t maxIterations_;
+    int64_t remaining_ = 0;
+    std::vector<int64_t> args_;
+    bool started_ = false;
+    bool finished_ = false;
+    bool running_ = false;
+
+    std::chrono::steady_clock::time_point realStart_{};
+    std::clock_t cpuStart_ = 0;
+    double realSeconds_ = 0.0;
+    double cpuSeconds_ = 0.0;
+
+    int64_t itemsProcessed_ = 0;
+    int64_t bytesProcessed_ = 0;
+    std::string label_;
+};
+
+/**
+ * @brief Déclaration d'un banc : nom, fonction et jeux d'arguments
+ */
+class Benchmark {
+public:
+    Benchmark(const char* name, Function function) : name_(name), function_(function) {}
+
+    Benchmark* Arg(int64_t value) {
+        argSets_.push_back({value});
+        return this;
+    }
+
+    Benchmark* Args(std::initializer_list<int64_t> values) {
+        argSets_.emplace_back(values);
+        return this;
+    }
+
+    /**
+     * @brief Produit cartésien des listes de valeurs, une liste par argument
+     */
+    Benchmark* ArgsProduct(std::initializer_list<std::initializer_list<int64_t>> lists);
+
+    Benchmark* ArgName(const char* name) {
+        argNames_ = {name};
+        return this;
+    }
+
+    Benchmark* ArgNames(std::initializer_list<const char*> names) {
+        argNames_.assign(names.begin(), names.end());
+        return this;
+    }
+
+    const std::string& name() const { return name_; }
+    Function function() const { return function_; }
+    const std::vector<std::vector<int64_t>>& argSets() const { return argSets_; }
+    const std::vector<std::string>& argNames() const { return argNames_; }
+
+private:
+    std::string name_;
+    Function function_;
+    std::vector<std::vector<int64_t>> argSets_;
+    std::vector<std::string> argNames_;
+};
+
+/**
+ * @brief Enregistre un banc (utilisé par la macro BENCHMARK)
+ */
+Benchmark* RegisterBenchmark(const char* name, Function function);
+
+void Initialize(int* argc, char** argv);
+size_t RunSpecifiedBenchmarks();
+
+}  // namespace benchmark
+
+#define BENCHMARK_CONCAT_INNER(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_INNER(a, b)
+
+#define BENCHMARK(function)                                                                     \
+    [[maybe_unused]] static ::benchmark::Benchmark* BENCHMARK_CONCAT(benchmark_registration_,  \
+                                                                     __LINE__) =               \
+        ::benchmark::RegisterBenchmark(#function, function)
+
+#define BENCHMARK_MAIN()                          \
+    int main(int argc, char** argv) {             \
+        ::benchmark::Initialize(&argc, argv);     \
+        ::benchmark::RunSpecifiedBenchmarks();    \
+        return 0;                                 \
+    }
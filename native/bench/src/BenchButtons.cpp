@@ -0,0 +1,154 @@
+// Bancs de l'anti-rebond des boutons : compteur scalaire par bouton contre
+// VerticalCounterDebouncer, et scan complet de DigitalButtonManager
+//
+// Les échantillons bruts sont précalculés (rebonds aléatoires puis plages
+// stables) pour que seul le coût de l'anti-rebond soit mesuré.
+
+#include "Benchmark.h"
+
+#include <HostRuntime.h>
+
+#include <vector>
+
+#include "adapters/secondary/hardware/input/buttons/DigitalButtonManager.hpp"
+#include "adapters/secondary/hardware/input/buttons/VerticalCounterDebouncer.hpp"
+
+namespace {
+
+using Mask = VerticalCounterDebouncer::Mask;
+
+constexpr size_t SAMPLES = 4096;
+constexpr uint32_t SCAN_PERIOD_US = 1000;
+constexpr uint16_t DEBOUNCE_MS[] = {5, 10, 30};  // Trois classes de seuil
+
+/**
+ * @brief Échantillons bruts : chaque bouton rebondit quelques périodes à chaque bascule
+ */
+std::vector<Mask> bounceSamples(size_t buttons) {
+    std::vector<Mask> samples(SAMPLES);
+    const Mask used = buttons >= 64 ? ~Mask{0} : (Mask{1} << buttons) - 1;
+    uint32_t seed = 0xC0FFEE;
+    Mask level = 0;
+    Mask bouncing = 0;
+    for (auto& sample : samples) {
+        seed = seed * 1664525u + 1013904223u;
+        if ((seed & 0x3F) == 0) {
+            const Mask bit = Mask{1} << ((seed >> 8) % buttons);
+            level ^= bit;
+            bouncing |= bit;
+        } else if ((seed & 0x3F) < 8) {
+            bouncing = 0;
+        }
+        const Mask noise = (static_cast<Mask>(seed) << 32 | seed * 2654435761u) & bouncing;
+        sample = (level ^ noise) & used;
+    }
+    return samples;
+}
+
+uint8_t thresholdFor(size_t button) {
+    return VerticalCounterDebouncer::samplesFor(DEBOUNCE_MS[button % 3], SCAN_PERIOD_US);
+}
+
+/**
+ * @brief Anti-rebond par bouton (un compteur et une comparaison par bouton)
+ */
+struct ScalarDebouncer {
+    uint8_t threshold = 1;
+    uint8_t count = 0;
+    bool state = false;
+
+    bool update(bool raw) {
+        if (raw == state) {
+            count = 0;
+            return false;
+        }
+        if (++count < threshold) {
+            return false;
+        }
+        state = raw;
+        count = 0;
+        return true;
+    }
+};
+
+/**
+ * @brief Un échantillon de tous les boutons, un compteur par bouton
+ *
+ * Argument : nombre de boutons (au plus SystemConstants::Buttons::MAX_BUTTONS).
+ */
+void BM_ButtonDebounce_Scalar(benchmark::State& state) {
+    const size_t buttons = static_cast<size_t>(state.range(0));
+    const std::vector<Mask> samples = bounceSamples(buttons);
+    std::vector<ScalarDebouncer> debouncers(buttons);
+    for (size_t i = 0; i < buttons; ++i) {
+        debouncers[i].threshold = thresholdFor(i);
+    }
+
+    size_t index = 0;
+    for (auto _ : state) {
+        const Mask raw = samples[index];
+        Mask changed = 0;
+        for (size_t i = 0; i < buttons; ++i) {
+            if (debouncers[i].update((raw >> i) & 1)) {
+                changed |= Mask{1} << i;
+            }
+        }
+        benchmark::DoNotOptimize(changed);
+        index = (index + 1) % SAMPLES;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ButtonDebounce_Scalar)->ArgName("buttons")->Arg(16)->Arg(64);
+
+/**
+ * @brief Un échantillon de tous les boutons, compteurs verticaux
+ */
+void BM_ButtonDebounce_Vertical(benchmark::State& state) {
+    const size_t buttons = static_cast<size_t>(state.range(0));
+    const std::vector<Mask> samples = bounceSamples(buttons);
+    VerticalCounterDebouncer debouncer;
+    for (size_t i = 0; i < buttons; ++i) {
+        debouncer.setThreshold(i, thresholdFor(i));
+    }
+    debouncer.reset(0);
+
+    size_t index = 0;
+    for (auto _ : state) {
+        Mask changed = debouncer.update(samples[index]);
+        benchmark::DoNotOptimize(changed);
+        index = (index + 1) % SAMPLES;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ButtonDebounce_Vertical)->ArgName("buttons")->Arg(16)->Arg(64);
+
+/**
+ * @brief Scan complet en régime établi : lecture des pins directes (shim),
+ * anti-rebond et masque des changements, sans bascule
+ *
+ * Cas le plus fréquent sur la cible : la quasi-totalité des scans ne voit
+ * aucun bouton changer.
+ */
+void BM_DigitalButtonManager_Scan(benchmark::State& state) {
+    const size_t buttons = static_cast<size_t>(state.range(0));
+    std::vector<ButtonConfig> configs(buttons);
+    for (size_t i = 0; i < buttons; ++i) {
+        configs[i].id = static_cast<ButtonId>(100 + i);
+        configs[i].gpio = GpioPin{static_cast<uint8_t>(i), PinMode::PULLUP};
+        configs[i].activeLow = false;
+        configs[i].debounceMs = DEBOUNCE_MS[i % 3];
+    }
+    for (size_t i = 0; i < buttons; ++i) {
+        host::setPin(static_cast<uint8_t>(i), i % 4 == 0);
+    }
+    DigitalButtonManager manager(configs, SCAN_PERIOD_US);
+
+    for (auto _ : state) {
+        Mask changed = manager.scan();
+        benchmark::DoNotOptimize(changed);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DigitalButtonManager_Scan)->ArgName("buttons")->Arg(16);
+
+}  // namespace
@@ -0,0 +1,62 @@
+// Bancs de la configuration unifiée : recherche d'un contrôle par identifiant
+
+#include "Benchmark.h"
+
+#include "config/unified/ControlBuilder.hpp"
+#include "config/unified/UnifiedConfiguration.hpp"
+
+namespace {
+
+void fillConfiguration(UnifiedConfiguration& config, int64_t controls) {
+    for (int64_t i = 0; i < controls; ++i) {
+        const InputId id = static_cast<InputId>(100 + i);
+        if (i % 2 == 0) {
+            config.addControl(ControlBuilder(id, "Bench Encoder")
+                                  .asRotaryEncoder(0, 1)
+                                  .withMidiCC(static_cast<uint8_t>(i & 0x7F))
+                                  .build());
+        } else {
+            config.addControl(ControlBuilder(id, "Bench Button").asButton(2).withMidiNote(60).build());
+        }
+    }
+}
+
+/**
+ * @brief Recherche réussie, identifiants parcourus en tourniquet
+ *
+ * Argument : nombre de contrôles déclarés. La définition est retournée
+ * par copie, nom inclus.
+ */
+void BM_UnifiedConfiguration_FindControlById(benchmark::State& state) {
+    UnifiedConfiguration config;
+    const int64_t controls = state.range(0);
+    fillConfiguration(config, controls);
+
+    int64_t index = 0;
+    for (auto _ : state) {
+        auto control = config.findControlById(static_cast<InputId>(100 + index));
+        benchmark::DoNotOptimize(control);
+        if (++index == controls) {
+            index = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UnifiedConfiguration_FindControlById)->ArgName("controls")->Arg(16)->Arg(64)->Arg(256);
+
+/**
+ * @brief Recherche d'un identifiant absent (contrôle non déclaré)
+ */
+void BM_UnifiedConfiguration_FindControlByIdMiss(benchmark::State& state) {
+    UnifiedConfiguration config;
+    fillConfiguration(config, state.range(0));
+
+    for (auto _ : state) {
+        auto control = config.findControlById(static_cast<InputId>(1));
+        benchmark::DoNotOptimize(control);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_UnifiedConfiguration_FindControlByIdMiss)->ArgName("controls")->Arg(16)->Arg(256);
+
+}  // namespace
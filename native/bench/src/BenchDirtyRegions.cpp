@@ -0,0 +1,289 @@
+// Bancs de l'invalidation des zones à redessiner : chemin LVGL seul (celui de
+// l'arbre), ancienne fusion par vecteur de DirtyRegionManager, et carte de
+// tuiles de 8 px qui l'avait remplacée
+//
+// Ces deux derniers ne sont plus dans src/ : DirtyRegionManager n'était
+// instancié nulle part, et la carte de tuiles invalide plus de pixels que
+// LVGL seul (arrondi aux tuiles). Les bancs conservent la comparaison.
+//
+// Scène : 8 widgets de paramètre (grille 4 x 2 de cartes 80 x 120 px) dont
+// l'arc et l'étiquette changent à chaque trame. Les compteurs donnent le
+// nombre de rectangles et de pixels invalidés par trame, et le rendu estimé
+// avec la même hypothèse que BM_DisplayPipeline_Model (15 ns/px).
+
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "config/SystemConstants.hpp"
+
+namespace {
+
+using SystemConstants::Display::SCREEN_HEIGHT;
+using SystemConstants::Display::SCREEN_WIDTH;
+
+constexpr double RENDER_NS_PER_PX = 15.0;
+
+struct Area {
+    int16_t x1, y1, x2, y2;
+
+    int32_t size() const { return (x2 - x1 + 1) * (y2 - y1 + 1); }
+};
+
+Area join(const Area& a, const Area& b) {
+    return {std::min(a.x1, b.x1), std::min(a.y1, b.y1), std::max(a.x2, b.x2), std::max(a.y2, b.y2)};
+}
+
+bool overlaps(const Area& a, const Area& b) {
+    return !(a.x2 < b.x1 || b.x2 < a.x1 || a.y2 < b.y1 || b.y2 < a.y1);
+}
+
+bool contains(const Area& outer, const Area& inner) {
+    return inner.x1 >= outer.x1 && inner.y1 >= outer.y1 && inner.x2 <= outer.x2 &&
+           inner.y2 <= outer.y2;
+}
+
+/**
+ * @brief Zones marquées à chaque trame : arc et étiquette de chaque widget
+ */
+std::vector<Area> sceneAreas() {
+    std::vector<Area> areas;
+    for (int i = 0; i < 8; ++i) {
+        const int16_t x0 = static_cast<int16_t>((i % 4) * 80);
+        const int16_t y0 = static_cast<int16_t>((i / 4) * 120);
+        areas.push_back({static_cast<int16_t>(x0 + 10), static_cast<int16_t>(y0 + 14),
+                         static_cast<int16_t>(x0 + 69), static_cast<int16_t>(y0 + 73)});
+        areas.push_back({static_cast<int16_t>(x0 + 4), static_cast<int16_t>(y0 + 86),
+                         static_cast<int16_t>(x0 + 75), static_cast<int16_t>(y0 + 101)});
+    }
+    return areas;
+}
+
+/**
+ * @brief Invalidation LVGL : lv_inv_area() puis fusion des zones au rafraîchissement
+ *
+ * Une zone déjà couverte est ignorée ; deux zones sont réunies si leur boîte
+ * englobante est plus petite que la somme de leurs surfaces (lv_refr_join_area).
+ */
+class LvglInvalidation {
+public:
+    static constexpr size_t INV_BUF_SIZE = 32;  // LV_INV_BUF_SIZE
+
+    void invalidate(const Area& area) {
+        for (size_t i = 0; i < count_; ++i) {
+            if (contains(areas_[i], area)) {
+                return;
+            }
+        }
+        if (count_ == INV_BUF_SIZE) {
+            areas_[0] = {0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1};
+            count_ = 1;
+            return;
+        }
+        areas_[count_++] = area;
+    }
+
+    size_t refresh(std::array<Area, INV_BUF_SIZE>& out) {
+        std::array<bool, INV_BUF_SIZE> joined{};
+        for (size_t j = 0; j < count_; ++j) {
+            for (size_t k = 0; k < count_; ++k) {
+                if (j == k || joined[j] || joined[k] || !overlaps(areas_[j], areas_[k])) {
+                    continue;
+                }
+                const Area merged = join(areas_[j], areas_[k]);
+                if (merged.size() < areas_[j].size() + areas_[k].size()) {
+                    areas_[j] = merged;
+                    joined[k] = true;
+                }
+            }
+        }
+
+        size_t result = 0;
+        for (size_t i = 0; i < count_; ++i) {
+            if (!joined[i]) {
+                out[result++] = areas_[i];
+            }
+        }
+        count_ = 0;
+        return result;
+    }
+
+private:
+    std::array<Area, INV_BUF_SIZE> areas_{};
+    size_t count_ = 0;
+};
+
+/**
+ * @brief Ancien DirtyRegionManager : vecteur et fusion par paires à chaque marquage
+ */
+class VectorMerge {
+public:
+    void markDirty(const Area& area) {
+        regions_.push_back(area);
+        for (size_t i = 0; i < regions_.size(); ++i) {
+            for (size_t j = i + 1; j < regions_.size(); ++j) {
+                if (overlaps(regions_[i], regions_[j])) {
+                    regions_[i] = join(regions_[i], regions_[j]);
+                    regions_.erase(regions_.begin() + j);
+                    --j;
+                }
+            }
+        }
+    }
+
+    template <typename Sink>
+    void apply(Sink&& sink) {
+        for (const Area& region : regions_) {
+            sink(region);
+        }
+        regions_.clear();
+    }
+
+private:
+    std::vector<Area> regions_;
+};
+
+/**
+ * @brief Carte de tuiles de 8 px, une ligne de tuiles par mot, au plus 8 rectangles
+ */
+class TileBitmap {
+public:
+    static constexpr int TILE = 8;
+    static constexpr int COLUMNS = SCREEN_WIDTH / TILE;
+    static constexpr int ROWS = SCREEN_HEIGHT / TILE;
+    static constexpr size_t MAX_REGIONS = 8;
+
+    void markDirty(const Area& area) {
+        const uint64_t mask = columnMask(area.x1 / TILE, area.x2 / TILE);
+        for (int row = area.y1 / TILE; row <= area.y2 / TILE; ++row) {
+            tiles_[row] |= mask;
+        }
+    }
+
+    template <typename Sink>
+    void apply(Sink&& sink) {
+        size_t count = 0;
+        for (int row = 0; row < ROWS; ++row) {
+            while (tiles_[row]) {
+                if (count == MAX_REGIONS - 1) {
+                    sink(boundingRegion(row));
+                    tiles_.fill(0);
+                    return;
+                }
+
+                const uint64_t bits = tiles_[row];
+                const int first = __builtin_ctzll(bits);
+                const uint64_t shifted = ~(bits >> first);
+                const int length = shifted ? __builtin_ctzll(shifted) : 64 - first;
+                const uint64_t mask = columnMask(first, first + length - 1);
+
+                int last = row;
+                while (last + 1 < ROWS && (tiles_[last + 1] & mask) == mask) {
+                    ++last;
+                }
+                for (int r = row; r <= last; ++r) {
+                    tiles_[r] &= ~mask;
+                }
+
+                sink(tileArea(first, row, first + length - 1, last));
+                ++count;
+            }
+        }
+    }
+
+private:
+    std::array<uint64_t, ROWS> tiles_{};
+
+    static constexpr uint64_t columnMask(int first, int last) {
+        const uint64_t upper = (last >= 63) ? ~0ull : ((1ull << (last + 1)) - 1);
+        return upper & ~((1ull << first) - 1);
+    }
+
+    static Area tileArea(int col1, int row1, int col2, int row2) {
+        return {static_cast<int16_t>(col1 * TILE), static_cast<int16_t>(row1 * TILE),
+                static_cast<int16_t>((col2 + 1) * TILE - 1), static_cast<int16_t>((row2 + 1) * TILE - 1)};
+    }
+
+    Area boundingRegion(int firstRow) const {
+        uint64_t columns = 0;
+        int lastRow = firstRow;
+        for (int row = firstRow; row < ROWS; ++row) {
+            if (tiles_[row]) {
+                columns |= tiles_[row];
+                lastRow = row;
+            }
+        }
+        return tileArea(__builtin_ctzll(columns), firstRow, 63 - __builtin_clzll(columns), lastRow);
+    }
+};
+
+/**
+ * @brief Publie les compteurs de la dernière trame
+ */
+void reportAreas(benchmark::State& state, const std::array<Area, LvglInvalidation::INV_BUF_SIZE>& areas,
+                 size_t count) {
+    int32_t pixels = 0;
+    for (size_t i = 0; i < count; ++i) {
+        pixels += areas[i].size();
+    }
+    state.counters["rects"] = static_cast<double>(count);
+    state.counters["pixels"] = pixels;
+    state.counters["render_us"] = pixels * RENDER_NS_PER_PX / 1000.0;
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @brief Chaque zone passe directement à lv_obj_invalidate_area()
+ */
+void BM_DirtyRegions_Lvgl(benchmark::State& state) {
+    const std::vector<Area> scene = sceneAreas();
+    LvglInvalidation lvgl;
+    std::array<Area, LvglInvalidation::INV_BUF_SIZE> areas{};
+    size_t count = 0;
+
+    for (auto _ : state) {
+        for (const Area& area : scene) {
+            lvgl.invalidate(area);
+        }
+        count = lvgl.refresh(areas);
+        benchmark::DoNotOptimize(areas);
+    }
+    reportAreas(state, areas, count);
+}
+BENCHMARK(BM_DirtyRegions_Lvgl);
+
+/**
+ * @brief Marquage dans un gestionnaire, puis applyToLVGL() avant le rafraîchissement
+ */
+template <typename Manager>
+void dirtyRegionsThroughManager(benchmark::State& state) {
+    const std::vector<Area> scene = sceneAreas();
+    Manager manager;
+    LvglInvalidation lvgl;
+    std::array<Area, LvglInvalidation::INV_BUF_SIZE> areas{};
+    size_t count = 0;
+
+    for (auto _ : state) {
+        for (const Area& area : scene) {
+            manager.markDirty(area);
+        }
+        manager.apply([&lvgl](const Area& area) { lvgl.invalidate(area); });
+        count = lvgl.refresh(areas);
+        benchmark::DoNotOptimize(areas);
+    }
+    reportAreas(state, areas, count);
+}
+
+void BM_DirtyRegions_VectorMerge(benchmark::State& state) {
+    dirtyRegionsThroughManager<VectorMerge>(state);
+}
+BENCHMARK(BM_DirtyRegions_VectorMerge);
+
+void BM_DirtyRegions_TileBitmap(benchmark::State& state) {
+    dirtyRegionsThroughManager<TileBitmap>(state);
+}
+BENCHMARK(BM_DirtyRegions_TileBitmap);
+
+}  // namespace
@@ -0,0 +1,222 @@
+// Modèle du pipeline d'affichage LVGL -> ILI9341_T4 : flush synchrone, flush
+// asynchrone en mode partiel et mode direct, sur des trames enchaînées
+//
+// Le mode direct a été retiré du bridge : ILI9341_T4::update() recopie et
+// compare toute la trame à chaque envoi, ce qui annule le gain attendu. Son
+// modèle reste ici comme référence si le driver sait un jour envoyer
+// directement depuis le buffer de LVGL.
+//
+// Les bancs ne mesurent pas le rendu (LVGL et le DMA n'existent pas sur hôte) :
+// ils rejouent sur une horloge simulée la machine d'états de
+// Ili9341LvglBridge (bande en attente tant que le DMA est actif, attente de
+// LVGL sur un buffer encore détenu, envoi avec la dernière bande) et
+// publient par trame les compteurs de FlushStats (rendu, transfert,
+// recouvrement, attente). Les coûts unitaires ci-dessous sont des hypothèses
+// à remplacer par les valeurs de printRenderStats() relevées sur cible.
+
+#include "Benchmark.h"
+
+#include <algorithm>
+
+#include "config/SystemConstants.hpp"
+
+namespace {
+
+using namespace SystemConstants::Display;
+
+// Hypothèses de coût (Teensy 4.1, 600 MHz)
+constexpr double RENDER_NS_PER_PX = 15.0;  // Rendu logiciel LVGL en RGB565
+constexpr double COPY_NS_PER_PX = 2.0;     // Copie vers la trame miroir du driver
+constexpr double DIFF_NS_PER_PX = 2.0;     // Calcul du diff par le driver
+constexpr double CHANGED_RATIO = 0.5;      // Pixels invalidés qui changent réellement
+constexpr double SPI_BITS_PER_US = SPI_SPEED / 1e6;
+constexpr double TICK_US = SystemConstants::Performance::DISPLAY_REFRESH_PERIOD_MS * 1000.0;
+
+constexpr int FRAMES = 60;
+
+enum class Mode { Synchronous, AsyncPartial, AsyncDirect };
+
+struct FrameStats {
+    double frameUs = 0;
+    double renderUs = 0;
+    double transferUs = 0;
+    double overlapUs = 0;
+    double waitUs = 0;
+};
+
+double uploadUs(double pixels) {
+    return pixels * CHANGED_RATIO * 16.0 / SPI_BITS_PER_US;
+}
+
+/**
+ * @brief Horloge simulée : CPU séquentiel, DMA en parallèle
+ *
+ * Une trame démarre à chaque tick de la tâche UI (ou dès que la précédente
+ * a rendu la main si elle a débordé). frameUs est le temps CPU occupé par le
+ * pipeline par trame, attentes comprises : c'est ce que la tâche UI retire
+ * aux autres tâches.
+ */
+class Pipeline {
+public:
+    explicit Pipeline(Mode mode) : mode_(mode) {}
+
+    /**
+     * @brief Rend et envoie une trame dont `lines` lignes pleine largeur sont invalidées
+     */
+    void frame(uint32_t lines) {
+        nowUs_ = std::max(nowUs_, tick_++ * TICK_US);
+        serviceFlush();
+
+        if (mode_ == Mode::AsyncDirect) {
+            directFrame(lines);
+            return;
+        }
+
+        const uint32_t bandLines = static_cast<uint32_t>(LVGL_BUFFER_LINES);
+        for (uint32_t y = 0; y < lines; y += bandLines) {
+            const double pixels = static_cast<double>(SCREEN_WIDTH) * std::min(bandLines, lines - y);
+            const bool last = y + bandLines >= lines;
+
+            render(pixels);
+
+            if (mode_ == Mode::Synchronous) {
+                // Avant l'envoi asynchrone : chaque bande est copiée, comparée et envoyée
+                // avant lv_display_flush_ready()
+                busy(pixels * (COPY_NS_PER_PX + DIFF_NS_PER_PX) / 1000.0);
+                startTransfer(uploadUs(pixels));
+                waitFor(dmaEndUs_);
+                continue;
+            }
+
+            // LVGL attend la fin du flush précédent avant d'appeler flush_cb (flush_wait_cb)
+            if (parked_) {
+                waitFor(dmaEndUs_);
+                serviceFlush();
+            }
+            if (dmaEndUs_ > nowUs_) {
+                // Transfert en cours : la bande est mise en attente, LVGL continue
+                parked_ = true;
+                parkedPixels_ = pixels;
+                parkedLast_ = last;
+            } else {
+                submit(pixels, last);
+            }
+        }
+    }
+
+    FrameStats perFrame(int frames) const {
+        FrameStats stats = stats_;
+        stats.frameUs /= frames;
+        stats.renderUs /= frames;
+        stats.transferUs /= frames;
+        stats.overlapUs /= frames;
+        stats.waitUs /= frames;
+        return stats;
+    }
+
+private:
+    void directFrame(uint32_t lines) {
+        // LVGL dessine dans la trame persistante ; ILI9341_T4::update() compare toute
+        // la trame au miroir du driver, qui attend d'abord la fin du transfert précédent
+        render(static_cast<double>(SCREEN_WIDTH) * lines);
+        waitFor(dmaEndUs_);
+        busy(static_cast<double>(FRAMEBUFFER_SIZE) * (COPY_NS_PER_PX + DIFF_NS_PER_PX) / 1000.0);
+        startTransfer(uploadUs(static_cast<double>(SCREEN_WIDTH) * lines));
+    }
+
+    /**
+     * @brief Envoie la bande en attente si le transfert est terminé (serviceFlush)
+     */
+    void serviceFlush() {
+        if (parked_ && dmaEndUs_ <= nowUs_) {
+            parked_ = false;
+            submit(parkedPixels_, parkedLast_);
+        }
+    }
+
+    void submit(double pixels, bool last) {
+        // updateRegion(redraw_now = last) : copie de la bande, diff et envoi avec la dernière
+        busy(pixels * COPY_NS_PER_PX / 1000.0);
+        framePixels_ += pixels;
+        if (last) {
+            busy(framePixels_ * DIFF_NS_PER_PX / 1000.0);
+            startTransfer(uploadUs(framePixels_));
+            framePixels_ = 0;
+        }
+    }
+
+    void render(double pixels) {
+        const double startUs = nowUs_;
+        busy(pixels * RENDER_NS_PER_PX / 1000.0);
+        stats_.renderUs += nowUs_ - startUs;
+
+        // Recouvrement : part du transfert en cours pendant laquelle LVGL rendait
+        const double from = std::max(startUs, dmaStartUs_);
+        const double to = std::min(nowUs_, dmaEndUs_);
+        if (to > from) {
+            stats_.overlapUs += to - from;
+        }
+    }
+
+    void startTransfer(double durationUs) {
+        dmaStartUs_ = nowUs_;
+        dmaEndUs_ = dmaStartUs_ + durationUs;
+        stats_.transferUs += durationUs;
+    }
+
+    void waitFor(double untilUs) {
+        if (untilUs > nowUs_) {
+            stats_.waitUs += untilUs - nowUs_;
+            busy(untilUs - nowUs_);
+        }
+    }
+
+    void busy(double us) {
+        nowUs_ += us;
+        stats_.frameUs += us;
+    }
+
+    Mode mode_;
+    FrameStats stats_;
+    double nowUs_ = 0;
+    uint32_t tick_ = 0;
+    double dmaStartUs_ = 0;
+    double dmaEndUs_ = 0;
+    double framePixels_ = 0;
+
+    bool parked_ = false;
+    double parkedPixels_ = 0;
+    bool parkedLast_ = false;
+};
+
+/**
+ * @brief Trames enchaînées (animation) dans le mode donné
+ *
+ * Arguments : mode (0 = flush synchrone, 1 = asynchrone partiel,
+ * 2 = asynchrone direct, retiré du bridge) et nombre de lignes invalidées par trame.
+ */
+void BM_DisplayPipeline_Model(benchmark::State& state) {
+    const Mode mode = static_cast<Mode>(state.range(0));
+    const uint32_t lines = static_cast<uint32_t>(state.range(1));
+
+    FrameStats stats;
+    for (auto _ : state) {
+        Pipeline pipeline(mode);
+        for (int i = 0; i < FRAMES; ++i) {
+            pipeline.frame(lines);
+        }
+        stats = pipeline.perFrame(FRAMES);
+        benchmark::DoNotOptimize(stats);
+    }
+
+    state.counters["frame_us"] = stats.frameUs;
+    state.counters["render_us"] = stats.renderUs;
+    state.counters["transfer_us"] = stats.transferUs;
+    state.counters["overlap_us"] = stats.overlapUs;
+    state.counters["wait_us"] = stats.waitUs;
+}
+BENCHMARK(BM_DisplayPipeline_Model)
+    ->ArgNames({"mode", "lines"})
+    ->ArgsProduct({{0, 1, 2}, {60, 120, 240}});
+
+}  // namespace
@@ -0,0 +1,115 @@
+// Banc de l'accélération d'encodeur : rejeu de gestes horodatés cran par cran
+//
+// Chaque geste est une suite d'intervalles entre crans (signe = sens de
+// rotation), tels que relevés par QuadratureEncoder::readDelta() sur un
+// encodeur 24 PPR. Le rejeu passe par EncoderAccelerator::apply() avec la
+// courbe par défaut d'EncoderConfig, comme sur la cible.
+
+#include "Benchmark.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include "adapters/secondary/hardware/input/encoders/EncoderAccelerator.hpp"
+#include "config/SystemConstants.hpp"
+
+namespace {
+
+struct Detent {
+    int32_t steps;        ///< Crans lus dans l'appel (signé)
+    uint32_t intervalUs;  ///< Temps écoulé depuis l'appel précédent
+};
+
+/**
+ * @brief Segment de geste : count crans à intervalle constant (+/- jitter %)
+ */
+struct Segment {
+    int32_t direction;
+    uint32_t count;
+    uint32_t intervalMs;
+};
+
+// Réglage fin : crans espacés, toujours au-delà du seuil (gain x1 attendu)
+constexpr Segment FINE_ADJUST[] = {{1, 12, 180}, {-1, 6, 220}, {1, 10, 150}};
+
+// Balayage : démarrage lent, rotation rapide puis ralentissement sur la cible
+constexpr Segment SWEEP[] = {{1, 4, 90}, {1, 8, 40}, {1, 48, 9}, {1, 10, 25}, {1, 6, 70}, {1, 4, 160}};
+
+// Allers-retours rapides : chaque changement de sens remet le gain à x1
+constexpr Segment WOBBLE[] = {{1, 6, 12}, {-1, 6, 12}, {1, 6, 10}, {-1, 6, 10}, {1, 6, 14}, {-1, 6, 14}};
+
+template <size_t N>
+std::vector<Detent> expand(const Segment (&segments)[N]) {
+    std::vector<Detent> detents;
+    uint32_t seed = 12345;
+    for (const Segment& segment : segments) {
+        for (uint32_t i = 0; i < segment.count; ++i) {
+            // Jitter déterministe de +/-10 % : la main n'est jamais régulière
+            seed = seed * 1103515245u + 12345u;
+            const int32_t jitterPercent = static_cast<int32_t>((seed >> 16) % 21) - 10;
+            const uint32_t intervalUs = segment.intervalMs * (1000 + jitterPercent * 10);
+            detents.push_back({segment.direction, intervalUs});
+        }
+    }
+    return detents;
+}
+
+std::vector<Detent> gesture(int64_t index) {
+    switch (index) {
+        case 0:
+            return expand(FINE_ADJUST);
+        case 1:
+            return expand(SWEEP);
+        default:
+            return expand(WOBBLE);
+    }
+}
+
+/**
+ * @brief Rejeu d'un geste enregistré à travers EncoderAccelerator::apply()
+ *
+ * Arguments : geste (0 réglage fin, 1 balayage, 2 allers-retours) et
+ * accélération (0 désactivée, comme avant, 1 courbe par défaut).
+ * Compteurs : crans lus et pas effectivement appliqués sur un rejeu complet,
+ * gain moyen qui en découle ; le temps mesuré est celui d'un appel.
+ */
+void BM_EncoderAccelerator_Replay(benchmark::State& state) {
+    const std::vector<Detent> detents = gesture(state.range(0));
+    EncoderAccelerator accelerator;
+    if (state.range(1) != 0) {
+        accelerator.configure(SystemConstants::Encoders::ACCELERATION_THRESHOLD_MS,
+                              SystemConstants::Encoders::MAX_ACCELERATION);
+    }
+
+    // Rejeu de référence, hors mesure : effet de la courbe sur le geste
+    uint32_t nowUs = 0;
+    int64_t detentCount = 0;
+    int64_t appliedSteps = 0;
+    for (const Detent& detent : detents) {
+        nowUs += detent.intervalUs;
+        detentCount += std::abs(detent.steps);
+        appliedSteps += std::abs(accelerator.apply(detent.steps, nowUs));
+    }
+    state.counters["detents"] = static_cast<double>(detentCount);
+    state.counters["steps"] = static_cast<double>(appliedSteps);
+    state.counters["gain"] = static_cast<double>(appliedSteps) / static_cast<double>(detentCount);
+
+    accelerator.reset();
+    size_t index = 0;
+    int32_t sink = 0;
+    for (auto _ : state) {
+        const Detent& detent = detents[index];
+        nowUs += detent.intervalUs;
+        sink += accelerator.apply(detent.steps, nowUs);
+        if (++index == detents.size()) {
+            index = 0;
+        }
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EncoderAccelerator_Replay)
+    ->ArgNames({"gesture", "accel"})
+    ->ArgsProduct({{0, 1, 2}, {0, 1}});
+
+}  // namespace
@@ -0,0 +1,75 @@
+// Bancs du bus d'événements : publication synchrone selon le nombre d'abonnés
+
+#include "Benchmark.h"
+
+#include <memory>
+
+#include "core/domain/events/MidiEvents.hpp"
+#include "core/domain/events/core/EventBus.hpp"
+
+namespace {
+
+class CountingListener : public EventListener {
+public:
+    bool onEvent(const Event& event) override {
+        count_ += event.getType();
+        return false;  // Ne pas consommer : tous les abonnés sont visités
+    }
+
+private:
+    uint32_t count_ = 0;
+};
+
+std::unique_ptr<EventBus> makeBus() {
+    EventBus::Config config;
+    config.enable_batching = false;
+    return std::make_unique<EventBus>(config);
+}
+
+/**
+ * @brief Publication d'un changement d'encodeur reçu par tous les abonnés
+ *
+ * Argument : nombre d'abonnés au type publié (au plus MAX_EVENT_SUBSCRIBERS).
+ */
+void BM_EventBus_Publish(benchmark::State& state) {
+    auto bus = makeBus();
+    const int64_t subscribers = state.range(0);
+    std::vector<CountingListener> listeners(static_cast<size_t>(subscribers));
+    for (auto& listener : listeners) {
+        bus->subscribeToTypes(&listener, {EventTypes::HighPriorityEncoderChanged});
+    }
+
+    HighPriorityEncoderChangedEvent event(1, 0, 1);
+    for (auto _ : state) {
+        event.position++;
+        benchmark::DoNotOptimize(bus->publish(event));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventBus_Publish)->ArgName("subscribers")->Arg(1)->Arg(4)->Arg(16)->Arg(32);
+
+/**
+ * @brief Publication avec un seul abonné concerné parmi N
+ *
+ * Les autres abonnés filtrent d'autres types : mesure l'efficacité de
+ * l'indexation par type face au nombre total d'abonnements.
+ */
+void BM_EventBus_PublishFiltered(benchmark::State& state) {
+    auto bus = makeBus();
+    const int64_t subscribers = state.range(0);
+    std::vector<CountingListener> listeners(static_cast<size_t>(subscribers));
+    bus->subscribeToTypes(&listeners[0], {EventTypes::HighPriorityEncoderChanged});
+    for (size_t i = 1; i < listeners.size(); ++i) {
+        bus->subscribeToTypes(&listeners[i], {EventTypes::HighPriorityButtonPress});
+    }
+
+    HighPriorityEncoderChangedEvent event(1, 0, 1);
+    for (auto _ : state) {
+        event.position++;
+        benchmark::DoNotOptimize(bus->publish(event));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventBus_PublishFiltered)->ArgName("subscribers")->Arg(1)->Arg(4)->Arg(16)->Arg(32);
+
+}  // namespace
@@ -0,0 +1,132 @@
+// Bancs du routage des entrées : ancienne recherche dans UnifiedConfiguration
+// contre la table précalculée InputRoutingTable
+//
+// Les deux bancs résolvent la même chose pour chaque événement d'encodeur :
+// présence d'un mapping de navigation, action et paramètre après sensibilité.
+
+#include "Benchmark.h"
+
+#include "config/SystemConstants.hpp"
+#include "config/unified/ControlBuilder.hpp"
+#include "config/unified/UnifiedConfiguration.hpp"
+#include "core/controllers/processors/InputRoutingTable.hpp"
+
+namespace {
+
+void fillConfiguration(UnifiedConfiguration& config, int64_t controls) {
+    for (int64_t i = 0; i < controls; ++i) {
+        const InputId id = static_cast<InputId>(100 + i);
+        if (i % 2 == 0) {
+            config.addControl(ControlBuilder(id, "Bench Encoder")
+                                  .asRotaryEncoder(0, 1)
+                                  .withMidiCC(static_cast<uint8_t>(i & 0x7F))
+                                  .asItemNavigator()
+                                  .build());
+        } else {
+            config.addControl(
+                ControlBuilder(id, "Bench Button").asButton(2).asItemValidator().build());
+        }
+    }
+}
+
+struct Resolved {
+    bool handled;
+    NavigationAction action;
+    int parameter;
+};
+
+int applySensitivity(int8_t relativeChange, float sensitivity) {
+    return static_cast<int>(relativeChange * sensitivity);
+}
+
+/**
+ * @brief Chemin d'avant la table : copie de la définition à chaque événement
+ *
+ * Reprise telle quelle de NavigationInputProcessor::processNavigationEncoder
+ * avant InputRoutingTable (findControlDefinition, hasNavigationMappings,
+ * extractNavigationAction, calculateEncoderParameter).
+ */
+Resolved resolveLegacy(const UnifiedConfiguration& config, InputId id, int8_t relativeChange) {
+    auto controlOpt = config.findControlById(id);
+    if (!controlOpt.has_value()) {
+        return {false, NavigationAction::ITEM_NAVIGATOR, 0};
+    }
+    const auto& control = controlOpt.value();
+    auto navigationMappings = control.getMappingsForRole(MappingRole::NAVIGATION);
+    if (navigationMappings.empty()) {
+        return {false, NavigationAction::ITEM_NAVIGATOR, 0};
+    }
+
+    NavigationAction action = SystemConstants::Encoders::DEFAULT_ACTION;
+    for (const auto& mapping : control.getMappingsForRole(MappingRole::NAVIGATION)) {
+        if (mapping.appliesTo == MappingControlType::ENCODER) {
+            action = std::get<ControlDefinition::NavigationConfig>(mapping.config).action;
+            break;
+        }
+    }
+
+    int parameter = SystemConstants::Encoders::DEFAULT_PARAMETER;
+    if (control.hardware.type == InputType::ENCODER) {
+        const auto& encoderConfig =
+            std::get<ControlDefinition::EncoderConfig>(control.hardware.config);
+        parameter = applySensitivity(relativeChange, encoderConfig.sensitivity);
+    }
+    return {true, action, parameter};
+}
+
+Resolved resolveTable(const InputRoutingTable& table, InputId id, int8_t relativeChange) {
+    const auto* route = table.find(id);
+    if (!route || !route->hasNavigation) {
+        return {false, NavigationAction::ITEM_NAVIGATOR, 0};
+    }
+    const int parameter = route->isEncoderHardware
+                              ? applySensitivity(relativeChange, route->sensitivity)
+                              : SystemConstants::Encoders::DEFAULT_PARAMETER;
+    return {true, route->encoderAction, parameter};
+}
+
+/**
+ * @brief Routage d'un événement d'encodeur, avant (copie de ControlDefinition)
+ *
+ * Argument : nombre de contrôles déclarés (au plus MAX_CONTROL_DEFINITIONS),
+ * identifiants parcourus en tourniquet.
+ */
+void BM_InputRouting_Legacy(benchmark::State& state) {
+    UnifiedConfiguration config;
+    const int64_t controls = state.range(0);
+    fillConfiguration(config, controls);
+
+    int64_t index = 0;
+    for (auto _ : state) {
+        Resolved resolved = resolveLegacy(config, static_cast<InputId>(100 + index), 1);
+        benchmark::DoNotOptimize(resolved);
+        if (++index == controls) {
+            index = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InputRouting_Legacy)->ArgName("controls")->Arg(16)->Arg(64);
+
+/**
+ * @brief Routage d'un événement d'encodeur, après (InputRoutingTable)
+ */
+void BM_InputRouting_Table(benchmark::State& state) {
+    UnifiedConfiguration config;
+    const int64_t controls = state.range(0);
+    fillConfiguration(config, controls);
+    const InputRoutingTable table(config);
+
+    int64_t index = 0;
+    for (auto _ : state) {
+        Resolved resolved = resolveTable(table, static_cast<InputId>(100 + index), 1);
+        benchmark::DoNotOptimize(resolved);
+        if (++index == controls) {
+            index = 0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_InputRouting_Table)->ArgName("controls")->Arg(16)->Arg(64);
+
+}  // namespace
@@ -0,0 +1,329 @@
+// Lanceur des micro-bancs hôte (voir Benchmark.h)
+//
+// Usage : program [--benchmark_filter=REGEX] [--benchmark_min_time=SECONDES]
+//                 [--benchmark_format=console|json] [--benchmark_out=FICHIER]
+//                 [--benchmark_list_tests]
+//
+// --benchmark_out écrit toujours du JSON, quel que soit le format console :
+// c'est ce fichier que native/tools/bench_compare.py confronte à
+// native/bench/baseline.json.
+
+#include "Benchmark.h"
+
+#include <HostRuntime.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <regex>
+#include <thread>
+
+namespace benchmark {
+
+namespace {
+
+struct Options {
+    std::string filter = ".";
+    double minTime = 0.5;
+    bool json = false;
+    bool listOnly = false;
+    std::string outPath;
+};
+
+struct Run {
+    std::string name;
+    int64_t iterations;
+    double realNs;
+    double cpuNs;
+    double itemsPerSecond;
+    double bytesPerSecond;
+    std::string label;
+    UserCounters counters;
+};
+
+constexpr int64_t MAX_ITERATIONS = 1000000000;
+
+Options options;
+
+std::vector<Benchmark*>& registry() {
+    static std::vector<Benchmark*> benchmarks;
+    return benchmarks;
+}
+
+const char* flagValue(const char* arg, const char* flag) {
+    const size_t length = strlen(flag);
+    if (strncmp(arg, flag, length) == 0 && arg[length] == '=') {
+        return arg + length + 1;
+    }
+    return nullptr;
+}
+
+std::string runName(const Benchmark& benchmark, const std::vector<int64_t>& args) {
+    std::string name = benchmark.name();
+    for (size_t i = 0; i < args.size(); ++i) {
+        name += '/';
+        if (i < benchmark.argNames().size() && !benchmark.argNames()[i].empty()) {
+            name += benchmark.argNames()[i];
+            name += ':';
+        }
+        name += std::to_string(args[i]);
+    }
+    return name;
+}
+
+/**
+ * @brief Calibre le nombre d'itérations puis retourne la mesure retenue
+ *
+ * Même stratégie que Google Benchmark : on multiplie les itérations (au plus
+ * par 10) jusqu'à ce qu'une exécution dure au moins min_time.
+ */
+Run measure(const Benchmark& benchmark, const std::vector<int64_t>& args) {
+    int64_t iterations = 1;
+    for (;;) {
+        State state(iterations, args);
+        benchmark.function()(state);
+
+        const double seconds = state.realSeconds();
+        if (seconds >= options.minTime || iterations >= MAX_ITERATIONS) {
+            Run run;
+            run.name = runName(benchmark, args);
+            run.iterations = iterations;
+            run.realNs = seconds * 1e9 / static_cast<double>(iterations);
+            run.cpuNs = state.cpuSeconds() * 1e9 / static_cast<double>(iterations);
+            const double cpuSeconds = state.cpuSeconds() > 0.0 ? state.cpuSeconds() : seconds;
+            run.itemsPerSecond = static_cast<double>(state.itemsProcessed()) / cpuSeconds;
+            run.bytesPerSecond = static_cast<double>(state.bytesProcessed()) / cpuSeconds;
+            run.label = state.label();
+            run.counters = state.counters;
+            return run;
+        }
+
+        double multiplier = seconds > 0.0 ? options.minTime * 1.4 / seconds : 10.0;
+        multiplier = std::clamp(multiplier, 2.0, 10.0);
+        iterations = std::min<int64_t>(
+            MAX_ITERATIONS, static_cast<int64_t>(std::ceil(static_cast<double>(iterations) * multiplier)));
+    }
+}
+
+std::string jsonEscape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+void writeJson(FILE* out, const std::vector<Run>& runs, const char* executable) {
+    char date[32] = {};
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+    char host[64] = {};
+    gethostname(host, sizeof(host) - 1);
+
+    fprintf(out, "{\n  \"context\": {\n");
+    fprintf(out, "    \"date\": \"%s\",\n", date);
+    fprintf(out, "    \"host_name\": \"%s\",\n", jsonEscape(host).c_str());
+    fprintf(out, "    \"executable\": \"%s\",\n", jsonEscape(executable).c_str());
+    fprintf(out, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+#ifdef __OPTIMIZE__
+    fprintf(out, "    \"library_build_type\": \"release\"\n");
+#else
+    fprintf(out, "    \"library_build_type\": \"debug\"\n");
+#endif
+    fprintf(out, "  },\n  \"benchmarks\": [\n");
+
+    for (size_t i = 0; i < runs.size(); ++i) {
+        const Run& run = runs[i];
+        fprintf(out, "    {\n");
+        fprintf(out, "      \"name\": \"%s\",\n", jsonEscape(run.name).c_str());
+        fprintf(out, "      \"run_name\": \"%s\",\n", jsonEscape(run.name).c_str());
+        fprintf(out, "      \"run_type\": \"iteration\",\n");
+        fprintf(out, "      \"iterations\": %lld,\n", static_cast<long long>(run.iterations));
+        fprintf(out, "      \"real_time\": %.4f,\n", run.realNs);
+        fprintf(out, "      \"cpu_time\": %.4f,\n", run.cpuNs);
+        fprintf(out, "      \"time_unit\": \"ns\"");
+        if (run.itemsPerSecond > 0.0) {
+            fprintf(out, ",\n      \"items_per_second\": %.4e", run.itemsPerSecond);
+        }
+        if (run.bytesPerSecond > 0.0) {
+            fprintf(out, ",\n      \"bytes_per_second\": %.4e", run.bytesPerSecond);
+        }
+        for (const auto& [name, counter] : run.counters) {
+            fprintf(out, ",\n      \"%s\": %.6g", jsonEscape(name).c_str(), counter.value);
+        }
+        if (!run.label.empty()) {
+            fprintf(out, ",\n      \"label\": \"%s\"", jsonEscape(run.label).c_str());
+        }
+        fprintf(out, "\n    }%s\n", i + 1 < runs.size() ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+void printConsoleHeader(size_t nameWidth) {
+    fprintf(stdout, "%-*s %13s %13s %12s %s\n", static_cast<int>(nameWidth), "Benchmark", "Time",
+            "CPU", "Iterations", "UserCounters...");
+    fprintf(stdout, "%s\n", std::string(nameWidth + 55, '-').c_str());
+}
+
+void printConsoleRun(const Run& run, size_t nameWidth) {
+    fprintf(stdout, "%-*s %10.1f ns %10.1f ns %12lld", static_cast<int>(nameWidth), run.name.c_str(),
+            run.realNs, run.cpuNs, static_cast<long long>(run.iterations));
+    if (run.itemsPerSecond > 0.0) {
+        fprintf(stdout, " items_per_second=%.3gM/s", run.itemsPerSecond / 1e6);
+    }
+    for (const auto& [name, counter] : run.counters) {
+        fprintf(stdout, " %s=%.4g", name.c_str(), counter.value);
+    }
+    if (!run.label.empty()) {
+        fprintf(stdout, " %s", run.label.c_str());
+    }
+    fprintf(stdout, "\n");
+    fflush(stdout);
+}
+
+const char* executableName = "";
+
+}  // namespace
+
+void State::startTiming() {
+    started_ = true;
+    remaining_ = maxIterations_;
+    ResumeTiming();
+}
+
+void State::finishTiming() {
+    if (finished_) {
+        return;
+    }
+    PauseTiming();
+    finished_ = true;
+}
+
+void State::PauseTiming() {
+    if (!running_) {
+        return;
+    }
+    realSeconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - realStart_).count();
+    cpuSeconds_ += static_cast<double>(std::clock() - cpuStart_) / CLOCKS_PER_SEC;
+    running_ = false;
+}
+
+void State::ResumeTiming() {
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    cpuStart_ = std::clock();
+    realStart_ = std::chrono::steady_clock::now();
+}
+
+Benchmark* Benchmark::ArgsProduct(std::initializer_list<std::initializer_list<int64_t>> lists) {
+    std::vector<std::vector<int64_t>> product = {{}};
+    for (const auto& list : lists) {
+        std::vector<std::vector<int64_t>> next;
+        for (const auto& prefix : product) {
+            for (int64_t value : list) {
+                next.push_back(prefix);
+                next.back().push_back(value);
+            }
+        }
+        product = std::move(next);
+    }
+    argSets_.insert(argSets_.end(), product.begin(), product.end());
+    return this;
+}
+
+Benchmark* RegisterBenchmark(const char* name, Function function) {
+    registry().push_back(new Benchmark(name, function));
+    return registry().back();
+}
+
+void Initialize(int* argc, char** argv) {
+    executableName = argv[0];
+    for (int i = 1; i < *argc; ++i) {
+        const char* arg = argv[i];
+        if (const char* value = flagValue(arg, "--benchmark_filter")) {
+            options.filter = value;
+        } else if (const char* value = flagValue(arg, "--benchmark_min_time")) {
+            options.minTime = strtod(value, nullptr);  // "0.5" ou "0.5s"
+        } else if (const char* value = flagValue(arg, "--benchmark_format")) {
+            options.json = strcmp(value, "json") == 0;
+        } else if (const char* value = flagValue(arg, "--benchmark_out")) {
+            options.outPath = value;
+        } else if (strcmp(arg, "--benchmark_list_tests") == 0) {
+            options.listOnly = true;
+        } else {
+            fprintf(stderr, "Option inconnue : %s\n", arg);
+            exit(2);
+        }
+    }
+}
+
+size_t RunSpecifiedBenchmarks() {
+    const std::regex filter(options.filter);
+
+    // Expansion des jeux d'arguments puis filtrage par nom complet
+    std::vector<std::pair<const Benchmark*, std::vector<int64_t>>> selected;
+    size_t nameWidth = 10;
+    for (const Benchmark* benchmark : registry()) {
+        std::vector<std::vector<int64_t>> argSets = benchmark->argSets();
+        if (argSets.empty()) {
+            argSets.push_back({});
+        }
+        for (const auto& args : argSets) {
+            const std::string name = runName(*benchmark, args);
+            if (std::regex_search(name, filter)) {
+                selected.emplace_back(benchmark, args);
+                nameWidth = std::max(nameWidth, name.size());
+            }
+        }
+    }
+
+    if (options.listOnly) {
+        for (const auto& [benchmark, args] : selected) {
+            fprintf(stdout, "%s\n", runName(*benchmark, args).c_str());
+        }
+        return selected.size();
+    }
+
+    std::vector<Run> runs;
+    if (!options.json) {
+        printConsoleHeader(nameWidth);
+    }
+    for (const auto& [benchmark, args] : selected) {
+        runs.push_back(measure(*benchmark, args));
+        if (!options.json) {
+            printConsoleRun(runs.back(), nameWidth);
+        }
+    }
+
+    if (options.json) {
+        writeJson(stdout, runs, executableName);
+    }
+    if (!options.outPath.empty()) {
+        FILE* out = fopen(options.outPath.c_str(), "w");
+        if (!out) {
+            fprintf(stderr, "Impossible d'ouvrir %s\n", options.outPath.c_str());
+            exit(2);
+        }
+        writeJson(out, runs, executableName);
+        fclose(out);
+    }
+    return runs.size();
+}
+
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+    // Les traces Serial du firmware ne doivent pas se mêler à la sortie JSON
+    host::setSerialEcho(false);
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,84 @@
+// Bancs des conteneurs mémoire : RingBuffer et ObjectPool
+
+#include "Benchmark.h"
+
+#include <array>
+
+#include "core/memory/ObjectPool.hpp"
+#include "core/memory/RingBuffer.hpp"
+
+namespace {
+
+// Taille du pool : celle d'une file MIDI courte, le balayage étant linéaire
+constexpr size_t POOL_SIZE = 64;
+
+/**
+ * @brief Rafale d'écritures puis de lectures, comme un cycle de la file MIDI entrante
+ *
+ * Argument : taille de rafale (messages par cycle, au plus capacity()).
+ */
+void BM_RingBuffer_WriteRead(benchmark::State& state) {
+    static MidiBuffers::IncomingMidiBuffer buffer;
+    buffer.clear();
+    const int64_t burst = state.range(0);
+    MidiBuffers::MidiMessage message(0xB0, 1, 0);
+    MidiBuffers::MidiMessage out;
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < burst; ++i) {
+            message.data2 = static_cast<uint8_t>(i & 0x7F);
+            buffer.write(message);
+        }
+        for (int64_t i = 0; i < burst; ++i) {
+            buffer.read(out);
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * burst);
+}
+BENCHMARK(BM_RingBuffer_WriteRead)->ArgName("burst")->Arg(1)->Arg(16)->Arg(64)->Arg(255);
+
+/**
+ * @brief Lecture sans consommation sur une file non vide
+ */
+void BM_RingBuffer_Peek(benchmark::State& state) {
+    static MidiBuffers::IncomingMidiBuffer buffer;
+    buffer.clear();
+    buffer.write(MidiBuffers::MidiMessage(0x90, 60, 100));
+    MidiBuffers::MidiMessage out;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(buffer.peek(out));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RingBuffer_Peek);
+
+/**
+ * @brief Acquisition puis libération d'un objet, pool partiellement occupé
+ *
+ * Argument : objets déjà vivants ; acquire() balaie les emplacements depuis
+ * le début, son coût croît donc avec l'occupation.
+ */
+void BM_ObjectPool_AcquireRelease(benchmark::State& state) {
+    static ObjectPool<MidiBuffers::MidiMessage, POOL_SIZE> pool;
+    const size_t live = static_cast<size_t>(state.range(0));
+    std::array<MidiBuffers::MidiMessage*, POOL_SIZE> held{};
+    for (size_t i = 0; i < live; ++i) {
+        held[i] = pool.acquire(0xB0, static_cast<uint8_t>(i), 0);
+    }
+
+    for (auto _ : state) {
+        MidiBuffers::MidiMessage* message = pool.acquire(0xB0, 7, 64);
+        benchmark::DoNotOptimize(message);
+        pool.release(message);
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    for (size_t i = 0; i < live; ++i) {
+        pool.release(held[i]);
+    }
+}
+BENCHMARK(BM_ObjectPool_AcquireRelease)->ArgName("live")->Arg(0)->Arg(16)->Arg(48)->Arg(63);
+
+}  // namespace
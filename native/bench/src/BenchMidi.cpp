@@ -0,0 +1,197 @@
+// Bancs de la chaîne MIDI : traitement entrant, batching et mapping encodeur -> CC
+//
+// Un cycle simule une exécution de la tâche MIDI (MIDI_TIME_INTERVAL) sur
+// l'horloge virtuelle : les messages reçus pendant la période sont traités
+// en une fois, leur nombre dépendant du débit en messages/s.
+
+#include "Benchmark.h"
+
+#include <Arduino.h>
+
+#include <memory>
+#include <vector>
+
+#include "adapters/secondary/midi/MidiMapper.hpp"
+#include "config/SystemConstants.hpp"
+#include "config/unified/ControlBuilder.hpp"
+#include "core/domain/commands/CommandManager.hpp"
+#include "core/midi/MidiBatchProcessor.hpp"
+#include "core/midi/OptimizedMidiProcessor.hpp"
+#include "core/ports/output/MidiOutputPort.hpp"
+
+namespace {
+
+constexpr uint32_t TICK_US = SystemConstants::Performance::MIDI_TIME_INTERVAL;
+
+/**
+ * @brief Répartit un débit en messages/s sur les cycles de la tâche MIDI
+ */
+class TickRate {
+public:
+    explicit TickRate(int64_t messagesPerSecond)
+        : perTick_(static_cast<uint64_t>(messagesPerSecond) * TICK_US) {}
+
+    /**
+     * @brief Nombre de messages arrivés pendant le prochain cycle
+     */
+    uint32_t next() {
+        // Accumulateur en messages x µs : la fraction reste pour le cycle suivant
+        accumulator_ += perTick_;
+        const uint32_t count = static_cast<uint32_t>(accumulator_ / 1000000);
+        accumulator_ %= 1000000;
+        return count;
+    }
+
+private:
+    uint64_t perTick_;
+    uint64_t accumulator_ = 0;
+};
+
+/**
+ * @brief Sortie MIDI qui compte les messages sans les émettre
+ */
+class NullMidiOut : public MidiOutputPort {
+public:
+    void sendControlChange(MidiChannel, MidiCC, uint8_t value) override { sent_ += value; }
+    void sendNoteOn(MidiChannel, MidiNote, uint8_t) override { sent_++; }
+    void sendNoteOff(MidiChannel, MidiNote, uint8_t) override { sent_++; }
+    void sendProgramChange(MidiChannel, uint8_t) override { sent_++; }
+    void sendPitchBend(MidiChannel, uint16_t) override { sent_++; }
+    void sendChannelPressure(MidiChannel, uint8_t) override { sent_++; }
+    void sendSysEx(const uint8_t*, uint16_t) override { sent_++; }
+
+    uint32_t sent() const { return sent_; }
+
+private:
+    uint32_t sent_ = 0;
+};
+
+void onControlChange(MidiChannel, MidiCC, uint8_t value, void* userdata) {
+    *static_cast<uint32_t*>(userdata) += value;
+}
+
+/**
+ * @brief File entrante puis dispatch des Control Change aux callbacks
+ *
+ * Arguments : callbacks CC enregistrés (au plus MAX_MIDI_CALLBACKS) et débit
+ * entrant en messages/s (31250 bauds DIN ~ 1000/s, USB bien au-delà).
+ */
+void BM_OptimizedMidiProcessor_Dispatch(benchmark::State& state) {
+    auto processor = std::make_unique<OptimizedMidiProcessor>();
+    uint32_t sink = 0;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        processor->registerCcCallback(onControlChange, &sink);
+    }
+    TickRate rate(state.range(1));
+    uint8_t value = 0;
+    int64_t messages = 0;
+
+    for (auto _ : state) {
+        const uint32_t count = rate.next();
+        for (uint32_t i = 0; i < count; ++i) {
+            processor->enqueueMidiFast(0xB0, static_cast<uint8_t>(i & 0x1F), value++ & 0x7F);
+        }
+        while (processor->processIncomingMessages() > 0) {
+        }
+        host::advanceMicros(TICK_US);
+        messages += count;
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(messages);
+}
+BENCHMARK(BM_OptimizedMidiProcessor_Dispatch)
+    ->ArgNames({"callbacks", "msgs_per_s"})
+    ->ArgsProduct({{1, 8, 24}, {1000, 10000, 50000}});
+
+void onUiBatch(uint8_t, uint8_t, uint8_t value, void* userdata) {
+    *static_cast<uint32_t*>(userdata) += value;
+}
+
+void onStatusBatch(const MidiBatchProcessor::PendingParameter*, size_t count, void* userdata) {
+    *static_cast<uint32_t*>(userdata) += static_cast<uint32_t>(count);
+}
+
+/**
+ * @brief Coalescence des paramètres puis envoi des batchs UI et status
+ *
+ * Arguments : paramètres distincts qui reçoivent le trafic (2048 = tout
+ * l'espace 16 canaux x 128 CC, bien au-delà des MAX_MIDI_PENDING_PARAMS
+ * slots) et débit en messages/s. Le compteur pool_flushes compte les vidages
+ * anticipés faute de slot libre.
+ */
+void BM_MidiBatchProcessor_Coalesce(benchmark::State& state) {
+    auto batch = std::make_unique<MidiBatchProcessor>();
+    uint32_t sink = 0;
+    batch->setUICallback(onUiBatch, &sink);
+    batch->setStatusCallback(onStatusBatch, &sink);
+    const uint32_t parameters = static_cast<uint32_t>(state.range(0));
+    TickRate rate(state.range(1));
+    uint32_t next = 0;
+    int64_t messages = 0;
+
+    for (auto _ : state) {
+        const uint32_t count = rate.next();
+        for (uint32_t i = 0; i < count; ++i) {
+            // Nouvelle valeur à chaque passage sur un paramètre : rien n'est coalescé
+            // comme identique, quel que soit le nombre de paramètres
+            const uint32_t parameter = next % parameters;
+            const uint8_t value = static_cast<uint8_t>((next++ / parameters) & 0x7F);
+            batch->addParameter(static_cast<uint8_t>(parameter & 0x7F),
+                                static_cast<uint8_t>(parameter >> 7), value);
+        }
+        batch->processPendingBatches();
+        host::advanceMicros(TICK_US);
+        messages += count;
+    }
+    benchmark::DoNotOptimize(sink);
+    state.SetItemsProcessed(messages);
+    state.counters["pool_flushes"] = batch->getStats().pool_flushes;
+}
+BENCHMARK(BM_MidiBatchProcessor_Coalesce)
+    ->ArgNames({"params", "msgs_per_s"})
+    ->ArgsProduct({{8, 128, 2048}, {1000, 10000, 50000}});
+
+/**
+ * @brief Mapping d'un mouvement d'encodeur jusqu'à la commande CC exécutée
+ *
+ * Argument : encodeurs mappés ; les mouvements tournent sur tous les
+ * encodeurs en aller-retour pour que chaque appel produise un message.
+ */
+void BM_MidiMapper_EncoderChange(benchmark::State& state) {
+    NullMidiOut midiOut;
+    CommandManager commandManager;
+    auto mapper = std::make_unique<MidiMapper>(midiOut, commandManager);
+    const uint16_t mappings = static_cast<uint16_t>(state.range(0));
+    for (uint16_t i = 0; i < mappings; ++i) {
+        mapper->setMappingFromControlDefinition(
+            ControlBuilder(static_cast<InputId>(100 + i), "Bench")
+                .asRotaryEncoder(0, 1)
+                .withMidiCC(static_cast<uint8_t>(i & 0x7F), static_cast<uint8_t>((i >> 7) & 0x0F))
+                .build());
+    }
+
+    // Position de départ enregistrée au premier appel
+    std::vector<int32_t> positions(mappings, 0);
+    for (uint16_t i = 0; i < mappings; ++i) {
+        mapper->processEncoderChange(static_cast<EncoderId>(100 + i), 0);
+    }
+
+    uint16_t encoder = 0;
+    int32_t step = 1;
+    for (auto _ : state) {
+        int32_t& position = positions[encoder];
+        position += step;
+        mapper->processEncoderChange(static_cast<EncoderId>(100 + encoder), position);
+        if (++encoder == mappings) {
+            encoder = 0;
+            if (position >= 64 || position <= 0) {
+                step = -step;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(midiOut.sent());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MidiMapper_EncoderChange)->ArgName("mappings")->Arg(1)->Arg(16)->Arg(64)->Arg(256);
+
+}  // namespace
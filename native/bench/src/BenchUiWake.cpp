@@ -0,0 +1,110 @@
+// Latence du retour de valeur DAW -> écran : tâche UI événementielle réveillée
+// ou non par ParameterWidget::setUpdateCallback()
+//
+// Le CC reçu par la tâche MIDI est publié immédiatement sur le bus, et la vue
+// ne fait que marquer le widget (setValue()). Sans réveil, la mise à jour
+// attend le prochain passage de la tâche UI, au plus UI_MAX_SLEEP_US. Le banc
+// fait tourner TaskScheduler sur l'horloge virtuelle ; le widget est réduit
+// à son drapeau de mise à jour en attente (LVGL n'existe pas sur hôte).
+
+#include "Benchmark.h"
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+
+#include <functional>
+
+#include "config/SystemConstants.hpp"
+#include "core/TaskScheduler.hpp"
+
+namespace {
+
+constexpr uint32_t DURATION_US = 2000000;
+constexpr uint32_t LOOP_US = 20;          // Coût d'un tour de loop() hors tâches
+constexpr uint32_t UI_RUNTIME_US = 300;
+constexpr uint32_t MIDI_RUNTIME_US = 60;
+constexpr uint32_t CC_PERIOD_US = 37000;  // Automation lente, non alignée sur les périodes
+
+/**
+ * @brief Drapeau de mise à jour différée de ParameterWidget
+ */
+struct PendingWidget {
+    bool pending = false;
+    uint64_t sinceUs = 0;
+    std::function<void()> onPending;
+
+    void setValue() {
+        if (pending) {
+            return;
+        }
+        pending = true;
+        sinceUs = host::nowMicros();
+        if (onPending) {
+            onPending();
+        }
+    }
+};
+
+/**
+ * @brief Retour de valeur DAW pendant deux secondes
+ *
+ * Argument : notify (0 = drapeau seul, 1 = réveil de la tâche UI au premier changement).
+ */
+void BM_UiFeedback_Latency(benchmark::State& state) {
+    const bool notify = state.range(0) != 0;
+    uint64_t latencyTotalUs = 0;
+    uint64_t latencyMaxUs = 0;
+    uint32_t applied = 0;
+    uint32_t uiRuns = 0;
+
+    for (auto _ : state) {
+        TaskScheduler scheduler;
+        PendingWidget widget;
+        latencyTotalUs = 0;
+        latencyMaxUs = 0;
+        applied = 0;
+        uiRuns = 0;
+
+        const TaskHandle ui = scheduler.addEventTask(
+            [&]() {
+                uiRuns++;
+                if (widget.pending) {
+                    const uint64_t latencyUs = host::nowMicros() - widget.sinceUs;
+                    latencyTotalUs += latencyUs;
+                    latencyMaxUs = latencyUs > latencyMaxUs ? latencyUs : latencyMaxUs;
+                    applied++;
+                    widget.pending = false;
+                }
+                host::advanceMicros(UI_RUNTIME_US);
+            },
+            SystemConstants::Performance::UI_MAX_SLEEP_US, 1, "ui");
+        if (notify) {
+            widget.onPending = [&scheduler, ui]() { scheduler.notify(ui); };
+        }
+
+        uint64_t nextCcUs = host::nowMicros() + CC_PERIOD_US;
+        scheduler.addTask(
+            [&]() {
+                if (host::nowMicros() >= nextCcUs) {
+                    widget.setValue();
+                    nextCcUs += CC_PERIOD_US;
+                }
+                host::advanceMicros(MIDI_RUNTIME_US);
+            },
+            SystemConstants::Performance::MIDI_TIME_INTERVAL, 0, "midi");
+
+        const uint64_t endUs = host::nowMicros() + DURATION_US;
+        while (host::nowMicros() < endUs) {
+            scheduler.update();
+            host::advanceMicros(LOOP_US);
+        }
+        benchmark::DoNotOptimize(latencyTotalUs);
+    }
+
+    state.counters["latency_avg_us"] = applied ? static_cast<double>(latencyTotalUs) / applied : 0;
+    state.counters["latency_max_us"] = static_cast<double>(latencyMaxUs);
+    state.counters["ui_runs_per_s"] = uiRuns * 1e6 / DURATION_US;
+}
+BENCHMARK(BM_UiFeedback_Latency)->ArgName("notify")->Arg(0)->Arg(1);
+
+}  // namespace
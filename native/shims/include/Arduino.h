@@ -0,0 +1,132 @@
+#pragma once
+
+// Substitut hôte du core Teensy : seules les API utilisées par le firmware
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "HostRuntime.h"
+#include "WString.h"
+#include "avr/pgmspace.h"
+#include "usb_midi.h"  // USB_MIDI_SERIAL : usbMIDI est exposé par le core
+
+#define ARDUINO 10813
+
+// Attributs de placement mémoire : sans effet sur l'hôte
+#define DMAMEM
+#define FLASHMEM
+#define FASTRUN
+#define EXTMEM
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define INPUT_PULLDOWN 3
+#define OUTPUT_OPENDRAIN 4
+#define INPUT_DISABLE 5
+
+#define CHANGE 4
+#define FALLING 2
+#define RISING 3
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+uint8_t digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+
+// Pas d'interruptions sur l'hôte : les sections critiques sont vides
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+#ifdef __cplusplus
+template <class A, class B>
+constexpr auto min(A a, B b) -> decltype(a < b ? a : b) {
+    return (b < a) ? b : a;
+}
+
+template <class A, class B>
+constexpr auto max(A a, B b) -> decltype(a < b ? a : b) {
+    return (a < b) ? b : a;
+}
+
+template <class T, class L, class H>
+constexpr T constrain(T x, L low, H high) {
+    return (x < low) ? low : ((x > high) ? high : x);
+}
+#endif
+
+/**
+ * @brief Sortie texte façon Arduino Print
+ */
+class Print {
+public:
+    virtual ~Print() = default;
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str) { return str ? write(reinterpret_cast<const uint8_t*>(str), strlen(str)) : 0; }
+
+    size_t print(const char* s) { return write(s); }
+    size_t print(const String& s) { return write(reinterpret_cast<const uint8_t*>(s.c_str()), s.length()); }
+    size_t print(const __FlashStringHelper* s) { return print(reinterpret_cast<const char*>(s)); }
+    size_t print(char c) { return write(static_cast<uint8_t>(c)); }
+    size_t print(unsigned char n, int base = DEC) { return printNumber(n, base); }
+    size_t print(int n, int base = DEC) { return printSigned(n, base); }
+    size_t print(unsigned int n, int base = DEC) { return printNumber(n, base); }
+    size_t print(long n, int base = DEC) { return printSigned(n, base); }
+    size_t print(unsigned long n, int base = DEC) { return printNumber(n, base); }
+    size_t print(long long n, int base = DEC) { return printSigned(n, base); }
+    size_t print(unsigned long long n, int base = DEC) { return printNumber(n, base); }
+    size_t print(double n, int digits = 2);
+    size_t print(bool b) { return printNumber(b ? 1 : 0, DEC); }
+
+    template <class T>
+    size_t println(const T& value) { return print(value) + println(); }
+    template <class T>
+    size_t println(const T& value, int format) { return print(value, format) + println(); }
+    size_t println() { return write("\r\n"); }
+
+    int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+    size_t printNumber(unsigned long long n, int base);
+    size_t printSigned(long long n, int base);
+};
+
+/**
+ * @brief Port série USB : écrit sur stdout (désactivable par host::setSerialEcho)
+ */
+class HostSerial : public Print {
+public:
+    void begin(uint32_t baud) { (void)baud; }
+    void end() {}
+    explicit operator bool() const { return true; }
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    void flush();
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+};
+
+extern HostSerial Serial;
+
+// Points d'entrée du sketch
+void setup();
+void loop();
@@ -0,0 +1,74 @@
+#pragma once
+
+// Substitut hôte de Bounce2 : même algorithme d'anti-rebond (stable pendant
+// interval ms) sur digitalRead() et l'horloge virtuelle
+
+#include <Arduino.h>
+
+class Debouncer {
+public:
+    virtual ~Debouncer() = default;
+
+    void interval(uint16_t intervalMs) { interval_ms_ = intervalMs; }
+
+    void begin() {
+        state_ = readCurrentState();
+        unstable_ = state_;
+        previous_millis_ = millis();
+    }
+
+    bool update() {
+        changed_ = false;
+        const bool current = readCurrentState();
+        if (current != unstable_) {
+            previous_millis_ = millis();
+            unstable_ = current;
+        } else if (millis() - previous_millis_ >= interval_ms_ && current != state_) {
+            state_ = current;
+            changed_ = true;
+        }
+        return changed_;
+    }
+
+    bool read() const { return state_; }
+    bool changed() const { return changed_; }
+    bool fell() const { return changed_ && !state_; }
+    bool rose() const { return changed_ && state_; }
+
+protected:
+    virtual bool readCurrentState() = 0;
+
+private:
+    uint32_t previous_millis_ = 0;
+    uint16_t interval_ms_ = 10;
+    bool state_ = false;
+    bool unstable_ = false;
+    bool changed_ = false;
+};
+
+class Bounce : public Debouncer {
+public:
+    Bounce() = default;
+
+    void attach(int pin, int mode) {
+        pinMode(static_cast<uint8_t>(pin), static_cast<uint8_t>(mode));
+        attach(pin);
+    }
+
+    void attach(int pin) {
+        pin_ = pin;
+        begin();
+    }
+
+protected:
+    bool readCurrentState() override {
+        return pin_ >= 0 && digitalRead(static_cast<uint8_t>(pin_));
+    }
+
+private:
+    int pin_ = -1;
+};
+
+namespace Bounce2 {
+using Button = Bounce;
+}
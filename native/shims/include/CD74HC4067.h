@@ -0,0 +1,20 @@
+#pragma once
+
+// Substitut hôte de CD74HC4067 : les lignes de sélection sont des pins
+// simulées, le canal lu est résolu par digitalRead() (voir host::setMuxInput)
+
+#include <Arduino.h>
+
+class CD74HC4067 {
+public:
+    CD74HC4067(uint8_t s0, uint8_t s1, uint8_t s2, uint8_t s3);
+
+    void channel(uint8_t channel) {
+        for (uint8_t bit = 0; bit < 4; ++bit) {
+            digitalWrite(select_[bit], (channel >> bit) & 0x01);
+        }
+    }
+
+private:
+    uint8_t select_[4];
+};
@@ -0,0 +1,31 @@
+#pragma once
+
+// Substitut hôte de la bibliothèque Encoder (PJRC) : la position est pilotée
+// par host::turnEncoder(pinA, counts)
+
+#include <cstdint>
+
+class Encoder {
+public:
+    Encoder(uint8_t pinA, uint8_t pinB);
+    ~Encoder();
+
+    Encoder(const Encoder&) = delete;
+    Encoder& operator=(const Encoder&) = delete;
+
+    int32_t read() const { return position_; }
+    void write(int32_t position) { position_ = position; }
+    int32_t readAndReset() {
+        int32_t value = position_;
+        position_ = 0;
+        return value;
+    }
+
+    uint8_t pinA() const { return pinA_; }
+    void turn(int32_t counts) { position_ += counts; }
+
+private:
+    uint8_t pinA_;
+    uint8_t pinB_;
+    int32_t position_ = 0;
+};
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief Contrôle de l'environnement hôte (build native)
+ *
+ * Le temps est virtuel : micros()/millis() ne progressent que par advanceMicros()
+ * (appelé par la boucle hôte entre deux loop()) et par delay()/delayMicroseconds().
+ * Une exécution est ainsi reproductible à l'identique, quelle que soit la charge
+ * de la machine qui la fait tourner.
+ *
+ * Les entrées (pins, encodeurs, multiplexeur, MIDI USB) sont pilotées par ces
+ * fonctions ; les sorties (MIDI USB, affichage) sont comptées.
+ */
+namespace host {
+
+// === HORLOGE VIRTUELLE ===
+
+uint64_t nowMicros();
+void advanceMicros(uint32_t us);
+void setMicros(uint64_t us);
+
+// === GPIO ===
+
+/**
+ * @brief Force le niveau lu sur une pin (prioritaire sur le pull-up)
+ */
+void setPin(uint8_t pin, bool level);
+
+/**
+ * @brief Niveau écrit par le firmware sur une pin en sortie
+ */
+bool getPin(uint8_t pin);
+
+// === ENCODEURS ===
+
+/**
+ * @brief Tourne l'encodeur câblé sur pinA de `counts` fronts de quadrature
+ */
+void turnEncoder(uint8_t pinA, int32_t counts);
+
+// === MULTIPLEXEUR ===
+
+/**
+ * @brief Niveau d'un canal du multiplexeur, lu sur sa pin de signal
+ *
+ * Le canal sélectionné est celui des lignes S0-S3 écrites par le firmware.
+ */
+void setMuxInput(uint8_t signalPin, uint8_t channel, bool level);
+
+// === MIDI USB ===
+
+/**
+ * @brief Ajoute un message à la file de réception usbMIDI
+ * @param type Type Teensy (0x80 NoteOff, 0x90 NoteOn, 0xB0 ControlChange...)
+ * @param channel Canal 1-16
+ */
+bool injectMidi(uint8_t type, uint8_t channel, uint8_t data1, uint8_t data2);
+
+struct MidiOutStats {
+    uint32_t messages = 0;
+    uint32_t sysex = 0;
+    uint32_t flushes = 0;
+    uint32_t bytes = 0;           ///< Octets MIDI émis
+    uint32_t hash = 2166136261u;  ///< FNV-1a du flux d'octets émis
+    uint8_t last_type = 0;
+    uint8_t last_channel = 0;
+    uint8_t last_data1 = 0;
+    uint8_t last_data2 = 0;
+};
+
+const MidiOutStats& midiOutStats();
+
+/**
+ * @brief Copie le flux MIDI émis : octets bruts et/ou journal texte horodaté
+ * ("µs status data1 data2", SysEx en hexadécimal). nullptr pour désactiver.
+ */
+void setMidiOutCapture(FILE* bytes, FILE* log);
+
+// === AFFICHAGE ===
+
+struct DisplayStats {
+    uint32_t frames = 0;        ///< update() complets
+    uint32_t regions = 0;       ///< updateRegion()
+    uint64_t pixels = 0;        ///< Pixels transmis
+};
+
+const DisplayStats& displayStats();
+
+// === SÉRIE ===
+
+/**
+ * @brief Active/désactive la sortie de Serial sur stdout
+ */
+void setSerialEcho(bool enabled);
+
+// === SOURCE D'ENTRÉES ===
+
+/**
+ * @brief Stimuli pilotés par la boucle hôte (rejeu d'un enregistrement)
+ */
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    /// Appelé avant setup(), avant toute lecture d'entrée par le firmware
+    virtual void beforeSetup() = 0;
+
+    /// Appelé avant chaque loop() avec le temps écoulé depuis le début du rejeu
+    virtual void beforeLoop(uint64_t elapsedUs) = 0;
+
+    virtual bool finished() const = 0;
+    virtual uint32_t eventsFed() const = 0;
+};
+
+/**
+ * @brief Crée la source de rejeu d'un fichier d'enregistrement
+ * (défini côté firmware : src/tools/InputReplay.cpp)
+ * @return nullptr si le fichier est illisible ou invalide
+ */
+InputSource* createReplaySource(const char* path);
+
+}  // namespace host
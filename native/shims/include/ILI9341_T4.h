@@ -0,0 +1,57 @@
+#pragma once
+
+// Substitut hôte d'ILI9341_T4 : pas de SPI ni de DMA, les transferts sont
+// instantanés et comptés dans host::displayStats()
+
+#include <cstdint>
+
+namespace ILI9341_T4 {
+
+class DiffBuff {
+public:
+    DiffBuff(uint8_t* buffer, uint32_t size) {
+        (void)buffer;
+        (void)size;
+    }
+};
+
+class ILI9341Driver {
+public:
+    ILI9341Driver(uint8_t cs, uint8_t dc, uint8_t sclk, uint8_t mosi, uint8_t miso,
+                  uint8_t rst = 255, uint8_t touch_cs = 255, uint8_t touch_irq = 255) {
+        (void)cs; (void)dc; (void)sclk; (void)mosi; (void)miso; (void)rst; (void)touch_cs; (void)touch_irq;
+    }
+
+    bool begin(uint32_t spi_clock = 30000000, uint32_t spi_clock_read = 4000000) {
+        (void)spi_clock;
+        (void)spi_clock_read;
+        return true;
+    }
+
+    void setRotation(uint8_t rotation) { rotation_ = rotation; }
+    void setFramebuffer(uint16_t* fb1, uint16_t* fb2 = nullptr) {
+        (void)fb2;
+        framebuffer_ = fb1;
+    }
+    void setDiffBuffers(DiffBuff* diff1, DiffBuff* diff2 = nullptr) {
+        (void)diff1;
+        (void)diff2;
+    }
+    void setDiffGap(int gap) { (void)gap; }
+    void setVSyncSpacing(int spacing) { (void)spacing; }
+    void setRefreshRate(int hz) { (void)hz; }
+
+    bool asyncUpdateActive() const { return false; }
+    void waitUpdateAsyncComplete() {}
+
+    void update(const uint16_t* fb, bool force_full_redraw = false);
+    void updateRegion(bool redraw_now, const uint16_t* fb, int xmin, int xmax, int ymin, int ymax,
+                      int stride = -1);
+    void clear(uint16_t color = 0);
+
+private:
+    uint8_t rotation_ = 0;
+    uint16_t* framebuffer_ = nullptr;
+};
+
+}  // namespace ILI9341_T4
@@ -0,0 +1,87 @@
+#pragma once
+
+// Substitut hôte de la classe String Arduino, adossé à std::string
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper*>(string_literal))
+
+class String {
+public:
+    String() = default;
+    String(const char* cstr) : str_(cstr ? cstr : "") {}
+    String(const char* cstr, size_t length) : str_(cstr ? std::string(cstr, length) : std::string()) {}
+    String(const __FlashStringHelper* str) : String(reinterpret_cast<const char*>(str)) {}
+    String(const std::string& str) : str_(str) {}
+    explicit String(char c) : str_(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(long long value, unsigned char base = 10);
+    explicit String(unsigned long long value, unsigned char base = 10);
+    explicit String(float value, unsigned char decimalPlaces = 2);
+    explicit String(double value, unsigned char decimalPlaces = 2);
+
+    const char* c_str() const { return str_.c_str(); }
+    unsigned int length() const { return static_cast<unsigned int>(str_.size()); }
+    bool reserve(unsigned int size) { str_.reserve(size); return true; }
+
+    String& operator=(const char* cstr) { str_ = cstr ? cstr : ""; return *this; }
+
+    String& operator+=(const String& rhs) { str_ += rhs.str_; return *this; }
+    String& operator+=(const char* cstr) { if (cstr) str_ += cstr; return *this; }
+    String& operator+=(char c) { str_ += c; return *this; }
+    template <class T>
+    String& operator+=(T value) { return *this += String(value); }
+
+    bool concat(const String& rhs) { *this += rhs; return true; }
+    template <class T>
+    bool concat(T value) { *this += value; return true; }
+
+    friend String operator+(const String& lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+    friend String operator+(const String& lhs, const char* rhs) { String r(lhs); r += rhs; return r; }
+    friend String operator+(const char* lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+    friend String operator+(const String& lhs, char rhs) { String r(lhs); r += rhs; return r; }
+    template <class T>
+    friend String operator+(const String& lhs, T rhs) { String r(lhs); r += String(rhs); return r; }
+
+    bool equals(const String& rhs) const { return str_ == rhs.str_; }
+    bool equals(const char* cstr) const { return str_ == (cstr ? cstr : ""); }
+    bool equalsIgnoreCase(const String& rhs) const;
+    int compareTo(const String& rhs) const { return str_.compare(rhs.str_); }
+    friend bool operator==(const String& a, const String& b) { return a.str_ == b.str_; }
+    friend bool operator==(const String& a, const char* b) { return a.equals(b); }
+    friend bool operator!=(const String& a, const String& b) { return !(a == b); }
+    friend bool operator!=(const String& a, const char* b) { return !(a == b); }
+    friend bool operator<(const String& a, const String& b) { return a.str_ < b.str_; }
+
+    char charAt(unsigned int index) const { return index < str_.size() ? str_[index] : '\0'; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index) { return str_[index]; }
+
+    bool startsWith(const String& prefix) const { return str_.rfind(prefix.str_, 0) == 0; }
+    bool endsWith(const String& suffix) const;
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& s, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    String substring(unsigned int begin) const;
+    String substring(unsigned int begin, unsigned int end) const;
+
+    void toUpperCase();
+    void toLowerCase();
+    void trim();
+    void replace(const String& from, const String& to);
+    void remove(unsigned int index, unsigned int count = static_cast<unsigned int>(-1));
+
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+private:
+    std::string str_;
+};
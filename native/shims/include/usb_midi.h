@@ -0,0 +1,52 @@
+#pragma once
+
+// Substitut hôte de usbMIDI (Teensy) : file de réception alimentée par
+// host::injectMidi(), messages émis comptés dans host::midiOutStats()
+
+#include <cstdint>
+
+class usb_midi_class {
+public:
+    enum : uint8_t {
+        InvalidType = 0x00,
+        NoteOff = 0x80,
+        NoteOn = 0x90,
+        AfterTouchPoly = 0xA0,
+        ControlChange = 0xB0,
+        ProgramChange = 0xC0,
+        AfterTouchChannel = 0xD0,
+        PitchBend = 0xE0,
+        SystemExclusive = 0xF0,
+    };
+
+    void send(uint8_t type, uint8_t data1, uint8_t data2, uint8_t channel, uint8_t cable);
+    void sendNoteOn(uint8_t note, uint8_t velocity, uint8_t channel, uint8_t cable = 0) {
+        send(NoteOn, note, velocity, channel, cable);
+    }
+    void sendNoteOff(uint8_t note, uint8_t velocity, uint8_t channel, uint8_t cable = 0) {
+        send(NoteOff, note, velocity, channel, cable);
+    }
+    void sendControlChange(uint8_t control, uint8_t value, uint8_t channel, uint8_t cable = 0) {
+        send(ControlChange, control, value, channel, cable);
+    }
+    void sendSysEx(uint32_t length, const uint8_t* data, bool hasTerm = false, uint8_t cable = 0);
+    void send_now();
+
+    bool read(uint8_t channel = 0);
+    uint8_t getType() const { return type_; }
+    uint8_t getChannel() const { return channel_; }
+    uint8_t getData1() const { return data1_; }
+    uint8_t getData2() const { return data2_; }
+    uint8_t getCable() const { return 0; }
+
+private:
+    uint8_t type_ = 0;
+    uint8_t channel_ = 0;
+    uint8_t data1_ = 0;
+    uint8_t data2_ = 0;
+};
+
+extern usb_midi_class usbMIDI;
+
+// Comme le core Teensy : messages en attente de réception, sans les consommer
+uint32_t usb_midi_available();
@@ -0,0 +1,230 @@
+// Boucle hôte : setup() puis loop() sur l'horloge virtuelle
+//
+// Usage : firmware [--loops N] [--step-us US] [--encoder-pin P] [--turn-every-us US]
+//                  [--midi-every-us US] [--quiet]
+//                  [--replay FILE [--drain-us US]] [--midi-out FILE] [--midi-log FILE]
+//
+// Chaque loop() est suivi d'une avance de step-us microsecondes. Les stimuli
+// optionnels tournent un encodeur d'un cran et injectent un Control Change
+// à période fixe, pour une charge reproductible sous perf / valgrind.
+//
+// --replay rejoue un enregistrement d'entrées (voir core/utils/InputRecorder.hpp)
+// jusqu'à son dernier événement plus drain-us, sauf si --loops est donné.
+// --midi-out écrit le flux d'octets MIDI émis, --midi-log sa version horodatée :
+// deux exécutions se comparent avec cmp / diff, et le résumé donne le temps CPU
+// réel par événement rejoué.
+//
+// Les environnements bench (-DHOST_BENCHMARK) et test (-DHOST_TEST) fournissent
+// leur propre main() : native/bench/src/BenchMain.cpp, native/test/src/TestMain.cpp.
+
+#include <Arduino.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#if !defined(HOST_BENCHMARK) && !defined(HOST_TEST)
+
+namespace {
+
+struct Options {
+    uint64_t loops = 100000;
+    uint32_t stepUs = 100;
+    uint8_t encoderPin = 22;
+    uint32_t turnEveryUs = 0;
+    uint32_t midiEveryUs = 0;
+    bool quiet = false;
+    bool loopsSet = false;
+    const char* replayPath = nullptr;
+    uint64_t drainUs = 200000;
+    const char* midiOutPath = nullptr;
+    const char* midiLogPath = nullptr;
+};
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (strcmp(arg, "--quiet") == 0) {
+            options.quiet = true;
+        } else if (value && strcmp(arg, "--loops") == 0) {
+            options.loops = strtoull(value, nullptr, 10);
+            options.loopsSet = true;
+            ++i;
+        } else if (value && strcmp(arg, "--step-us") == 0) {
+            options.stepUs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+            ++i;
+        } else if (value && strcmp(arg, "--encoder-pin") == 0) {
+            options.encoderPin = static_cast<uint8_t>(strtoul(value, nullptr, 10));
+            ++i;
+        } else if (value && strcmp(arg, "--turn-every-us") == 0) {
+            options.turnEveryUs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+            ++i;
+        } else if (value && strcmp(arg, "--midi-every-us") == 0) {
+            options.midiEveryUs = static_cast<uint32_t>(strtoul(value, nullptr, 10));
+            ++i;
+        } else if (value && strcmp(arg, "--replay") == 0) {
+            options.replayPath = value;
+            ++i;
+        } else if (value && strcmp(arg, "--drain-us") == 0) {
+            options.drainUs = strtoull(value, nullptr, 10);
+            ++i;
+        } else if (value && strcmp(arg, "--midi-out") == 0) {
+            options.midiOutPath = value;
+            ++i;
+        } else if (value && strcmp(arg, "--midi-log") == 0) {
+            options.midiLogPath = value;
+            ++i;
+        } else {
+            fprintf(stderr, "Option inconnue : %s\n", arg);
+            exit(2);
+        }
+    }
+    if (options.stepUs == 0) {
+        options.stepUs = 1;
+    }
+    return options;
+}
+
+FILE* openOutput(const char* path) {
+    if (!path) {
+        return nullptr;
+    }
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        fprintf(stderr, "Impossible d'ouvrir %s\n", path);
+        exit(2);
+    }
+    return file;
+}
+
+uint32_t percentileNs(std::vector<uint32_t>& values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    const size_t index = static_cast<size_t>(p * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+    return values[index];
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+
+    std::unique_ptr<host::InputSource> replay;
+    if (options.replayPath) {
+        replay.reset(host::createReplaySource(options.replayPath));
+        if (!replay) {
+            return 2;
+        }
+        replay->beforeSetup();
+    }
+
+    FILE* midiOut = openOutput(options.midiOutPath);
+    FILE* midiLog = openOutput(options.midiLogPath);
+    host::setMidiOutCapture(midiOut, midiLog);
+
+    setup();
+
+    if (options.quiet) {
+        host::setSerialEcho(false);
+    }
+
+    const uint64_t startUs = host::nowMicros();
+    uint64_t nextTurnUs = startUs + options.turnEveryUs;
+    uint64_t nextMidiUs = startUs + options.midiEveryUs;
+    uint8_t midiValue = 0;
+    int32_t direction = 4;  // Un cran = 4 fronts de quadrature
+
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    // Rejeu : durée de chaque loop() (temps réel) et fin après le drain
+    std::vector<uint32_t> loopNs;
+    uint64_t replayEndUs = 0;
+    uint64_t loops = 0;
+
+    for (uint64_t i = 0; replay || i < options.loops; ++i) {
+        const uint64_t now = host::nowMicros();
+
+        if (replay) {
+            if (options.loopsSet && i >= options.loops) {
+                break;
+            }
+            if (replayEndUs == 0 && replay->finished()) {
+                replayEndUs = now + options.drainUs;
+            }
+            if (replayEndUs != 0 && now >= replayEndUs) {
+                break;
+            }
+            replay->beforeLoop(now - startUs);
+
+            const auto loopStart = std::chrono::steady_clock::now();
+            loop();
+            loopNs.push_back(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - loopStart).count()));
+            host::advanceMicros(options.stepUs);
+            ++loops;
+            continue;
+        }
+
+        if (options.turnEveryUs && now >= nextTurnUs) {
+            host::turnEncoder(options.encoderPin, direction);
+            nextTurnUs += options.turnEveryUs;
+            // Aller-retour sur 64 crans pour rester dans la plage des paramètres
+            if (((now - startUs) / options.turnEveryUs) % 64 == 63) {
+                direction = -direction;
+            }
+        }
+
+        if (options.midiEveryUs && now >= nextMidiUs) {
+            host::injectMidi(0xB0, 1, 1, midiValue);
+            midiValue = static_cast<uint8_t>((midiValue + 1) & 0x7F);
+            nextMidiUs += options.midiEveryUs;
+        }
+
+        loop();
+        host::advanceMicros(options.stepUs);
+        ++loops;
+    }
+
+    const double wallUs = std::chrono::duration<double, std::micro>(
+                              std::chrono::steady_clock::now() - wallStart).count();
+    const uint64_t virtualUs = host::nowMicros() - startUs;
+    const host::MidiOutStats& midi = host::midiOutStats();
+    const host::DisplayStats& display = host::displayStats();
+
+    host::setSerialEcho(true);
+    Serial.flush();
+    fprintf(stderr,
+            "[host] loops=%llu virtual=%.3f s wall=%.3f s (%.2f us wall / loop)\n"
+            "[host] midi out=%u sysex=%u flushes=%u display frames=%u regions=%u pixels=%llu\n",
+            static_cast<unsigned long long>(loops), virtualUs / 1e6, wallUs / 1e6,
+            loops ? wallUs / loops : 0.0, midi.messages, midi.sysex, midi.flushes,
+            display.frames, display.regions, static_cast<unsigned long long>(display.pixels));
+
+    if (replay) {
+        const uint32_t events = replay->eventsFed();
+        fprintf(stderr,
+                "[replay] events=%u%s midi bytes=%u fnv1a=%08x\n"
+                "[replay] wall us/event=%.2f loop() ns p50=%u p99=%u max=%u\n",
+                events, replay->finished() ? "" : " (interrompu)", midi.bytes, midi.hash,
+                events ? wallUs / events : 0.0, percentileNs(loopNs, 0.50), percentileNs(loopNs, 0.99),
+                loopNs.empty() ? 0u : *std::max_element(loopNs.begin(), loopNs.end()));
+    }
+
+    host::setMidiOutCapture(nullptr, nullptr);
+    if (midiOut) {
+        fclose(midiOut);
+    }
+    if (midiLog) {
+        fclose(midiLog);
+    }
+    return 0;
+}
+
+#endif  // !HOST_BENCHMARK && !HOST_TEST
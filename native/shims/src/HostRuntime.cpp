@@ -0,0 +1,228 @@
+#include <Arduino.h>
+#include <CD74HC4067.h>
+#include <Encoder.h>
+
+#include <array>
+#include <cstdarg>
+#include <vector>
+
+namespace {
+
+constexpr size_t PIN_COUNT = 256;
+
+struct PinState {
+    uint8_t mode = INPUT;
+    bool output = false;     ///< Niveau écrit par le firmware
+    bool forced = false;     ///< Niveau imposé par host::setPin()
+    bool level = false;
+};
+
+struct MuxState {
+    bool attached = false;
+    uint8_t signal = 0;
+    uint8_t select[4] = {};
+    uint16_t inputs = 0xFFFF;  ///< Canaux au repos : pull-up
+};
+
+uint64_t g_micros = 0;
+std::array<PinState, PIN_COUNT> g_pins{};
+std::vector<Encoder*> g_encoders;
+MuxState g_mux;
+bool g_serialEcho = true;
+
+}  // namespace
+
+// === HORLOGE VIRTUELLE ===
+
+namespace host {
+
+uint64_t nowMicros() {
+    return g_micros;
+}
+
+void advanceMicros(uint32_t us) {
+    g_micros += us;
+}
+
+void setMicros(uint64_t us) {
+    g_micros = us;
+}
+
+void setPin(uint8_t pin, bool level) {
+    g_pins[pin].forced = true;
+    g_pins[pin].level = level;
+}
+
+bool getPin(uint8_t pin) {
+    return g_pins[pin].output;
+}
+
+void turnEncoder(uint8_t pinA, int32_t counts) {
+    for (Encoder* encoder : g_encoders) {
+        if (encoder->pinA() == pinA) {
+            encoder->turn(counts);
+        }
+    }
+}
+
+void setMuxInput(uint8_t signalPin, uint8_t channel, bool level) {
+    g_mux.signal = signalPin;
+    if (level) {
+        g_mux.inputs |= static_cast<uint16_t>(1u << (channel & 0x0F));
+    } else {
+        g_mux.inputs &= static_cast<uint16_t>(~(1u << (channel & 0x0F)));
+    }
+}
+
+void setSerialEcho(bool enabled) {
+    g_serialEcho = enabled;
+}
+
+}  // namespace host
+
+uint32_t micros() {
+    return static_cast<uint32_t>(g_micros);
+}
+
+uint32_t millis() {
+    return static_cast<uint32_t>(g_micros / 1000);
+}
+
+void delay(uint32_t ms) {
+    g_micros += static_cast<uint64_t>(ms) * 1000;
+}
+
+void delayMicroseconds(uint32_t us) {
+    g_micros += us;
+}
+
+void yield() {}
+
+// === GPIO ===
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    g_pins[pin].mode = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    g_pins[pin].output = value != 0;
+}
+
+uint8_t digitalRead(uint8_t pin) {
+    // Pin de signal du multiplexeur : canal désigné par les lignes S0-S3
+    if (g_mux.attached && pin == g_mux.signal) {
+        uint8_t channel = 0;
+        for (uint8_t bit = 0; bit < 4; ++bit) {
+            channel |= static_cast<uint8_t>(g_pins[g_mux.select[bit]].output << bit);
+        }
+        return (g_mux.inputs >> channel) & 0x01;
+    }
+
+    const PinState& state = g_pins[pin];
+    if (state.forced) {
+        return state.level;
+    }
+    if (state.mode == OUTPUT) {
+        return state.output;
+    }
+    return state.mode == INPUT_PULLUP ? HIGH : LOW;
+}
+
+int analogRead(uint8_t pin) {
+    (void)pin;
+    return 0;
+}
+
+// === ENCODEURS / MULTIPLEXEUR ===
+
+Encoder::Encoder(uint8_t pinA, uint8_t pinB) : pinA_(pinA), pinB_(pinB) {
+    g_encoders.push_back(this);
+}
+
+Encoder::~Encoder() {
+    for (size_t i = 0; i < g_encoders.size(); ++i) {
+        if (g_encoders[i] == this) {
+            g_encoders.erase(g_encoders.begin() + static_cast<std::ptrdiff_t>(i));
+            break;
+        }
+    }
+}
+
+CD74HC4067::CD74HC4067(uint8_t s0, uint8_t s1, uint8_t s2, uint8_t s3) : select_{s0, s1, s2, s3} {
+    for (uint8_t bit = 0; bit < 4; ++bit) {
+        pinMode(select_[bit], OUTPUT);
+        digitalWrite(select_[bit], LOW);
+        g_mux.select[bit] = select_[bit];
+    }
+    g_mux.attached = true;
+}
+
+// === PRINT / SERIAL ===
+
+HostSerial Serial;
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t written = 0;
+    while (size--) {
+        written += write(*buffer++);
+    }
+    return written;
+}
+
+size_t Print::printNumber(unsigned long long n, int base) {
+    if (base < 2) {
+        base = 10;
+    }
+    char buffer[8 * sizeof(n) + 1];
+    char* str = &buffer[sizeof(buffer) - 1];
+    *str = '\0';
+    do {
+        const unsigned digit = static_cast<unsigned>(n % base);
+        *--str = static_cast<char>(digit < 10 ? '0' + digit : 'A' + digit - 10);
+        n /= base;
+    } while (n);
+    return write(str);
+}
+
+size_t Print::printSigned(long long n, int base) {
+    if (base == DEC && n < 0) {
+        return print('-') + printNumber(static_cast<unsigned long long>(-(n + 1)) + 1, base);
+    }
+    return printNumber(static_cast<unsigned long long>(n), base);
+}
+
+size_t Print::print(double n, int digits) {
+    char buffer[64];
+    const int length = snprintf(buffer, sizeof(buffer), "%.*f", digits, n);
+    return length > 0 ? write(buffer) : 0;
+}
+
+int Print::printf(const char* format, ...) {
+    char buffer[512];
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length > 0) {
+        write(buffer);
+    }
+    return length;
+}
+
+size_t HostSerial::write(uint8_t c) {
+    if (g_serialEcho) {
+        fputc(c, stdout);
+    }
+    return 1;
+}
+
+size_t HostSerial::write(const uint8_t* buffer, size_t size) {
+    if (g_serialEcho) {
+        fwrite(buffer, 1, size, stdout);
+    }
+    return size;
+}
+
+void HostSerial::flush() {
+    fflush(stdout);
+}
@@ -0,0 +1,44 @@
+#include <ILI9341_T4.h>
+
+#include <Arduino.h>
+
+namespace {
+
+host::DisplayStats g_display;
+
+}  // namespace
+
+namespace host {
+
+const DisplayStats& displayStats() {
+    return g_display;
+}
+
+}  // namespace host
+
+namespace ILI9341_T4 {
+
+void ILI9341Driver::update(const uint16_t* fb, bool force_full_redraw) {
+    (void)force_full_redraw;
+    if (fb && framebuffer_ && fb != framebuffer_) {
+        memcpy(framebuffer_, fb, 320 * 240 * sizeof(uint16_t));
+    }
+    g_display.frames++;
+    g_display.pixels += 320 * 240;
+}
+
+void ILI9341Driver::updateRegion(bool redraw_now, const uint16_t* fb, int xmin, int xmax, int ymin,
+                                 int ymax, int stride) {
+    (void)redraw_now;
+    (void)fb;
+    (void)stride;
+    g_display.regions++;
+    g_display.pixels += static_cast<uint64_t>(xmax - xmin + 1) * static_cast<uint64_t>(ymax - ymin + 1);
+}
+
+void ILI9341Driver::clear(uint16_t color) {
+    (void)color;
+    g_display.frames++;
+}
+
+}  // namespace ILI9341_T4
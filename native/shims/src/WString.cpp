@@ -0,0 +1,135 @@
+#include <WString.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+std::string toBase(unsigned long long value, unsigned char base) {
+    if (base < 2 || base > 36) {
+        base = 10;
+    }
+    std::string digits;
+    do {
+        const unsigned digit = static_cast<unsigned>(value % base);
+        digits += static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        value /= base;
+    } while (value);
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+std::string toSignedBase(long long value, unsigned char base) {
+    if (value < 0 && base == 10) {
+        return "-" + toBase(static_cast<unsigned long long>(-(value + 1)) + 1, base);
+    }
+    return toBase(static_cast<unsigned long long>(value), base);
+}
+
+std::string toDecimal(double value, unsigned char decimalPlaces) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimalPlaces, value);
+    return buffer;
+}
+
+}  // namespace
+
+String::String(unsigned char value, unsigned char base) : str_(toBase(value, base)) {}
+String::String(int value, unsigned char base) : str_(toSignedBase(value, base)) {}
+String::String(unsigned int value, unsigned char base) : str_(toBase(value, base)) {}
+String::String(long value, unsigned char base) : str_(toSignedBase(value, base)) {}
+String::String(unsigned long value, unsigned char base) : str_(toBase(value, base)) {}
+String::String(long long value, unsigned char base) : str_(toSignedBase(value, base)) {}
+String::String(unsigned long long value, unsigned char base) : str_(toBase(value, base)) {}
+String::String(float value, unsigned char decimalPlaces) : str_(toDecimal(value, decimalPlaces)) {}
+String::String(double value, unsigned char decimalPlaces) : str_(toDecimal(value, decimalPlaces)) {}
+
+bool String::equalsIgnoreCase(const String& rhs) const {
+    return str_.size() == rhs.str_.size() &&
+           std::equal(str_.begin(), str_.end(), rhs.str_.begin(), [](char a, char b) {
+               return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+           });
+}
+
+bool String::endsWith(const String& suffix) const {
+    return str_.size() >= suffix.str_.size() &&
+           str_.compare(str_.size() - suffix.str_.size(), suffix.str_.size(), suffix.str_) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    const size_t pos = str_.find(c, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::indexOf(const String& s, unsigned int from) const {
+    const size_t pos = str_.find(s.str_, from);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::lastIndexOf(char c) const {
+    const size_t pos = str_.rfind(c);
+    return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+String String::substring(unsigned int begin) const {
+    return begin < str_.size() ? String(str_.substr(begin)) : String();
+}
+
+String String::substring(unsigned int begin, unsigned int end) const {
+    if (begin > end) {
+        std::swap(begin, end);
+    }
+    if (begin >= str_.size()) {
+        return String();
+    }
+    return String(str_.substr(begin, end - begin));
+}
+
+void String::toUpperCase() {
+    for (char& c : str_) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+}
+
+void String::toLowerCase() {
+    for (char& c : str_) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+}
+
+void String::trim() {
+    const auto notSpace = [](char c) { return !std::isspace(static_cast<unsigned char>(c)); };
+    str_.erase(str_.begin(), std::find_if(str_.begin(), str_.end(), notSpace));
+    str_.erase(std::find_if(str_.rbegin(), str_.rend(), notSpace).base(), str_.end());
+}
+
+void String::replace(const String& from, const String& to) {
+    if (from.str_.empty()) {
+        return;
+    }
+    size_t pos = 0;
+    while ((pos = str_.find(from.str_, pos)) != std::string::npos) {
+        str_.replace(pos, from.str_.size(), to.str_);
+        pos += to.str_.size();
+    }
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index < str_.size()) {
+        str_.erase(index, count);
+    }
+}
+
+long String::toInt() const {
+    return std::strtol(str_.c_str(), nullptr, 10);
+}
+
+float String::toFloat() const {
+    return std::strtof(str_.c_str(), nullptr);
+}
+
+double String::toDouble() const {
+    return std::strtod(str_.c_str(), nullptr);
+}
@@ -0,0 +1,121 @@
+#include <usb_midi.h>
+
+#include <Arduino.h>
+
+#include <deque>
+
+namespace {
+
+struct MidiIn {
+    uint8_t type;
+    uint8_t channel;
+    uint8_t data1;
+    uint8_t data2;
+};
+
+constexpr size_t MIDI_IN_CAPACITY = 1024;  // Ordre de grandeur du tampon USB
+
+std::deque<MidiIn> g_midiIn;
+host::MidiOutStats g_midiOut;
+FILE* g_captureBytes = nullptr;
+FILE* g_captureLog = nullptr;
+
+void emitBytes(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        g_midiOut.hash = (g_midiOut.hash ^ data[i]) * 16777619u;
+    }
+    g_midiOut.bytes += static_cast<uint32_t>(length);
+    if (g_captureBytes) {
+        fwrite(data, 1, length, g_captureBytes);
+    }
+}
+
+}  // namespace
+
+usb_midi_class usbMIDI;
+
+uint32_t usb_midi_available() {
+    return static_cast<uint32_t>(g_midiIn.size());
+}
+
+namespace host {
+
+bool injectMidi(uint8_t type, uint8_t channel, uint8_t data1, uint8_t data2) {
+    if (g_midiIn.size() >= MIDI_IN_CAPACITY) {
+        return false;
+    }
+    g_midiIn.push_back({type, channel, data1, data2});
+    return true;
+}
+
+const MidiOutStats& midiOutStats() {
+    return g_midiOut;
+}
+
+void setMidiOutCapture(FILE* bytes, FILE* log) {
+    g_captureBytes = bytes;
+    g_captureLog = log;
+}
+
+}  // namespace host
+
+void usb_midi_class::send(uint8_t type, uint8_t data1, uint8_t data2, uint8_t channel, uint8_t cable) {
+    (void)cable;
+    g_midiOut.messages++;
+    g_midiOut.last_type = type;
+    g_midiOut.last_channel = channel;
+    g_midiOut.last_data1 = data1;
+    g_midiOut.last_data2 = data2;
+
+    // Program Change et Channel Pressure n'ont qu'un octet de données
+    const uint8_t message[3] = {static_cast<uint8_t>(type | ((channel - 1) & 0x0F)), data1, data2};
+    const size_t length = (type == ProgramChange || type == AfterTouchChannel) ? 2 : 3;
+    emitBytes(message, length);
+    if (g_captureLog) {
+        fprintf(g_captureLog, "%llu %02x %02x %02x\n",
+                static_cast<unsigned long long>(host::nowMicros()), message[0], data1, data2);
+    }
+}
+
+void usb_midi_class::sendSysEx(uint32_t length, const uint8_t* data, bool hasTerm, uint8_t cable) {
+    (void)cable;
+    g_midiOut.sysex++;
+
+    // Sans terminaison fournie, usbMIDI encadre le message par F0 ... F7
+    static constexpr uint8_t START = 0xF0;
+    static constexpr uint8_t END = 0xF7;
+    if (!hasTerm) {
+        emitBytes(&START, 1);
+    }
+    emitBytes(data, length);
+    if (!hasTerm) {
+        emitBytes(&END, 1);
+    }
+    if (g_captureLog) {
+        fprintf(g_captureLog, "%llu sysex", static_cast<unsigned long long>(host::nowMicros()));
+        for (uint32_t i = 0; i < length; ++i) {
+            fprintf(g_captureLog, " %02x", data[i]);
+        }
+        fprintf(g_captureLog, "\n");
+    }
+}
+
+void usb_midi_class::send_now() {
+    g_midiOut.flushes++;
+}
+
+bool usb_midi_class::read(uint8_t channel) {
+    while (!g_midiIn.empty()) {
+        const MidiIn message = g_midiIn.front();
+        g_midiIn.pop_front();
+        if (channel != 0 && message.channel != channel) {
+            continue;
+        }
+        type_ = message.type;
+        channel_ = message.channel;
+        data1_ = message.data1;
+        data2_ = message.data2;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+// Port MIDI factice : enregistre le flux d'octets émis, dans l'ordre
+//
+// Les méthodes 14 bits / NRPN ne sont pas surchargées : les implémentations
+// par défaut de MidiOutputPort les décomposent en CC, comme sur le port USB.
+
+#include <cstdint>
+#include <vector>
+
+#include "core/ports/output/MidiOutputPort.hpp"
+
+struct MidiBytes {
+    uint8_t status;
+    uint8_t data1;
+    uint8_t data2;
+
+    bool operator==(const MidiBytes& other) const {
+        return status == other.status && data1 == other.data1 && data2 == other.data2;
+    }
+};
+
+class FakeMidiOut : public MidiOutputPort {
+public:
+    void sendControlChange(MidiChannel ch, MidiCC cc, uint8_t value) override {
+        push(0xB0 | (ch & 0x0F), cc, value);
+    }
+    void sendNoteOn(MidiChannel ch, MidiNote note, uint8_t velocity) override {
+        push(0x90 | (ch & 0x0F), note, velocity);
+    }
+    void sendNoteOff(MidiChannel ch, MidiNote note, uint8_t velocity) override {
+        push(0x80 | (ch & 0x0F), note, velocity);
+    }
+    void sendProgramChange(MidiChannel ch, uint8_t program) override {
+        push(0xC0 | (ch & 0x0F), program, 0);
+    }
+    void sendPitchBend(MidiChannel ch, uint16_t value) override {
+        push(0xE0 | (ch & 0x0F), value & 0x7F, (value >> 7) & 0x7F);
+    }
+    void sendChannelPressure(MidiChannel ch, uint8_t pressure) override {
+        push(0xD0 | (ch & 0x0F), pressure, 0);
+    }
+    void sendSysEx(const uint8_t*, uint16_t) override {
+        push(0xF0, 0, 0);
+    }
+
+    /**
+     * @brief Compte les CC émis pour un contrôleur donné
+     */
+    size_t countCc(MidiChannel ch, MidiCC cc) const {
+        size_t count = 0;
+        for (const MidiBytes& message : messages) {
+            if (message.status == (0xB0 | (ch & 0x0F)) && message.data1 == cc) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    std::vector<MidiBytes> messages;
+
+private:
+    void push(uint8_t status, uint8_t data1, uint8_t data2) {
+        messages.push_back({status, data1, data2});
+    }
+};
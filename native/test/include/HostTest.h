@@ -0,0 +1,143 @@
+// Tests hôte au format GoogleTest (sans dépendance réseau)
+//
+// Sous-ensemble de l'API de googletest : un test écrit ici se compile tel
+// quel contre la bibliothèque d'origine. Même démarche que native/bench pour
+// Google Benchmark.
+//
+//     TEST(MidiOutputCoalescer, KeepsLastValue) {
+//         FakeMidiOut out;
+//         ...
+//         EXPECT_EQ(out.messages.size(), 1u);
+//     }
+//
+// Les tests tournent sur l'horloge virtuelle de native/shims (host::setMicros).
+// Code de retour du programme : 0 si tous les tests passent, 1 sinon.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace testing {
+
+/**
+ * @brief Base des fixtures (TEST_F)
+ */
+class Test {
+public:
+    virtual ~Test() = default;
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+    virtual void TestBody() = 0;
+};
+
+using Factory = Test* (*)();
+
+namespace internal {
+
+/**
+ * @brief Enregistre un test (utilisé par les macros TEST / TEST_F)
+ */
+bool RegisterTest(const char* suite, const char* name, Factory factory);
+
+/**
+ * @brief Signale un échec d'assertion pour le test en cours
+ */
+void ReportFailure(const char* file, int line, const std::string& message);
+
+template <typename T>
+std::string PrintValue(const T& value) {
+    using U = std::decay_t<T>;
+    if constexpr (std::is_same_v<U, bool>) {
+        return value ? "true" : "false";
+    } else if constexpr (std::is_enum_v<U>) {
+        return std::to_string(static_cast<long long>(value));
+    } else if constexpr (std::is_integral_v<U>) {
+        // Les uint8_t (valeurs MIDI) s'affichent en nombre, pas en caractère
+        return std::is_signed_v<U> ? std::to_string(static_cast<long long>(value))
+                                   : std::to_string(static_cast<unsigned long long>(value));
+    } else if constexpr (std::is_floating_point_v<U>) {
+        return std::to_string(value);
+    } else if constexpr (std::is_convertible_v<const U&, std::string>) {
+        return "\"" + std::string(value) + "\"";
+    } else if constexpr (std::is_pointer_v<U>) {
+        return value ? "pointeur" : "nullptr";
+    } else {
+        return "<valeur>";
+    }
+}
+
+template <typename A, typename B>
+bool Compare(const char* file, int line, bool ok, const char* expression, const A& a, const B& b) {
+    if (!ok) {
+        ReportFailure(file, line,
+                      std::string(expression) + "\n  gauche : " + PrintValue(a) + "\n  droite : " +
+                          PrintValue(b));
+    }
+    return ok;
+}
+
+inline bool Check(const char* file, int line, bool ok, const char* expression) {
+    if (!ok) {
+        ReportFailure(file, line, std::string("attendu : ") + expression);
+    }
+    return ok;
+}
+
+}  // namespace internal
+
+void InitGoogleTest(int* argc, char** argv);
+
+}  // namespace testing
+
+int RUN_ALL_TESTS();
+
+#define HOST_TEST_CLASS(suite, name) suite##_##name##_Test
+
+#define HOST_TEST_DEFINE(suite, name, base)                                                        \
+    class HOST_TEST_CLASS(suite, name) : public base {                                             \
+    public:                                                                                        \
+        void TestBody() override;                                                                  \
+    };                                                                                             \
+    [[maybe_unused]] static const bool suite##_##name##_registered = ::testing::internal::RegisterTest( \
+        #suite, #name, []() -> ::testing::Test* { return new HOST_TEST_CLASS(suite, name)(); });   \
+    void HOST_TEST_CLASS(suite, name)::TestBody()
+
+#define TEST(suite, name) HOST_TEST_DEFINE(suite, name, ::testing::Test)
+#define TEST_F(fixture, name) HOST_TEST_DEFINE(fixture, name, fixture)
+
+#define HOST_TEST_COMPARE(a, b, op, onFailure)                                                     \
+    do {                                                                                           \
+        const auto& hostTestA_ = (a);                                                              \
+        const auto& hostTestB_ = (b);                                                              \
+        if (!::testing::internal::Compare(__FILE__, __LINE__, hostTestA_ op hostTestB_,            \
+                                          #a " " #op " " #b, hostTestA_, hostTestB_)) {            \
+            onFailure;                                                                             \
+        }                                                                                          \
+    } while (0)
+
+#define HOST_TEST_CHECK(condition, text, onFailure)                                                \
+    do {                                                                                           \
+        if (!::testing::internal::Check(__FILE__, __LINE__, static_cast<bool>(condition), text)) { \
+            onFailure;                                                                             \
+        }                                                                                          \
+    } while (0)
+
+#define EXPECT_EQ(a, b) HOST_TEST_COMPARE(a, b, ==, (void)0)
+#define EXPECT_NE(a, b) HOST_TEST_COMPARE(a, b, !=, (void)0)
+#define EXPECT_LT(a, b) HOST_TEST_COMPARE(a, b, <, (void)0)
+#define EXPECT_LE(a, b) HOST_TEST_COMPARE(a, b, <=, (void)0)
+#define EXPECT_GT(a, b) HOST_TEST_COMPARE(a, b, >, (void)0)
+#define EXPECT_GE(a, b) HOST_TEST_COMPARE(a, b, >=, (void)0)
+#define EXPECT_TRUE(condition) HOST_TEST_CHECK(condition, #condition, (void)0)
+#define EXPECT_FALSE(condition) HOST_TEST_CHECK(!(condition), "!(" #condition ")", (void)0)
+
+#define ASSERT_EQ(a, b) HOST_TEST_COMPARE(a, b, ==, return)
+#define ASSERT_NE(a, b) HOST_TEST_COMPARE(a, b, !=, return)
+#define ASSERT_LT(a, b) HOST_TEST_COMPARE(a, b, <, return)
+#define ASSERT_LE(a, b) HOST_TEST_COMPARE(a, b, <=, return)
+#define ASSERT_GT(a, b) HOST_TEST_COMPARE(a, b, >, return)
+#define ASSERT_GE(a, b) HOST_TEST_COMPARE(a, b, >=, return)
+#define ASSERT_TRUE(condition) HOST_TEST_CHECK(condition, #condition, return)
+#define ASSERT_FALSE(condition) HOST_TEST_CHECK(!(condition), "!(" #condition ")", return)
@@ -0,0 +1,147 @@
+// Anti-rebond bit-parallèle : vecteurs de rebonds par seuil, comparaison à un
+// compteur scalaire par bouton, et limite de 64 boutons rejetée à la configuration
+
+#include "HostTest.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "adapters/secondary/hardware/input/buttons/VerticalCounterDebouncer.hpp"
+#include "config/SystemConstants.hpp"
+#include "config/unified/ControlBuilder.hpp"
+#include "config/unified/UnifiedConfiguration.hpp"
+
+namespace {
+
+using Mask = VerticalCounterDebouncer::Mask;
+
+struct BounceVector {
+    uint8_t threshold;
+    const char* samples;         // '1' = actif, un caractère par échantillon
+    std::vector<int> changes;    // Numéros d'échantillon (depuis 1) des bascules
+};
+
+/**
+ * @brief Rejoue un vecteur sur le bit `index`, les autres bits restant inactifs
+ */
+std::vector<int> replay(const BounceVector& vector, size_t index) {
+    VerticalCounterDebouncer debouncer;
+    EXPECT_TRUE(debouncer.setThreshold(index, vector.threshold));
+    debouncer.reset(0);
+
+    std::vector<int> changes;
+    const Mask bit = Mask{1} << index;
+    for (int i = 0; vector.samples[i] != '\0'; ++i) {
+        const Mask raw = vector.samples[i] == '1' ? bit : 0;
+        const Mask changed = debouncer.update(raw);
+        EXPECT_EQ(changed & ~bit, 0u);
+        if (changed & bit) {
+            changes.push_back(i + 1);
+        }
+    }
+    return changes;
+}
+
+/**
+ * @brief Référence scalaire : un compteur par bouton, remis à zéro sur l'état stable
+ */
+struct ScalarDebouncer {
+    uint8_t threshold = 1;
+    uint8_t count = 0;
+    bool state = false;
+
+    bool update(bool raw) {
+        if (raw == state) {
+            count = 0;
+            return false;
+        }
+        if (++count < threshold) {
+            return false;
+        }
+        state = raw;
+        count = 0;
+        return true;
+    }
+};
+
+TEST(ButtonDebounce, BounceVectors) {
+    const BounceVector vectors[] = {
+        {4, "1111", {4}},
+        {4, "1101111", {7}},                  // Rebond à l'appui : le compte repart
+        {4, "111111110000", {4, 12}},         // Appui puis relâchement nets
+        {4, "11110100000", {4, 10}},          // Rebond au relâchement
+        {2, "10101010", {}},                  // Vibration plus courte que le seuil
+        {2, "1011001100", {4, 6, 8, 10}},
+        {15, "1010111111111111110", {}},      // 14 échantillons stables : insuffisant
+        {15, "101011111111111111111", {19}},
+        {1, "1010", {1, 2, 3, 4}},            // Seuil 1 : pas de filtrage
+    };
+
+    for (const BounceVector& vector : vectors) {
+        // Même résultat quel que soit le bit, y compris le dernier plan de 64
+        for (size_t index : {size_t{0}, size_t{17}, size_t{63}}) {
+            EXPECT_EQ(replay(vector, index), vector.changes);
+        }
+    }
+}
+
+TEST(ButtonDebounce, MatchesScalarCountersOnMixedThresholds) {
+    constexpr size_t INPUTS = VerticalCounterDebouncer::MAX_INPUTS;
+    const uint8_t thresholds[] = {1, 2, 4, 5, 15, 63};
+
+    VerticalCounterDebouncer debouncer;
+    std::array<ScalarDebouncer, INPUTS> reference{};
+    for (size_t i = 0; i < INPUTS; ++i) {
+        reference[i].threshold = thresholds[i % (sizeof(thresholds) / sizeof(thresholds[0]))];
+        ASSERT_TRUE(debouncer.setThreshold(i, reference[i].threshold));
+    }
+    debouncer.reset(0);
+
+    // Entrées pseudo-aléatoires, biaisées vers de longues plages stables
+    uint32_t seed = 0x12345678;
+    Mask raw = 0;
+    for (int sample = 0; sample < 20000; ++sample) {
+        seed = seed * 1664525u + 1013904223u;
+        const size_t flipped = seed >> 26;
+        if ((seed & 0xF) < 3) {
+            raw ^= Mask{1} << flipped;
+        }
+
+        Mask expected = 0;
+        for (size_t i = 0; i < INPUTS; ++i) {
+            if (reference[i].update((raw >> i) & 1)) {
+                expected |= Mask{1} << i;
+            }
+        }
+        ASSERT_EQ(debouncer.update(raw), expected);
+    }
+}
+
+TEST(ButtonDebounce, ConfigurationRejectsMoreButtonsThanMasks) {
+    constexpr size_t MAX_BUTTONS = SystemConstants::Buttons::MAX_BUTTONS;
+
+    // Encodeurs avec bouton et boutons simples comptent tous deux
+    UnifiedConfiguration config;
+    for (size_t i = 0; i < MAX_BUTTONS / 2; ++i) {
+        auto encoder =
+            ControlBuilder(static_cast<InputId>(100 + i), "Encoder").asRotaryEncoder(0, 1).build();
+        encoder.hardware.encoderButtonPin = GpioPin{2, PinMode::PULLUP};
+        config.addControl(encoder);
+    }
+    for (size_t i = MAX_BUTTONS / 2; i < MAX_BUTTONS; ++i) {
+        config.addControl(
+            ControlBuilder(static_cast<InputId>(100 + i), "Button").asButton(2).build());
+    }
+    EXPECT_TRUE(config.validate().isSuccess());
+
+    config.addControl(ControlBuilder(static_cast<InputId>(100 + MAX_BUTTONS), "Button")
+                          .asButton(2)
+                          .build());
+    const auto result = config.validate();
+    ASSERT_FALSE(result.isSuccess());
+    const Error error = result.error().value();
+    EXPECT_EQ(error.code, ErrorCode::ConfigurationError);
+}
+
+}  // namespace
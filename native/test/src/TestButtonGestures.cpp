@@ -0,0 +1,152 @@
+// Gestes bouton sur chronologies synthétiques : appui long à l'échéance exacte,
+// double clic, accord, et action de navigation de l'appui long du bouton Menu
+
+#include "HostTest.h"
+
+#include <memory>
+#include <vector>
+
+#include "config/SystemConstants.hpp"
+#include "config/unified/ControlBuilder.hpp"
+#include "config/unified/UnifiedConfiguration.hpp"
+#include "core/controllers/InputController.hpp"
+#include "core/domain/events/core/EventBus.hpp"
+#include "core/domain/events/core/EventTypes.hpp"
+#include "core/domain/navigation/NavigationEvent.hpp"
+#include "core/use_cases/ButtonGestureRecognizer.hpp"
+
+namespace {
+
+constexpr ButtonId MENU = 51;
+constexpr ButtonId OTHER = 52;
+constexpr uint32_t MS = 1000;
+
+class ButtonGestures : public testing::Test {
+public:
+    void SetUp() override {
+        recognizer.addButton(MENU, 1000);
+        recognizer.addButton(OTHER, 0);
+        recognizer.setCallback([this](const ButtonGesture& gesture) { gestures.push_back(gesture); });
+    }
+
+    ButtonGestureRecognizer recognizer;
+    std::vector<ButtonGesture> gestures;
+};
+
+TEST_F(ButtonGestures, LongPressFiresAtExactDeadline) {
+    recognizer.onButtonEvent(MENU, true, 10 * MS);
+    recognizer.advance(1009 * MS);
+    EXPECT_TRUE(gestures.empty());
+
+    // advance() tardif : l'horodatage reste l'échéance, pas l'instant du tick
+    recognizer.advance(1030 * MS);
+    ASSERT_EQ(gestures.size(), 1u);
+    EXPECT_TRUE(gestures[0].type == ButtonGesture::Type::LongPress);
+    EXPECT_EQ(gestures[0].id, MENU);
+    EXPECT_EQ(gestures[0].timestampUs, 1010 * MS);
+
+    // Le relâchement d'un appui long n'ouvre pas de fenêtre de double clic
+    recognizer.onButtonEvent(MENU, false, 1200 * MS);
+    recognizer.onButtonEvent(MENU, true, 1300 * MS);
+    EXPECT_EQ(gestures.size(), 1u);
+}
+
+TEST_F(ButtonGestures, ReleaseBeforeDeadlineCancelsLongPress) {
+    recognizer.onButtonEvent(MENU, true, 0);
+    recognizer.onButtonEvent(MENU, false, 999 * MS);
+    recognizer.advance(3000 * MS);
+    EXPECT_TRUE(gestures.empty());
+    EXPECT_EQ(recognizer.getStats().long_presses, 0u);
+}
+
+TEST_F(ButtonGestures, DoubleClickWithinWindow) {
+    recognizer.onButtonEvent(OTHER, true, 0);
+    recognizer.onButtonEvent(OTHER, false, 80 * MS);
+    recognizer.onButtonEvent(OTHER, true, 300 * MS);  // 220 ms après le relâchement
+    ASSERT_EQ(gestures.size(), 1u);
+    EXPECT_TRUE(gestures[0].type == ButtonGesture::Type::DoubleClick);
+    EXPECT_EQ(gestures[0].timestampUs, 300 * MS);
+
+    // Second clic trop tardif : pas de double clic
+    recognizer.onButtonEvent(OTHER, false, 350 * MS);
+    recognizer.onButtonEvent(OTHER, true, 1000 * MS);
+    recognizer.onButtonEvent(OTHER, false, 1050 * MS);
+    const uint32_t windowUs = SystemConstants::Buttons::DOUBLE_CLICK_WINDOW_MS * MS;
+    recognizer.onButtonEvent(OTHER, true, 1050 * MS + windowUs + 1);
+    EXPECT_EQ(gestures.size(), 1u);
+}
+
+TEST_F(ButtonGestures, ChordCancelsLongPressOfMembers) {
+    recognizer.onButtonEvent(MENU, true, 0);
+    recognizer.onButtonEvent(OTHER, true, 50 * MS);
+    ASSERT_EQ(gestures.size(), 1u);
+    EXPECT_TRUE(gestures[0].type == ButtonGesture::Type::Chord);
+    EXPECT_EQ(gestures[0].id, OTHER);
+    EXPECT_EQ(gestures[0].chordSize, 2u);
+    EXPECT_EQ(gestures[0].chordIds[0], MENU);
+    EXPECT_EQ(gestures[0].chordIds[1], OTHER);
+
+    recognizer.advance(2000 * MS);
+    EXPECT_EQ(gestures.size(), 1u);
+}
+
+/**
+ * @brief Enregistre les actions de navigation et les appuis longs publiés
+ */
+class NavigationRecorder : public EventListener {
+public:
+    bool onEvent(const Event& event) override {
+        if (event.getType() == NavigationEventTypes::NAVIGATION_REQUESTED) {
+            actions.push_back(static_cast<const NavigationEvent&>(event).getAction());
+        } else if (event.getType() == EventTypes::ButtonLongPress) {
+            longPresses++;
+        }
+        return true;
+    }
+
+    std::vector<NavigationAction> actions;
+    int longPresses = 0;
+};
+
+TEST(ButtonGestureWiring, MenuLongPressOpensMenu) {
+    auto config = std::make_shared<UnifiedConfiguration>();
+    config->addControl(ControlBuilder(MENU, "menu_button")
+                           .asButton(muxPin(9))
+                           .withLongPress(1000, NavigationAction::MENU_ENTER)
+                           .asMenuButton()
+                           .build());
+    config->addControl(
+        ControlBuilder(OTHER, "plain_button").asButton(muxPin(10)).withLongPress(500).build());
+
+    auto bus = std::make_shared<EventBus>();
+    NavigationRecorder recorder;
+    bus->subscribeToTypes(&recorder,
+                          {NavigationEventTypes::NAVIGATION_REQUESTED, EventTypes::ButtonLongPress});
+    bus->start();
+
+    InputController controller(nullptr, config, bus);
+    ButtonGestureRecognizer recognizer;
+    recognizer.addButton(MENU, 1000);
+    recognizer.addButton(OTHER, 500);
+    recognizer.setCallback(
+        [&controller](const ButtonGesture& gesture) { controller.processButtonGesture(gesture); });
+
+    // Même séquence qu'InputManagerService : appui transmis, puis geste à l'échéance
+    controller.processButtonPress(MENU, true);
+    recognizer.onButtonEvent(MENU, true, 0);
+    recognizer.advance(1100 * MS);
+    bus->update();
+
+    EXPECT_EQ(recorder.actions,
+              (std::vector<NavigationAction>{NavigationAction::HOME, NavigationAction::MENU_ENTER}));
+    EXPECT_EQ(recorder.longPresses, 1);
+
+    // Appui long sans action configurée : publié sur le bus, aucune navigation
+    recognizer.onButtonEvent(OTHER, true, 2000 * MS);
+    recognizer.advance(2600 * MS);
+    bus->update();
+    EXPECT_EQ(recorder.actions.size(), 2u);
+    EXPECT_EQ(recorder.longPresses, 2);
+}
+
+}  // namespace
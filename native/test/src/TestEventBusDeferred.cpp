@@ -0,0 +1,91 @@
+// File différée de l'EventBus : l'ordre de publication est conservé, y compris
+// quand un événement doit être publié immédiatement (file pleine, type non différable)
+
+#include "HostTest.h"
+
+#include <vector>
+
+#include "config/SystemConstants.hpp"
+#include "core/domain/events/MidiEvents.hpp"
+#include "core/domain/events/UIEvent.hpp"
+#include "core/domain/events/core/EventBus.hpp"
+
+namespace {
+
+constexpr size_t QUEUE_SIZE = SystemConstants::Performance::DEFERRED_EVENT_QUEUE_SIZE;
+constexpr int UI_MARKER = 1000;
+
+/**
+ * @brief Enregistre la valeur des CC reçus, UI_MARKER pour une mise à jour UI
+ */
+class OrderRecorder : public EventListener {
+public:
+    bool onEvent(const Event& event) override {
+        if (event.getType() == EventTypes::MidiControlChange) {
+            order.push_back(static_cast<const MidiCCEvent&>(event).value);
+        } else if (event.getType() == UIDisplayEvents::UIParameterUpdate) {
+            order.push_back(UI_MARKER);
+        }
+        return true;
+    }
+
+    std::vector<int> order;
+};
+
+class EventBusDeferred : public testing::Test {
+public:
+    void SetUp() override {
+        bus.subscribeToTypes(&recorder,
+                             {EventTypes::MidiControlChange, UIDisplayEvents::UIParameterUpdate});
+        bus.start();
+    }
+
+    void deferCc(uint8_t value) {
+        MidiCCEvent event(0, 7, value);
+        EXPECT_TRUE(bus.publishDeferred(event));
+    }
+
+    EventBus bus;
+    OrderRecorder recorder;
+};
+
+TEST_F(EventBusDeferred, UpdateDrainsInOrder) {
+    for (uint8_t i = 0; i < 5; ++i) {
+        deferCc(i);
+    }
+    EXPECT_TRUE(recorder.order.empty());
+
+    bus.update();
+    EXPECT_EQ(recorder.order, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST_F(EventBusDeferred, OverflowFlushesQueueBeforePublishing) {
+    // RingBuffer à N cases : N - 1 événements en file au plus
+    const size_t capacity = QUEUE_SIZE - 1;
+    for (size_t i = 0; i <= capacity; ++i) {
+        deferCc(static_cast<uint8_t>(i));
+    }
+
+    ASSERT_EQ(recorder.order.size(), capacity + 1);
+    for (size_t i = 0; i < recorder.order.size(); ++i) {
+        EXPECT_EQ(recorder.order[i], static_cast<int>(i));
+    }
+    EXPECT_EQ(bus.getDeferredStats().overflows, 1u);
+    EXPECT_EQ(bus.getDeferredStats().forced_flushes, 1u);
+    EXPECT_EQ(bus.getDeferredStats().depth, 0u);
+}
+
+TEST_F(EventBusDeferred, UnsupportedTypeWaitsForQueuedEvents) {
+    deferCc(1);
+    deferCc(2);
+    UIParameterUpdateEvent uiEvent(7, 0, 3);
+    EXPECT_TRUE(bus.publishDeferred(uiEvent));
+    deferCc(4);
+
+    EXPECT_EQ(recorder.order, (std::vector<int>{1, 2, UI_MARKER}));
+    bus.update();
+    EXPECT_EQ(recorder.order, (std::vector<int>{1, 2, UI_MARKER, 4}));
+    EXPECT_EQ(bus.getDeferredStats().unsupported, 1u);
+}
+
+}  // namespace
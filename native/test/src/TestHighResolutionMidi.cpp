@@ -0,0 +1,133 @@
+// Sortie haute résolution : flux d'octets des paires 14 bits et des séquences NRPN
+
+#include "HostTest.h"
+
+#include <memory>
+
+#include "FakeMidiOut.h"
+#include "adapters/secondary/midi/MidiMapper.hpp"
+#include "adapters/secondary/midi/MidiOutputEventAdapter.hpp"
+#include "config/GlobalSettings.hpp"
+#include "config/unified/ControlBuilder.hpp"
+#include "core/domain/commands/CommandManager.hpp"
+#include "core/domain/commands/midi/SendMidiHighResCommand.hpp"
+#include "core/domain/events/core/EventBus.hpp"
+
+namespace {
+
+constexpr InputId ENCODER = 100;
+
+uint16_t decode14(const MidiBytes& msb, const MidiBytes& lsb) {
+    return static_cast<uint16_t>(msb.data2 << 7 | lsb.data2);
+}
+
+class HighResolutionMidi : public testing::Test {
+public:
+    void SetUp() override {
+        GlobalSettings::getInstance().setEncoderSensitivity(1.0f);
+    }
+
+    /**
+     * @brief Enregistre le mapping puis fixe la position de départ de l'encodeur
+     */
+    void map(const ControlDefinition& control) {
+        mapper.setMappingFromControlDefinition(control);
+        mapper.processEncoderChange(ENCODER, 0);
+        out.messages.clear();
+    }
+
+    FakeMidiOut out;
+    CommandManager commandManager;
+    MidiMapper mapper{out, commandManager};
+};
+
+TEST_F(HighResolutionMidi, Cc14SendsMsbThenLsb) {
+    map(ControlBuilder(ENCODER, "Cutoff").asRotaryEncoder(0, 1).withMidiCC14(1, 3, true, 200).build());
+
+    mapper.processEncoderChange(ENCODER, 1);
+    ASSERT_EQ(out.messages.size(), 2u);
+    EXPECT_EQ(out.messages[0].status, 0xB3);
+    EXPECT_EQ(out.messages[0].data1, 1);
+    EXPECT_EQ(out.messages[1].status, 0xB3);
+    EXPECT_EQ(out.messages[1].data1, 33);
+    EXPECT_EQ(decode14(out.messages[0], out.messages[1]), 200);
+
+    mapper.processEncoderChange(ENCODER, 2);
+    ASSERT_EQ(out.messages.size(), 4u);
+    EXPECT_EQ(decode14(out.messages[2], out.messages[3]), 400);
+}
+
+TEST_F(HighResolutionMidi, NrpnSendsNumberThenDataEntry) {
+    constexpr uint16_t PARAMETER = 0x1234;
+    map(ControlBuilder(ENCODER, "Drive").asRotaryEncoder(0, 1).withMidiNRPN(PARAMETER, 20, 2, true, 300).build());
+
+    mapper.processEncoderChange(ENCODER, 1);
+    ASSERT_EQ(out.messages.size(), 4u);
+    EXPECT_EQ(out.messages[0], (MidiBytes{0xB2, 99, PARAMETER >> 7}));
+    EXPECT_EQ(out.messages[1], (MidiBytes{0xB2, 98, PARAMETER & 0x7F}));
+    EXPECT_EQ(out.messages[2], (MidiBytes{0xB2, 6, 300 >> 7}));
+    EXPECT_EQ(out.messages[3], (MidiBytes{0xB2, 38, 300 & 0x7F}));
+}
+
+TEST_F(HighResolutionMidi, AbsoluteModeStartsFromCenter) {
+    map(ControlBuilder(ENCODER, "Pan").asRotaryEncoder(0, 1).withMidiCC14(10, 0, false, 100).build());
+
+    mapper.processEncoderChange(ENCODER, -3);
+    ASSERT_EQ(out.messages.size(), 2u);
+    EXPECT_EQ(decode14(out.messages[0], out.messages[1]), 8192 - 300);
+}
+
+TEST_F(HighResolutionMidi, Cc14AboveMsbRangeFallsBackTo7Bit) {
+    // Le LSB de CC 40 partirait sur CC 72, un contrôleur sans rapport
+    map(ControlBuilder(ENCODER, "Res").asRotaryEncoder(0, 1).withMidiCC14(40, 0, true, 200).build());
+
+    mapper.processEncoderChange(ENCODER, 1);
+    ASSERT_EQ(out.messages.size(), 1u);
+    EXPECT_EQ(out.messages[0].status, 0xB0);
+    EXPECT_EQ(out.messages[0].data1, 40);
+}
+
+TEST(SendMidiHighResCommand, UndoRestoresPreviousValue) {
+    FakeMidiOut out;
+    SendMidiHighResCommand command;
+    command.reset(out, MidiResolution::CC_14BIT, 0, 1, 9000, 4000, 5);
+
+    command.execute();
+    ASSERT_TRUE(command.undo());
+    ASSERT_EQ(out.messages.size(), 4u);
+    EXPECT_EQ(decode14(out.messages[0], out.messages[1]), 9000);
+    EXPECT_EQ(decode14(out.messages[2], out.messages[3]), 4000);
+}
+
+class CcRecorder : public EventListener {
+public:
+    bool onEvent(const Event& event) override {
+        if (event.getType() == EventTypes::MidiControlChange) {
+            events.push_back(static_cast<const MidiCCEvent&>(event));
+        }
+        return true;
+    }
+
+    std::vector<MidiCCEvent> events;
+};
+
+TEST(MidiOutputEventAdapter, PublishesNrpnUnderUiController) {
+    FakeMidiOut out;
+    auto bus = std::make_shared<EventBus>();
+    CcRecorder recorder;
+    bus->subscribe(&recorder);
+    MidiOutputEventAdapter adapter(out, bus);
+    ASSERT_TRUE(adapter.setNrpnController(2, 0x1234, 20));
+
+    adapter.sendNrpn(2, 0x1234, 9000, 7);
+    adapter.sendNrpn(2, 0x0042, 100, 7);  // NRPN sans contrôle associé : pas d'événement
+
+    EXPECT_EQ(out.messages.size(), 8u);
+    ASSERT_EQ(recorder.events.size(), 1u);
+    EXPECT_EQ(recorder.events[0].channel, 2);
+    EXPECT_EQ(recorder.events[0].controller, 20);
+    EXPECT_EQ(recorder.events[0].value, 9000 >> 7);
+    EXPECT_EQ(recorder.events[0].source, 7);
+}
+
+}  // namespace
@@ -0,0 +1,239 @@
+// Rejeu d'un enregistrement d'entrées : les niveaux des pins et les pas de
+// quadrature sont réinjectés dans le matériel simulé et repassent par le
+// timer, l'anti-rebond, les crans et l'accélération
+
+#include "HostTest.h"
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "adapters/secondary/hardware/input/TimerInputSampler.hpp"
+#include "app/services/InputManagerService.hpp"
+#include "config/unified/ControlBuilder.hpp"
+#include "config/unified/UnifiedConfiguration.hpp"
+#include "core/controllers/InputController.hpp"
+#include "core/domain/events/MidiEvents.hpp"
+#include "core/domain/events/core/EventBus.hpp"
+#include "core/utils/InputRecorder.hpp"
+#include "tools/InputReplay.hpp"
+
+namespace {
+
+constexpr ButtonId BUTTON = 40;
+constexpr uint8_t BUTTON_PIN = 30;
+constexpr uint8_t UNKNOWN_PIN = 31;      // Absente de la configuration
+constexpr EncoderId ENCODER = 7;
+constexpr uint8_t ENCODER_PIN_A = 22;
+constexpr uint16_t DEBOUNCE_MS = 6;      // 3 périodes de timer
+constexpr uint32_t PERIOD_US = 2000;
+constexpr uint32_t MS = 1000;
+
+InputRecording::Record record(uint32_t timestampUs, uint16_t id, InputRecording::Kind kind,
+                              uint8_t value) {
+    return {timestampUs, id, static_cast<uint8_t>(kind), value};
+}
+
+/**
+ * @brief Écrit un enregistrement au format de native/tools/input_capture.py
+ */
+void writeRecording(const char* path, const std::vector<InputRecording::Record>& records) {
+    InputRecording::FileHeader header{};
+    memcpy(header.magic, InputRecording::MAGIC, sizeof(header.magic));
+    header.version = InputRecording::VERSION;
+    header.record_size = sizeof(InputRecording::Record);
+    header.count = static_cast<uint32_t>(records.size());
+
+    FILE* file = fopen(path, "wb");
+    ASSERT_TRUE(file != nullptr);
+    fwrite(&header, sizeof(header), 1, file);
+    fwrite(records.data(), sizeof(InputRecording::Record), records.size(), file);
+    fclose(file);
+}
+
+/**
+ * @brief Enregistre les appuis et rotations publiés par InputController
+ */
+class InputRecorderListener : public EventListener {
+public:
+    bool onEvent(const Event& event) override {
+        if (event.getType() == EventTypes::HighPriorityButtonPress) {
+            const auto& press = static_cast<const HighPriorityButtonPressEvent&>(event);
+            presses.push_back({press.buttonId, press.pressed});
+        } else if (event.getType() == EventTypes::HighPriorityEncoderChanged) {
+            const auto& turn = static_cast<const HighPriorityEncoderChangedEvent&>(event);
+            deltas.push_back(turn.delta);
+            encoderDelta += turn.delta;
+        }
+        return true;
+    }
+
+    struct Press {
+        uint16_t id;
+        bool pressed;
+    };
+    std::vector<Press> presses;
+    std::vector<int8_t> deltas;
+    int32_t encoderDelta = 0;
+};
+
+/**
+ * @brief Service d'entrées en mode timer sur un bouton et un encodeur simulés
+ */
+class InputRig {
+public:
+    InputRig() : config_(std::make_shared<UnifiedConfiguration>()), bus_(std::make_shared<EventBus>()) {
+        config_->addControl(
+            ControlBuilder(ENCODER, "replay_encoder").asRotaryEncoder(ENCODER_PIN_A, 23).build());
+        config_->addControl(
+            ControlBuilder(BUTTON, "replay_button").asButton(BUTTON_PIN, DEBOUNCE_MS).build());
+
+        bus_->subscribeToTypes(&listener,
+                               {EventTypes::HighPriorityButtonPress, EventTypes::HighPriorityEncoderChanged});
+        bus_->start();
+
+        IInputManager::ManagerConfig managerConfig;
+        managerConfig.enableTimerSampling = true;
+        managerConfig.samplingPeriodUs = PERIOD_US;
+        service = std::make_unique<InputManagerService>(managerConfig);
+        initialized = service
+                          ->initialize(config_->getAllControls(),
+                                       std::make_shared<InputController>(nullptr, config_, bus_))
+                          .isSuccess();
+    }
+
+    /// Une période de la tâche d'entrée
+    void step() {
+        service->update();
+        bus_->update();
+        host::advanceMicros(PERIOD_US);
+    }
+
+    InputRecorderListener listener;
+    std::unique_ptr<InputManagerService> service;
+    bool initialized = false;
+
+private:
+    std::shared_ptr<UnifiedConfiguration> config_;
+    std::shared_ptr<EventBus> bus_;
+};
+
+/// Relâche le bouton simulé (pull-up) pour les tests suivants
+void releasePins() {
+    host::setPin(BUTTON_PIN, true);
+    host::setPin(UNKNOWN_PIN, true);
+}
+
+TEST(InputReplay, PortLevelsGoThroughDebounceAndDetents) {
+    const char* path = "input_replay_test.bin";
+    writeRecording(path, {
+                             record(0, BUTTON_PIN, InputRecording::Kind::PinLevel, 1),
+                             // Appui active-low avec un rebond plus court que l'anti-rebond
+                             record(10 * MS, BUTTON_PIN, InputRecording::Kind::PinLevel, 0),
+                             record(12 * MS, BUTTON_PIN, InputRecording::Kind::PinLevel, 1),
+                             record(14 * MS, BUTTON_PIN, InputRecording::Kind::PinLevel, 0),
+                             record(16 * MS, UNKNOWN_PIN, InputRecording::Kind::PinLevel, 0),
+                             // Pas de quadrature bruts : 2 crans puis 1 en sens inverse
+                             record(20 * MS, ENCODER_PIN_A, InputRecording::Kind::EncoderTurn, 8),
+                             record(40 * MS, ENCODER_PIN_A, InputRecording::Kind::EncoderTurn, 0xFC),
+                             record(60 * MS, BUTTON_PIN, InputRecording::Kind::PinLevel, 1),
+                         });
+
+    InputReplayPlayer player;
+    ASSERT_TRUE(player.load(path).isSuccess());
+    remove(path);
+    player.beforeSetup();
+
+    InputRig rig;
+    ASSERT_TRUE(rig.initialized);
+    TimerInputSampler* sampler = rig.service->getInputSampler();
+    ASSERT_TRUE(sampler != nullptr);
+
+    // Boucle hôte : événements échus, puis une période de la tâche d'entrée
+    const uint64_t startUs = host::nowMicros();
+    while (!player.finished() || host::nowMicros() - startUs < 100 * MS) {
+        player.beforeLoop(host::nowMicros() - startUs);
+        rig.step();
+    }
+    releasePins();
+
+    // Le rebond est absorbé une seule fois, par l'anti-rebond du firmware
+    EXPECT_GT(sampler->getStats().events_consumed, 0u);
+    ASSERT_EQ(rig.listener.presses.size(), 2u);
+    EXPECT_EQ(rig.listener.presses[0].id, BUTTON);
+    EXPECT_TRUE(rig.listener.presses[0].pressed);
+    EXPECT_EQ(rig.listener.presses[1].id, BUTTON);
+    EXPECT_FALSE(rig.listener.presses[1].pressed);
+
+    // Crans recalculés à partir des pas bruts (4 pas par cran, sens de la configuration)
+    ASSERT_EQ(rig.listener.deltas.size(), 2u);
+    EXPECT_EQ(rig.listener.deltas[0], -2);
+    EXPECT_EQ(rig.listener.deltas[1], 1);
+}
+
+#ifdef INPUT_RECORDER
+TEST(InputReplay, RecordedSessionReplaysIdentically) {
+    InputRecorderListener live;
+    std::vector<InputRecording::Record> records;
+    {
+        InputRig rig;
+        ASSERT_TRUE(rig.initialized);
+        InputRecorder::start();
+
+        // Session physique : appui avec rebond, rotations rapprochées
+        const uint64_t startUs = host::nowMicros();
+        for (uint32_t tick = 0; tick < 60; ++tick) {
+            const uint64_t elapsedMs = (host::nowMicros() - startUs) / MS;
+            if (elapsedMs == 10) host::setPin(BUTTON_PIN, false);
+            if (elapsedMs == 12) host::setPin(BUTTON_PIN, true);
+            if (elapsedMs == 14) host::setPin(BUTTON_PIN, false);
+            if (elapsedMs >= 20 && elapsedMs < 40) host::turnEncoder(ENCODER_PIN_A, 4);
+            if (elapsedMs == 70) host::setPin(BUTTON_PIN, true);
+            rig.step();
+        }
+        for (uint32_t tick = 0; tick < 20; ++tick) {
+            rig.step();
+        }
+
+        InputRecorder::stop();
+        records.assign(InputRecorder::records(), InputRecorder::records() + InputRecorder::size());
+        live = rig.listener;
+    }
+    releasePins();
+    ASSERT_EQ(live.presses.size(), 2u);
+    ASSERT_GT(live.deltas.size(), 0u);
+
+    const char* path = "input_replay_roundtrip.bin";
+    writeRecording(path, records);
+    InputReplayPlayer player;
+    ASSERT_TRUE(player.load(path).isSuccess());
+    remove(path);
+    player.beforeSetup();
+
+    InputRig rig;
+    ASSERT_TRUE(rig.initialized);
+    const uint64_t startUs = host::nowMicros();
+    while (!player.finished() || host::nowMicros() - startUs < 160 * MS) {
+        player.beforeLoop(host::nowMicros() - startUs);
+        rig.step();
+    }
+    releasePins();
+
+    // Mêmes fronts débouncés, mêmes crans
+    ASSERT_EQ(rig.listener.presses.size(), live.presses.size());
+    for (size_t i = 0; i < live.presses.size(); ++i) {
+        EXPECT_EQ(rig.listener.presses[i].id, live.presses[i].id);
+        EXPECT_EQ(rig.listener.presses[i].pressed, live.presses[i].pressed);
+    }
+    ASSERT_EQ(rig.listener.deltas.size(), live.deltas.size());
+    for (size_t i = 0; i < live.deltas.size(); ++i) {
+        EXPECT_EQ(rig.listener.deltas[i], live.deltas[i]);
+    }
+}
+#endif  // INPUT_RECORDER
+
+}  // namespace
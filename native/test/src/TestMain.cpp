@@ -0,0 +1,167 @@
+// Lanceur des tests hôte (voir HostTest.h)
+//
+// Usage : program [--gtest_filter=MOTIF[:MOTIF...][-MOTIF[:MOTIF...]]]
+//                 [--gtest_list_tests] [--serial]
+//
+// Les motifs portent sur "Suite.Nom" avec les jokers * et ? de googletest.
+// Chaque test démarre à t = 0 sur l'horloge virtuelle ; --serial affiche les
+// traces Serial du firmware.
+
+#include "HostTest.h"
+
+#include <HostRuntime.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace testing {
+
+namespace {
+
+struct TestInfo {
+    const char* suite;
+    const char* name;
+    Factory factory;
+};
+
+struct Options {
+    std::string positive = "*";
+    std::string negative;
+    bool listOnly = false;
+    bool serial = false;
+};
+
+Options options;
+int currentFailures = 0;
+
+std::vector<TestInfo>& registry() {
+    static std::vector<TestInfo> tests;
+    return tests;
+}
+
+bool globMatch(const char* pattern, const char* text) {
+    if (*pattern == '\0') {
+        return *text == '\0';
+    }
+    if (*pattern == '*') {
+        return globMatch(pattern + 1, text) || (*text != '\0' && globMatch(pattern, text + 1));
+    }
+    return *text != '\0' && (*pattern == '?' || *pattern == *text) && globMatch(pattern + 1, text + 1);
+}
+
+bool matchesAny(const std::string& patterns, const std::string& name) {
+    size_t start = 0;
+    while (start <= patterns.size()) {
+        size_t end = patterns.find(':', start);
+        if (end == std::string::npos) {
+            end = patterns.size();
+        }
+        const std::string pattern = patterns.substr(start, end - start);
+        if (!pattern.empty() && globMatch(pattern.c_str(), name.c_str())) {
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+bool selected(const TestInfo& test) {
+    const std::string name = std::string(test.suite) + "." + test.name;
+    return matchesAny(options.positive, name) && !matchesAny(options.negative, name);
+}
+
+}  // namespace
+
+namespace internal {
+
+bool RegisterTest(const char* suite, const char* name, Factory factory) {
+    registry().push_back({suite, name, factory});
+    return true;
+}
+
+void ReportFailure(const char* file, int line, const std::string& message) {
+    fprintf(stdout, "%s:%d: échec\n%s\n", file, line, message.c_str());
+    currentFailures++;
+}
+
+}  // namespace internal
+
+void InitGoogleTest(int* argc, char** argv) {
+    for (int i = 1; i < *argc; ++i) {
+        const char* arg = argv[i];
+        if (strncmp(arg, "--gtest_filter=", 15) == 0) {
+            const std::string filter = arg + 15;
+            const size_t dash = filter.find('-');
+            options.positive = filter.substr(0, dash);
+            if (options.positive.empty()) {
+                options.positive = "*";
+            }
+            options.negative = dash == std::string::npos ? "" : filter.substr(dash + 1);
+        } else if (strcmp(arg, "--gtest_list_tests") == 0) {
+            options.listOnly = true;
+        } else if (strcmp(arg, "--serial") == 0) {
+            options.serial = true;
+        } else {
+            fprintf(stderr, "Option inconnue : %s\n", arg);
+            exit(2);
+        }
+    }
+}
+
+}  // namespace testing
+
+int RUN_ALL_TESTS() {
+    using namespace testing;
+
+    std::vector<const TestInfo*> tests;
+    for (const TestInfo& test : registry()) {
+        if (selected(test)) {
+            tests.push_back(&test);
+        }
+    }
+
+    if (options.listOnly) {
+        for (const TestInfo* test : tests) {
+            fprintf(stdout, "%s.%s\n", test->suite, test->name);
+        }
+        return 0;
+    }
+
+    host::setSerialEcho(options.serial);
+    fprintf(stdout, "[==========] %zu tests\n", tests.size());
+    std::vector<const TestInfo*> failed;
+    for (const TestInfo* test : tests) {
+        fprintf(stdout, "[ RUN      ] %s.%s\n", test->suite, test->name);
+        fflush(stdout);
+        host::setMicros(0);
+        currentFailures = 0;
+
+        std::unique_ptr<Test> instance(test->factory());
+        instance->SetUp();
+        if (currentFailures == 0) {
+            instance->TestBody();
+        }
+        instance->TearDown();
+
+        if (currentFailures == 0) {
+            fprintf(stdout, "[       OK ] %s.%s\n", test->suite, test->name);
+        } else {
+            fprintf(stdout, "[  FAILED  ] %s.%s\n", test->suite, test->name);
+            failed.push_back(test);
+        }
+    }
+
+    fprintf(stdout, "[==========] %zu tests, %zu réussis\n", tests.size(), tests.size() - failed.size());
+    for (const TestInfo* test : failed) {
+        fprintf(stdout, "[  FAILED  ] %s.%s\n", test->suite, test->name);
+    }
+    return failed.empty() ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,153 @@
+// Retours CC entrants (DAW) : un flot de 10 000 CC/s ne doit produire qu'une
+// mise à jour UI par paramètre et par trame d'affichage
+
+#include "HostTest.h"
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "config/SystemConstants.hpp"
+#include "core/domain/events/UIEvent.hpp"
+#include "core/domain/events/core/EventBus.hpp"
+#include "core/midi/HighPerformanceMidiManager.hpp"
+#include "core/midi/MidiBatchProcessor.hpp"
+
+namespace {
+
+constexpr uint32_t TICK_US = SystemConstants::Performance::MIDI_TIME_INTERVAL;
+constexpr uint32_t FRAME_MS = SystemConstants::Performance::DISPLAY_REFRESH_PERIOD_MS;
+constexpr uint32_t MESSAGES_PER_SECOND = 10000;
+constexpr uint8_t PARAMETERS = 16;
+constexpr uint8_t CHANNEL = 0;
+
+struct UiUpdate {
+    uint8_t controller;
+    uint8_t value;
+    uint32_t ms;
+};
+
+class UiRecorder : public EventListener {
+public:
+    bool onEvent(const Event& event) override {
+        if (event.getType() == UIDisplayEvents::UIParameterUpdate) {
+            const auto& update = static_cast<const UIParameterUpdateEvent&>(event);
+            updates.push_back({update.controller, update.value, millis()});
+        }
+        return true;
+    }
+
+    std::vector<UiUpdate> updates;
+};
+
+class MidiFeedbackFlood : public testing::Test {
+public:
+    void SetUp() override {
+        bus->subscribeToTypes(&recorder, {UIDisplayEvents::UIParameterUpdate});
+    }
+
+    /**
+     * @brief Envoie le flot pendant durationMs, un cycle de tâche MIDI à la fois
+     * @return Dernière valeur envoyée pour chaque contrôleur
+     */
+    std::map<uint8_t, uint8_t> flood(uint32_t durationMs) {
+        std::map<uint8_t, uint8_t> lastSent;
+        uint64_t accumulator = 0;
+        uint32_t sent = 0;
+        const uint32_t ticks = durationMs * 1000 / TICK_US;
+        for (uint32_t tick = 0; tick < ticks; ++tick) {
+            accumulator += static_cast<uint64_t>(MESSAGES_PER_SECOND) * TICK_US;
+            for (; accumulator >= 1000000; accumulator -= 1000000, ++sent) {
+                const uint8_t controller = static_cast<uint8_t>(sent % PARAMETERS);
+                const uint8_t value = static_cast<uint8_t>((sent / PARAMETERS) & 0x7F);
+                EXPECT_TRUE(manager.processMidiMessage(0xB0 | CHANNEL, controller, value));
+                lastSent[controller] = value;
+            }
+            manager.update();
+            host::advanceMicros(TICK_US);
+        }
+        EXPECT_EQ(sent, static_cast<uint64_t>(MESSAGES_PER_SECOND) * ticks * TICK_US / 1000000);
+        return lastSent;
+    }
+
+    /**
+     * @brief Laisse tourner la tâche MIDI sans trafic (vidage des batchs restants)
+     */
+    void idle(uint32_t durationMs) {
+        for (uint32_t tick = 0; tick < durationMs * 1000 / TICK_US; ++tick) {
+            manager.update();
+            host::advanceMicros(TICK_US);
+        }
+    }
+
+    std::shared_ptr<EventBus> bus = std::make_shared<EventBus>();
+    UiRecorder recorder;
+    HighPerformanceMidiManager manager{HighPerformanceMidiManager::Config(), nullptr, bus};
+};
+
+TEST_F(MidiFeedbackFlood, AtMostOneUiUpdatePerParameterPerFrame) {
+    flood(1000);
+
+    std::map<uint8_t, uint32_t> lastUpdateMs;
+    for (const UiUpdate& update : recorder.updates) {
+        auto previous = lastUpdateMs.find(update.controller);
+        if (previous != lastUpdateMs.end()) {
+            EXPECT_GE(update.ms - previous->second, FRAME_MS);
+        }
+        lastUpdateMs[update.controller] = update.ms;
+    }
+
+    // Borne globale : une mise à jour par paramètre et par trame, loin des 10 000 CC reçus
+    EXPECT_LE(recorder.updates.size(), PARAMETERS * (1000 / FRAME_MS + 1));
+    EXPECT_GT(recorder.updates.size(), 0u);
+    EXPECT_EQ(manager.getGlobalStats().ui_updates_published, recorder.updates.size());
+}
+
+TEST_F(MidiFeedbackFlood, LastValueReachesUiAfterFlood) {
+    const auto lastSent = flood(500);
+    idle(2 * FRAME_MS + TICK_US / 1000);
+
+    std::map<uint8_t, uint8_t> lastShown;
+    for (const UiUpdate& update : recorder.updates) {
+        lastShown[update.controller] = update.value;
+    }
+    ASSERT_EQ(lastShown.size(), lastSent.size());
+    for (const auto& [controller, value] : lastSent) {
+        EXPECT_EQ(lastShown[controller], value);
+    }
+}
+
+/**
+ * @brief Retours sur tout l'espace (canal, CC) : bien plus de clés que de slots
+ */
+TEST(MidiBatchProcessorKeySpace, EveryKeyReachesUi) {
+    constexpr size_t KEYS = 16 * 128;
+    std::vector<int> shown(KEYS, -1);
+    MidiBatchProcessor batch;
+    batch.setUICallback(
+        [](uint8_t controller, uint8_t channel, uint8_t value, void* userdata) {
+            (*static_cast<std::vector<int>*>(userdata))[channel * 128 + controller] = value;
+        },
+        &shown);
+
+    // Deux passes sur les 2048 clés, au débit d'un flot DAW entre deux trames
+    for (uint8_t pass = 1; pass <= 2; ++pass) {
+        for (size_t key = 0; key < KEYS; ++key) {
+            EXPECT_TRUE(batch.addParameter(key & 0x7F, static_cast<uint8_t>(key >> 7), pass));
+        }
+        batch.processPendingBatches();
+        host::advanceMicros(FRAME_MS * 1000);
+    }
+    batch.flushAllBatches();
+
+    for (size_t key = 0; key < KEYS; ++key) {
+        EXPECT_EQ(shown[key], 2);
+    }
+    EXPECT_EQ(batch.getStats().active_parameters, 0u);
+    EXPECT_GT(batch.getStats().pool_flushes, 0u);
+}
+
+}  // namespace
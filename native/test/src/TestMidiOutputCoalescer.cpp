@@ -0,0 +1,161 @@
+// Étage de coalescence des CC sortants sur un port factice
+
+#include "HostTest.h"
+
+#include "FakeMidiOut.h"
+#include "adapters/secondary/midi/MidiOutputCoalescer.hpp"
+
+namespace {
+
+constexpr MidiChannel CH = 0;
+constexpr MidiCC CC = 20;
+
+TEST(MidiOutputCoalescer, KeepsLastValueWithinWindow) {
+    FakeMidiOut out;
+    MidiOutputCoalescer coalescer(out);
+
+    coalescer.sendCc(CH, CC, 10, 1);
+    coalescer.sendCc(CH, CC, 11, 1);
+    coalescer.sendCc(CH, CC, 12, 1);
+    EXPECT_TRUE(out.messages.empty());
+
+    coalescer.update(1000);
+    ASSERT_EQ(out.messages.size(), 1u);
+    EXPECT_EQ(out.messages[0], (MidiBytes{0xB0, CC, 12}));
+    EXPECT_EQ(coalescer.getStats().cc_merged, 2u);
+    EXPECT_EQ(coalescer.getStats().cc_sent, 1u);
+}
+
+TEST(MidiOutputCoalescer, ResendsSameValueInLaterWindow) {
+    // CC de déclenchement : la même valeur envoyée volontairement deux fois
+    FakeMidiOut out;
+    MidiOutputCoalescer coalescer(out);
+
+    coalescer.sendCc(CH, CC, 127, 1);
+    coalescer.update(1000);
+    coalescer.sendCc(CH, CC, 127, 1);
+    coalescer.update(2000);
+
+    EXPECT_EQ(out.countCc(CH, CC), 2u);
+    EXPECT_EQ(coalescer.getStats().cc_redundant, 0u);
+}
+
+TEST(MidiOutputCoalescer, ResyncsAfterIdlePeriod) {
+    // Le DAW a déplacé le paramètre : revenir à l'ancienne valeur doit la réémettre
+    FakeMidiOut out;
+    MidiOutputCoalescer coalescer(out);
+
+    coalescer.sendCc(CH, CC, 64, 1);
+    coalescer.update(1000);
+    coalescer.update(2000);
+    coalescer.sendCc(CH, CC, 70, 1);
+    coalescer.sendCc(CH, CC, 64, 1);
+    coalescer.update(500000);
+
+    ASSERT_EQ(out.messages.size(), 2u);
+    EXPECT_EQ(out.messages[1], (MidiBytes{0xB0, CC, 64}));
+}
+
+TEST(MidiOutputCoalescer, DropsMergedReturnToPreviousFlushValue) {
+    // Aller-retour de l'encodeur dans une fenêtre : rien de nouveau à transmettre
+    FakeMidiOut out;
+    MidiOutputCoalescer coalescer(out);
+
+    coalescer.sendCc(CH, CC, 64, 1);
+    coalescer.update(1000);
+    coalescer.sendCc(CH, CC, 65, 1);
+    coalescer.sendCc(CH, CC, 64, 1);
+    coalescer.update(2000);
+
+    EXPECT_EQ(out.countCc(CH, CC), 1u);
+    EXPECT_EQ(coalescer.getStats().cc_redundant, 1u);
+}
+
+TEST(MidiOutputCoalescer, Distinguishes7And14BitValues) {
+    FakeMidiOut out;
+    MidiOutputCoalescer coalescer(out);
+
+    coalescer.sendControlChange14(CH, 1, 100, 1);
+    coalescer.update(1000);
+    coalescer.sendControlChange14(CH, 1, 50, 1);
+    coalescer.sendCc(CH, 1, 100, 1);
+    coalescer.update(2000);
+
+    ASSERT_EQ(out.messages.size(), 3u);
+    EXPECT_EQ(out.messages[0], (MidiBytes{0xB0, 1, 0}));   // MSB de 100
+    EXPECT_EQ(out.messages[1], (MidiBytes{0xB0, 33, 100}));  // LSB
+    EXPECT_EQ(out.messages[2], (MidiBytes{0xB0, 1, 100}));   // CC 7 bits
+}
+
+TEST(MidiOutputCoalescer, FlushesPendingCcBeforeNotes) {
+    FakeMidiOut out;
+    MidiOutputCoalescer coalescer(out);
+
+    coalescer.sendCc(CH, CC, 1, 1);
+    coalescer.sendNoteOn(CH, 60, 100);
+    coalescer.sendCc(CH, CC, 2, 1);
+    coalescer.sendNoteOff(CH, 60, 0);
+
+    ASSERT_EQ(out.messages.size(), 4u);
+    EXPECT_EQ(out.messages[0], (MidiBytes{0xB0, CC, 1}));
+    EXPECT_EQ(out.messages[1], (MidiBytes{0x90, 60, 100}));
+    EXPECT_EQ(out.messages[2], (MidiBytes{0xB0, CC, 2}));
+    EXPECT_EQ(out.messages[3], (MidiBytes{0x80, 60, 0}));
+    EXPECT_EQ(coalescer.getStats().passthrough, 2u);
+}
+
+TEST(MidiOutputCoalescer, HonorsFlushWindow) {
+    FakeMidiOut out;
+    MidiOutputCoalescer::Config config;
+    config.flush_window_us = 5000;
+    MidiOutputCoalescer coalescer(out, config);
+
+    coalescer.sendCc(CH, CC, 1, 1);
+    coalescer.update(5000);
+    coalescer.sendCc(CH, CC, 2, 1);
+    coalescer.update(8000);
+    EXPECT_EQ(out.messages.size(), 1u);
+    EXPECT_TRUE(coalescer.isFlushDue(10000));
+    coalescer.update(10000);
+    EXPECT_EQ(out.messages.size(), 2u);
+}
+
+TEST(MidiOutputCoalescer, DefersRateLimitedKey) {
+    FakeMidiOut out;
+    MidiOutputCoalescer coalescer(out);
+    coalescer.setKeyMinInterval(CH, CC, 10000);
+
+    coalescer.sendCc(CH, CC, 1, 1);
+    coalescer.update(1000);
+    coalescer.sendCc(CH, CC, 2, 1);
+    coalescer.update(2000);
+    EXPECT_EQ(out.messages.size(), 1u);
+    EXPECT_EQ(coalescer.getPendingCount(), 1u);
+    EXPECT_EQ(coalescer.getStats().rate_deferred, 1u);
+
+    coalescer.update(11000);
+    ASSERT_EQ(out.messages.size(), 2u);
+    EXPECT_EQ(out.messages[1], (MidiBytes{0xB0, CC, 2}));
+}
+
+TEST(MidiOutputCoalescer, RateLimitTableIsBounded) {
+    FakeMidiOut out;
+    MidiOutputCoalescer coalescer(out);
+    for (size_t i = 0; i < MidiOutputCoalescer::MAX_RATE_LIMITED_KEYS; ++i) {
+        EXPECT_TRUE(coalescer.setKeyMinInterval(CH, static_cast<MidiCC>(i), 10000));
+    }
+    EXPECT_FALSE(coalescer.setKeyMinInterval(CH, 100, 10000));
+
+    // Un intervalle nul libère l'entrée et rend la clé illimitée
+    EXPECT_TRUE(coalescer.setKeyMinInterval(CH, 0, 0));
+    EXPECT_TRUE(coalescer.setKeyMinInterval(CH, 100, 10000));
+
+    coalescer.sendCc(CH, 0, 1, 1);
+    coalescer.update(1000);
+    coalescer.sendCc(CH, 0, 2, 1);
+    coalescer.update(2000);
+    EXPECT_EQ(out.messages.size(), 2u);
+    EXPECT_EQ(coalescer.getStats().rate_deferred, 0u);
+}
+
+}  // namespace
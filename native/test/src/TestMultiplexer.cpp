@@ -0,0 +1,94 @@
+// Balayage du multiplexeur simulé : seuls les canaux câblés coûtent une
+// sélection et un délai de stabilisation
+
+#include "HostTest.h"
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+
+#include <vector>
+
+#include "adapters/secondary/hardware/input/buttons/DigitalButtonManager.hpp"
+#include "adapters/secondary/hardware/multiplexer/MultiplexerManager.hpp"
+#include "config/SystemConstants.hpp"
+
+namespace {
+
+using namespace SystemConstants::Multiplexer;
+
+class MultiplexerTest : public testing::Test {
+public:
+    void SetUp() override {
+        for (uint8_t channel = 0; channel < MAX_CHANNELS; ++channel) {
+            host::setMuxInput(SIGNAL_PIN, channel, true);  // Pull-up : relâché
+        }
+        mux.initialize();
+        mux.resetScanStats();
+    }
+
+    /**
+     * @brief Durée virtuelle d'un balayage (délais de stabilisation compris)
+     */
+    uint64_t timedScan(uint16_t channelMask) {
+        const uint64_t startUs = host::nowMicros();
+        mux.scanAll(channelMask);
+        return host::nowMicros() - startUs;
+    }
+
+    MultiplexerManager& mux = MultiplexerManager::getInstance();
+};
+
+TEST_F(MultiplexerTest, FullSweepReadsEveryChannel) {
+    const uint16_t levels = 0xA5C3;
+    for (uint8_t channel = 0; channel < MAX_CHANNELS; ++channel) {
+        host::setMuxInput(SIGNAL_PIN, channel, (levels >> channel) & 1);
+    }
+
+    mux.scanAll();
+    EXPECT_EQ(mux.getSnapshot(), levels);
+    EXPECT_EQ(mux.getScanStats().channel_reads, 16u);
+
+    // Régime établi : une ligne par pas, un délai par canal
+    mux.resetScanStats();
+    EXPECT_EQ(timedScan(MultiplexerManager::ALL_CHANNELS), 16u * SWITCH_DELAY_US);
+    EXPECT_EQ(mux.getScanStats().line_toggles, 16u);
+}
+
+TEST_F(MultiplexerTest, MaskedSweepSkipsUnwiredChannels) {
+    const uint16_t wired = (1u << 0) | (1u << 3) | (1u << 9);
+    host::setMuxInput(SIGNAL_PIN, 3, false);
+    host::setMuxInput(SIGNAL_PIN, 4, false);  // Non câblé : jamais lu
+
+    const uint64_t elapsedUs = timedScan(wired);
+    EXPECT_LE(elapsedUs, 3u * SWITCH_DELAY_US);
+    EXPECT_EQ(mux.getScanStats().channel_reads, 3u);
+    EXPECT_EQ(mux.getSnapshot(), (1u << 0) | (1u << 9));
+    EXPECT_TRUE(mux.snapshotCovers(3));
+    EXPECT_FALSE(mux.snapshotCovers(4));
+}
+
+TEST_F(MultiplexerTest, ButtonManagerScansOnlyConfiguredChannels) {
+    std::vector<ButtonConfig> configs;
+    for (uint8_t channel : {2, 7, 12}) {
+        ButtonConfig config;
+        config.id = static_cast<ButtonId>(100 + channel);
+        config.gpio = muxPin(channel);
+        config.debounceMs = 2;
+        configs.push_back(config);
+    }
+    DigitalButtonManager buttons(configs, 2000);
+    mux.resetScanStats();
+
+    host::setMuxInput(SIGNAL_PIN, 7, false);  // Appui (actif à LOW)
+    DigitalButtonManager::Mask changed = 0;
+    for (int i = 0; i < 4; ++i) {
+        changed |= buttons.scan();
+    }
+
+    EXPECT_EQ(mux.getScanStats().scans, 4u);
+    EXPECT_EQ(mux.getScanStats().channel_reads, 4u * 3u);
+    EXPECT_EQ(changed, 1u << 1);
+    EXPECT_EQ(buttons.getPressedMask(), 1u << 1);
+}
+
+}  // namespace
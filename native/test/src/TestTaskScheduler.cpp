@@ -0,0 +1,185 @@
+// Ordonnanceur sur horloge simulée : activation initiale au démarrage, gigue,
+// activations sautées, réveil des tâches événementielles et temps d'occupation
+
+#include "HostTest.h"
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+
+#include "config/SystemConstants.hpp"
+#include "core/TaskScheduler.hpp"
+
+namespace {
+
+constexpr uint32_t INIT_US = 250000;  // Initialisation des sous-systèmes après addTask()
+constexpr uint32_t LOOP_US = 20;      // Coût d'un tour de loop() hors tâches
+
+/**
+ * @brief Tâche dont l'exécution consomme un temps fixe de l'horloge simulée
+ */
+TaskFunction busyFor(uint32_t runtimeUs, uint32_t* runs = nullptr) {
+    return [runtimeUs, runs]() {
+        host::advanceMicros(runtimeUs);
+        if (runs) {
+            (*runs)++;
+        }
+    };
+}
+
+class TaskSchedulerSim : public testing::Test {
+public:
+    /**
+     * @brief Fait tourner la boucle principale pendant durationUs
+     */
+    void run(uint32_t durationUs) {
+        const uint64_t endUs = host::nowMicros() + durationUs;
+        while (host::nowMicros() < endUs) {
+            scheduler.update();
+            host::advanceMicros(LOOP_US);
+        }
+    }
+
+    TaskScheduler scheduler;
+};
+
+TEST_F(TaskSchedulerSim, InitialReleaseIsSetAtStart) {
+    uint32_t midiRuns = 0;
+    const TaskHandle midi = scheduler.addTask(busyFor(150, &midiRuns), 1000, 0, "midi");
+    const TaskHandle input = scheduler.addTask(busyFor(300), 2000, 1, "input");
+    const TaskHandle ui = scheduler.addTask(busyFor(500), 16000, 2, "ui");
+
+    // Long délai entre enregistrement et premier update() (écran, USB, etc.)
+    host::advanceMicros(INIT_US);
+    EXPECT_FALSE(scheduler.isStarted());
+
+    run(100000);
+    EXPECT_TRUE(scheduler.isStarted());
+
+    // Aucune activation antérieure au démarrage n'est comptée comme manquée
+    for (TaskHandle handle : {midi, input, ui}) {
+        const Task* task = scheduler.getTask(handle);
+        ASSERT_TRUE(task != nullptr);
+        EXPECT_EQ(task->skippedReleases, 0u);
+        EXPECT_LT(task->startJitter.maxUs, task->interval);
+    }
+
+    // La tâche de priorité haute ne dérive pas : une exécution par période
+    EXPECT_GE(midiRuns, 99u);
+    EXPECT_LE(midiRuns, 101u);
+
+    // Sans préemption, la gigue MIDI est bornée par les tâches déjà lancées
+    EXPECT_LE(scheduler.getTask(midi)->startJitter.maxUs, 300u + 500u + 2 * LOOP_US);
+}
+
+TEST_F(TaskSchedulerSim, TaskAddedAfterStartIsReleasedAtRegistration) {
+    scheduler.addTask(busyFor(100), 1000, 0, "midi");
+    run(10000);
+
+    uint32_t lateRuns = 0;
+    const TaskHandle late = scheduler.addTask(busyFor(100, &lateRuns), 5000, 1, "late");
+    run(20000);
+
+    EXPECT_GE(lateRuns, 4u);
+    EXPECT_EQ(scheduler.getTask(late)->skippedReleases, 0u);
+    EXPECT_LT(scheduler.getTask(late)->startJitter.maxUs, 1000u);
+}
+
+TEST_F(TaskSchedulerSim, OverloadSkipsReleasesInsteadOfBursting) {
+    uint32_t runs = 0;
+    const TaskHandle slow = scheduler.addTask(busyFor(2500, &runs), 1000, 0, "slow");
+    host::advanceMicros(INIT_US);
+    run(10000);
+
+    // Chaque exécution dure 2,5 périodes : les activations manquées sont sautées
+    const Task* task = scheduler.getTask(slow);
+    EXPECT_GT(task->skippedReleases, 0u);
+    EXPECT_LE(runs, 10000u / 2500u + 1);
+    EXPECT_LT(task->skippedReleases, 10u);  // Pas les 250 activations de l'initialisation
+}
+
+TEST_F(TaskSchedulerSim, NotifiedTaskWakesOnNextCycle) {
+    uint32_t uiRuns = 0;
+    const TaskHandle ui = scheduler.addEventTask(busyFor(200, &uiRuns), 50000, 1, "ui");
+    scheduler.addTask(busyFor(100), 1000, 0, "midi");
+    run(5000);
+    const uint32_t runsAfterStart = uiRuns;
+
+    scheduler.notify(ui);
+    run(1000);
+
+    const Task* task = scheduler.getTask(ui);
+    EXPECT_EQ(uiRuns, runsAfterStart + 1);
+    EXPECT_EQ(task->notifiedRuns, 1u);
+    EXPECT_LE(task->wakeLatency.maxUs, 100u + LOOP_US);
+}
+
+/**
+ * @brief Temps d'exécution cumulé de la tâche MIDI pour une seconde d'entrée clairsemée
+ *
+ * Le producteur est une file de messages alimentée à MESSAGES_PER_SECOND ; la
+ * tâche coûte un temps fixe de scan plus un temps par message. En mode
+ * événementiel, la sonde ne fait que consulter la file (comme
+ * MidiSubsystem::hasPendingWork) et la tâche se réveille au plus tard après
+ * MIDI_MAX_SLEEP_US.
+ */
+uint64_t midiBusyUs(bool eventDriven, uint32_t* maxWaitUs) {
+    constexpr uint32_t MESSAGES_PER_SECOND = 20;
+    constexpr uint32_t SCAN_US = 60;
+    constexpr uint32_t PER_MESSAGE_US = 15;
+    constexpr uint32_t DURATION_US = 1000000;
+
+    TaskScheduler scheduler;
+    uint32_t pending = 0;
+    uint64_t oldestUs = 0;
+    *maxWaitUs = 0;
+
+    TaskFunction midiUpdate = [&]() {
+        if (pending > 0) {
+            const uint32_t waitUs = static_cast<uint32_t>(host::nowMicros() - oldestUs);
+            if (waitUs > *maxWaitUs) {
+                *maxWaitUs = waitUs;
+            }
+        }
+        host::advanceMicros(SCAN_US + pending * PER_MESSAGE_US);
+        pending = 0;
+    };
+    TaskHandle midi;
+    if (eventDriven) {
+        midi = scheduler.addEventTask(midiUpdate, SystemConstants::Performance::MIDI_MAX_SLEEP_US,
+                                      1, "midi", [&pending]() { return pending > 0; });
+    } else {
+        midi = scheduler.addTask(midiUpdate, SystemConstants::Performance::MIDI_TIME_INTERVAL, 1,
+                                 "midi");
+    }
+    scheduler.addTask(busyFor(100), SystemConstants::Performance::INPUT_TIME_INTERVAL, 0, "input");
+
+    const uint64_t startUs = host::nowMicros();
+    uint64_t nextMessageUs = startUs + 7000;
+    while (host::nowMicros() - startUs < DURATION_US) {
+        if (host::nowMicros() >= nextMessageUs) {
+            if (pending++ == 0) {
+                oldestUs = host::nowMicros();
+            }
+            nextMessageUs += 1000000 / MESSAGES_PER_SECOND;
+        }
+        scheduler.update();
+        host::advanceMicros(LOOP_US);
+    }
+    return scheduler.getTask(midi)->runtime.totalUs;
+}
+
+TEST(TaskSchedulerBusyTime, EventDrivenMidiTaskSleepsWithSparseInput) {
+    uint32_t periodicWaitUs = 0;
+    uint32_t eventWaitUs = 0;
+    const uint64_t periodicUs = midiBusyUs(false, &periodicWaitUs);
+    const uint64_t eventUs = midiBusyUs(true, &eventWaitUs);
+
+    // Réveils de secours seulement (100/s) contre une exécution par période (333/s)
+    EXPECT_LT(eventUs * 2, periodicUs);
+
+    // Et un message attend au plus un cycle de la boucle, au lieu d'une période
+    EXPECT_LE(eventWaitUs, 100u + 3 * LOOP_US);
+    EXPECT_GT(periodicWaitUs, eventWaitUs);
+}
+
+}  // namespace
@@ -0,0 +1,357 @@
+// Échantillonnage timer des entrées : l'interruption ne fait que des relevés
+// bruts (pins directes, un canal du multiplexeur, compteurs d'encodeurs),
+// l'anti-rebond a lieu au vidage, dans l'ordre des instantanés
+
+#include "HostTest.h"
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+
+#include <memory>
+#include <vector>
+
+#include "adapters/secondary/hardware/input/TimerInputSampler.hpp"
+#include "adapters/secondary/hardware/input/buttons/DigitalButtonManager.hpp"
+#include "adapters/secondary/hardware/input/encoders/EncoderManager.hpp"
+#include "adapters/secondary/hardware/multiplexer/MultiplexerManager.hpp"
+#include "adapters/secondary/hardware/timer/PeriodicTimer.hpp"
+#include "app/services/InputManagerService.hpp"
+#include "config/SystemConstants.hpp"
+#include "config/unified/ControlBuilder.hpp"
+#include "config/unified/UnifiedConfiguration.hpp"
+#include "core/controllers/InputController.hpp"
+#include "core/domain/events/MidiEvents.hpp"
+#include "core/domain/events/core/EventBus.hpp"
+
+namespace {
+
+constexpr uint8_t BUTTON_PIN = 20;
+constexpr ButtonId BUTTON_ID = 7;
+constexpr uint32_t PERIOD_US = 2000;
+constexpr uint16_t DEBOUNCE_MS = 10;  // 5 périodes de timer
+
+ButtonConfig buttonConfig() {
+    ButtonConfig config;
+    config.id = BUTTON_ID;
+    config.gpio = GpioPin{BUTTON_PIN, PinMode::PULLUP};
+    config.activeLow = true;
+    config.debounceMs = DEBOUNCE_MS;
+    return config;
+}
+
+class TimerInputSamplerTest : public testing::Test {
+public:
+    void SetUp() override {
+        host::setPin(BUTTON_PIN, true);  // Relâché (actif à LOW)
+        buttons = std::make_unique<DigitalButtonManager>(std::vector<ButtonConfig>{buttonConfig()},
+                                                         PERIOD_US);
+        sampler = std::make_unique<TimerInputSampler>(buttons.get());
+        ASSERT_TRUE(sampler->start(PERIOD_US));
+    }
+
+    void TearDown() override {
+        sampler.reset();
+    }
+
+    /**
+     * @brief Une période de timer avec le niveau donné sur la pin
+     */
+    void tick(bool level) {
+        host::setPin(BUTTON_PIN, level);
+        host::advanceMicros(PERIOD_US);
+        PeriodicTimer::serviceAll(micros());
+    }
+
+    /**
+     * @brief Vide la file comme InputManagerService::drainSampledEvents()
+     * @return Numéros d'instantané (depuis 1) où l'état débouncé a changé
+     */
+    std::vector<int> drain() {
+        std::vector<int> changes;
+        TimerInputSampler::RawSample sample;
+        int index = 0;
+        while (sampler->poll(sample)) {
+            ++index;
+            if (buttons->applySample(sample.levels, sample.mux, sample.timestampUs)) {
+                changes.push_back(index);
+            }
+        }
+        return changes;
+    }
+
+    std::unique_ptr<DigitalButtonManager> buttons;
+    std::unique_ptr<TimerInputSampler> sampler;
+};
+
+TEST_F(TimerInputSamplerTest, InterruptOnlyQueuesRawSnapshots) {
+    for (int i = 0; i < 8; ++i) {
+        tick(false);
+    }
+
+    // Rien n'est débouncé ni appliqué tant que la tâche n'a pas vidé la file
+    EXPECT_EQ(buttons->getPressedMask(), 0u);
+    EXPECT_FALSE(buttons->getButtons()[0]->isPressed());
+    EXPECT_EQ(sampler->getStats().events_produced, 8u);
+
+    EXPECT_EQ(drain(), (std::vector<int>{5}));
+    EXPECT_EQ(buttons->getPressedMask(), 1u);
+    EXPECT_EQ(sampler->getStats().events_consumed, 8u);
+}
+
+TEST_F(TimerInputSamplerTest, BounceShorterThanDebounceIsIgnored) {
+    const bool pattern[] = {false, true, false, false, true, true, true, true};
+    for (bool level : pattern) {
+        tick(level);
+    }
+    EXPECT_TRUE(drain().empty());
+    EXPECT_EQ(buttons->getPressedMask(), 0u);
+}
+
+TEST_F(TimerInputSamplerTest, DebounceCountsTimerPeriodsNotDrains) {
+    // Appui rebondissant puis stable, vidé à chaque période : la bascule tombe
+    // au 5e instantané actif consécutif, comme avec un seul vidage en fin de rafale
+    const bool pattern[] = {false, true, false, false, false, false, false, false};
+    std::vector<int> changes;
+    int offset = 0;
+    for (bool level : pattern) {
+        tick(level);
+        for (int change : drain()) {
+            changes.push_back(offset + change);
+        }
+        ++offset;
+    }
+    EXPECT_EQ(changes, (std::vector<int>{7}));
+    EXPECT_EQ(buttons->getPressedMask(), 1u);
+}
+
+// === MULTIPLEXEUR ET ENCODEURS ===
+
+using SystemConstants::Multiplexer::SIGNAL_PIN;
+
+constexpr uint8_t MUX_CHANNELS[] = {8, 9, 10};  // Tour : 10, 9, 8 (ordre de Gray)
+constexpr uint8_t WATCHED_CHANNEL = 9;          // Lu aux ticks 3, 6, 9, 12...
+constexpr uint16_t MUX_DEBOUNCE_MS = 6;         // 2 tours de 3 canaux à 1 ms
+constexpr uint32_t MUX_PERIOD_US = 1000;
+constexpr uint8_t ENCODER_PIN_A = 22;
+constexpr EncoderId ENCODER_ID = 3;
+
+class MuxTimerSamplingTest : public testing::Test {
+public:
+    void SetUp() override {
+        for (uint8_t channel = 0; channel < 16; ++channel) {
+            host::setMuxInput(SIGNAL_PIN, channel, true);  // Pull-up : relâché
+        }
+        MultiplexerManager::getInstance().initialize();
+
+        std::vector<ButtonConfig> configs;
+        for (uint8_t channel : MUX_CHANNELS) {
+            ButtonConfig config;
+            config.id = static_cast<ButtonId>(40 + channel);
+            config.gpio = GpioPin{GpioPin::Source::MUX, channel};
+            config.activeLow = true;
+            config.debounceMs = MUX_DEBOUNCE_MS;
+            configs.push_back(config);
+        }
+        buttons = std::make_unique<DigitalButtonManager>(configs);
+
+        EncoderConfig encoder;
+        encoder.id = ENCODER_ID;
+        encoder.pinA = GpioPin{ENCODER_PIN_A};
+        encoder.pinB = GpioPin{static_cast<uint8_t>(ENCODER_PIN_A + 1)};
+        encoder.enableAcceleration = false;
+        encoders = std::make_unique<EncoderManager>(std::vector<EncoderConfig>{encoder});
+
+        sampler = std::make_unique<TimerInputSampler>(buttons.get(), encoders.get());
+        ASSERT_TRUE(sampler->start(MUX_PERIOD_US));
+    }
+
+    void TearDown() override {
+        sampler.reset();
+    }
+
+    void tick() {
+        host::advanceMicros(MUX_PERIOD_US);
+        PeriodicTimer::serviceAll(micros());
+    }
+
+    /**
+     * @brief Vidage tardif, en une fois
+     * @return Numéros d'instantané (depuis 1) où l'état débouncé a changé
+     */
+    std::vector<int> drain() {
+        std::vector<int> changes;
+        TimerInputSampler::RawSample sample;
+        int index = 0;
+        while (sampler->poll(sample)) {
+            ++index;
+            if (buttons->applySample(sample.levels, sample.mux, sample.timestampUs)) {
+                changes.push_back(index);
+            }
+        }
+        return changes;
+    }
+
+    /**
+     * @brief Masque du bouton câblé sur un canal
+     */
+    static DigitalButtonManager::Mask bitFor(uint8_t channel) {
+        for (size_t i = 0; i < sizeof(MUX_CHANNELS); ++i) {
+            if (MUX_CHANNELS[i] == channel) {
+                return DigitalButtonManager::Mask{1} << i;
+            }
+        }
+        return 0;
+    }
+
+    std::unique_ptr<DigitalButtonManager> buttons;
+    std::unique_ptr<EncoderManager> encoders;
+    std::unique_ptr<TimerInputSampler> sampler;
+};
+
+TEST_F(MuxTimerSamplingTest, OneChannelPerTickWithoutSettlingDelay) {
+    const uint64_t startUs = host::nowMicros();
+    host::setMuxInput(SIGNAL_PIN, WATCHED_CHANNEL, false);
+    tick();
+    tick();
+    tick();
+
+    // Aucune attente dans l'interruption : seul le temps des ticks s'est écoulé
+    EXPECT_EQ(host::nowMicros() - startUs, 3u * MUX_PERIOD_US);
+
+    std::vector<uint8_t> channels;
+    TimerInputSampler::RawSample sample;
+    while (sampler->poll(sample)) {
+        channels.push_back(sample.mux.channel);
+    }
+    // Le premier tick ne fait que sélectionner le premier canal
+    EXPECT_EQ(channels, (std::vector<uint8_t>{DigitalButtonManager::NO_MUX_CHANNEL, 10, 9}));
+}
+
+TEST_F(MuxTimerSamplingTest, LateDrainCountsEachMuxReadOnce) {
+    // Appui stable, vidé après 12 ticks : 2 lectures du canal (ticks 3 et 6)
+    host::setMuxInput(SIGNAL_PIN, WATCHED_CHANNEL, false);
+    for (int i = 0; i < 12; ++i) {
+        tick();
+    }
+    EXPECT_EQ(sampler->getStats().events_produced, 12u);
+
+    EXPECT_EQ(drain(), (std::vector<int>{6}));
+    EXPECT_EQ(buttons->getPressedMask(), bitFor(WATCHED_CHANNEL));
+}
+
+TEST_F(MuxTimerSamplingTest, SingleMuxReadIsNotReplicated) {
+    // Rebond vu par une seule lecture du canal (tick 3) mais présent pendant
+    // trois ticks : il ne compte qu'un échantillon, sous le seuil de 2
+    host::setMuxInput(SIGNAL_PIN, WATCHED_CHANNEL, true);
+    tick();
+    host::setMuxInput(SIGNAL_PIN, WATCHED_CHANNEL, false);
+    tick();
+    tick();
+    tick();
+    host::setMuxInput(SIGNAL_PIN, WATCHED_CHANNEL, true);
+    for (int i = 0; i < 8; ++i) {
+        tick();
+    }
+
+    EXPECT_TRUE(drain().empty());
+    EXPECT_EQ(buttons->getPressedMask(), 0u);
+}
+
+TEST_F(MuxTimerSamplingTest, EncoderCountsCapturedAtTick) {
+    tick();
+    host::turnEncoder(ENCODER_PIN_A, 4);
+    tick();
+    const uint32_t turnTickUs = micros();
+    tick();
+    tick();
+
+    // Seuls les changements sont relevés, avec l'horodatage du tick
+    TimerInputSampler::EncoderSample step;
+    ASSERT_TRUE(sampler->pollEncoder(step));
+    EXPECT_EQ(step.index, 0u);
+    EXPECT_EQ(step.count, 4);
+    EXPECT_EQ(step.timestampUs, turnTickUs);
+    EXPECT_FALSE(sampler->pollEncoder(step));
+
+    // Conversion en crans dans la tâche : un cran de 4 pas
+    EXPECT_EQ(encoders->applyCount(step.index, step.count, step.timestampUs), -1);
+    EXPECT_EQ(sampler->getStats().encoder_events, 1u);
+}
+
+/**
+ * @brief Appuis et rotations publiés par InputController
+ */
+class InputEventListener : public EventListener {
+public:
+    bool onEvent(const Event& event) override {
+        if (event.getType() == EventTypes::HighPriorityButtonPress) {
+            const auto& press = static_cast<const HighPriorityButtonPressEvent&>(event);
+            presses.push_back({press.buttonId, press.pressed});
+        } else if (event.getType() == EventTypes::HighPriorityEncoderChanged) {
+            encoderDelta += static_cast<const HighPriorityEncoderChangedEvent&>(event).delta;
+        }
+        return true;
+    }
+
+    struct Press {
+        uint16_t id;
+        bool pressed;
+    };
+    std::vector<Press> presses;
+    int32_t encoderDelta = 0;
+};
+
+TEST(InputManagerTimerSampling, LateDrainOfMuxButtonAndEncoder) {
+    for (uint8_t channel = 0; channel < 16; ++channel) {
+        host::setMuxInput(SIGNAL_PIN, channel, true);
+    }
+    MultiplexerManager::getInstance().initialize();
+
+    auto config = std::make_shared<UnifiedConfiguration>();
+    for (uint8_t channel : MUX_CHANNELS) {
+        config->addControl(ControlBuilder(static_cast<InputId>(40 + channel), "mux_button")
+                               .asButton(GpioPin{GpioPin::Source::MUX, channel}, MUX_DEBOUNCE_MS)
+                               .build());
+    }
+    config->addControl(ControlBuilder(ENCODER_ID, "timer_encoder")
+                           .asRotaryEncoder(ENCODER_PIN_A, ENCODER_PIN_A + 1)
+                           .build());
+
+    auto bus = std::make_shared<EventBus>();
+    InputEventListener listener;
+    bus->subscribeToTypes(&listener,
+                          {EventTypes::HighPriorityButtonPress, EventTypes::HighPriorityEncoderChanged});
+    bus->start();
+
+    IInputManager::ManagerConfig managerConfig;
+    managerConfig.enableTimerSampling = true;
+    managerConfig.samplingPeriodUs = MUX_PERIOD_US;
+    InputManagerService service(managerConfig);
+    ASSERT_TRUE(service
+                    .initialize(config->getAllControls(),
+                                std::make_shared<InputController>(nullptr, config, bus))
+                    .isSuccess());
+    ASSERT_TRUE(service.getInputSampler() != nullptr);
+    EXPECT_TRUE(service.getInputSampler()->capturesEncoders());
+
+    // Appui et un cran pendant que la tâche d'entrée est bloquée 12 ms
+    // (PeriodicTimer::serviceAll ne déclenche qu'un tick par appel sur l'hôte)
+    host::setMuxInput(SIGNAL_PIN, WATCHED_CHANNEL, false);
+    host::turnEncoder(ENCODER_PIN_A, 4);
+    for (int i = 0; i < 12; ++i) {
+        host::advanceMicros(MUX_PERIOD_US);
+        PeriodicTimer::serviceAll(micros());
+    }
+    EXPECT_TRUE(service.hasPendingWork());
+
+    service.update();
+    bus->update();
+
+    ASSERT_EQ(listener.presses.size(), 1u);
+    EXPECT_EQ(listener.presses[0].id, 40 + WATCHED_CHANNEL);
+    EXPECT_TRUE(listener.presses[0].pressed);
+    EXPECT_EQ(listener.encoderDelta, -1);
+    EXPECT_EQ(service.getInputSampler()->getStats().events_consumed, 12u);
+}
+
+}  // namespace
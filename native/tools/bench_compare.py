@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Compare deux sorties JSON des micro-bancs hôte (environnement bench).
+
+Affiche, pour chaque banc présent dans les deux fichiers, le temps CPU par
+itération et l'écart relatif ; le code de retour vaut 1 si un banc régresse
+au-delà du seuil, pour servir de garde en CI.
+
+    .pio/build/bench/program --benchmark_out=bench.json
+    python3 native/tools/bench_compare.py native/bench/baseline.json bench.json
+    python3 native/tools/bench_compare.py --threshold 25 --filter EventBus base.json new.json
+"""
+
+import argparse
+import json
+import re
+import sys
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    runs = {}
+    for bench in data.get("benchmarks", []):
+        if bench.get("run_type", "iteration") == "iteration":
+            runs[bench["name"]] = bench
+    return runs
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("baseline", help="JSON de référence")
+    parser.add_argument("contender", help="JSON à évaluer")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="régression tolérée en %% du temps CPU (10 par défaut)")
+    parser.add_argument("--filter", default=".", help="expression régulière sur les noms")
+    parser.add_argument("--metric", choices=("cpu_time", "real_time"), default="cpu_time")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    contender = load(args.contender)
+    pattern = re.compile(args.filter)
+    names = [n for n in baseline if n in contender and pattern.search(n)]
+    if not names:
+        raise SystemExit("aucun banc commun aux deux fichiers")
+
+    width = max(len(n) for n in names)
+    print(f"{'banc':<{width}}{'base ns':>12}{'nouveau ns':>12}{'écart':>9}")
+    regressions = 0
+    for name in names:
+        old = baseline[name][args.metric]
+        new = contender[name][args.metric]
+        change = (new - old) / old * 100.0 if old else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  RÉGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  amélioration"
+        print(f"{name:<{width}}{old:>12.1f}{new:>12.1f}{change:>+8.1f}%{flag}")
+
+    missing = sorted(set(baseline) - set(contender))
+    if missing:
+        print(f"absents du second fichier : {', '.join(missing)}", file=sys.stderr)
+    print(f"{len(names)} bancs comparés, {regressions} régression(s) au-delà de {args.threshold:.0f} %")
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""Convertit la sortie de "record dump" en fichier d'enregistrement binaire.
+
+Le fichier produit (format décrit dans src/core/utils/InputRecorder.hpp) se
+rejoue sur l'hôte :
+
+    python3 native/tools/input_capture.py capture.log session.bin
+    python3 native/tools/input_capture.py --port /dev/ttyACM0 session.bin  # requiert pyserial
+    .pio/build/native/program --quiet --replay session.bin --midi-out out.mid
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"MCIR"
+VERSION = 2
+RECORD = struct.Struct("<IHBB")
+HEADER = struct.Struct("<4sHHII")
+
+
+def read_dump(lines):
+    """Retourne les enregistrements (timestamp, id, kind, value) du dernier bloc IREC."""
+    records, block, overflows = None, None, 0
+    for line in lines:
+        line = line.strip()
+        if line.startswith("IREC BEGIN"):
+            fields = dict(f.split("=", 1) for f in line.split() if "=" in f)
+            overflows = int(fields.get("overflows", "0"))
+            block = []
+        elif line.startswith("IREC END"):
+            if block is not None:
+                records = block
+            block = None
+        elif block is not None:
+            parts = line.split()
+            if len(parts) == 4:
+                block.append(tuple(int(p, 16) for p in parts))
+    if records is None:
+        raise SystemExit("aucun bloc 'IREC BEGIN' ... 'IREC END' trouvé")
+    return records, overflows
+
+
+def read_port(port, baud):
+    import serial  # pyserial
+
+    with serial.Serial(port, baud, timeout=2) as link:
+        link.reset_input_buffer()
+        link.write(b"record stop\n")
+        link.write(b"record dump\n")
+        lines = []
+        while True:
+            raw = link.readline()
+            if not raw:
+                break
+            line = raw.decode("ascii", "replace")
+            lines.append(line)
+            if line.startswith("IREC END"):
+                break
+        return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("paths", nargs="+", metavar="[source] output",
+                        help="capture texte (stdin si absente ou '-') puis fichier binaire à écrire")
+    parser.add_argument("--port", help="port série : arrête l'enregistrement et le lit")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+    source = args.paths[0] if len(args.paths) > 1 else None
+    output = args.paths[-1]
+
+    if args.port:
+        lines = read_port(args.port, args.baud)
+    elif source and source != "-":
+        with open(source, encoding="ascii", errors="replace") as f:
+            lines = f.readlines()
+    else:
+        lines = sys.stdin.readlines()
+
+    records, overflows = read_dump(lines)
+    with open(output, "wb") as out:
+        out.write(HEADER.pack(MAGIC, VERSION, RECORD.size, len(records), 0))
+        for record in records:
+            out.write(RECORD.pack(*record))
+
+    kinds = {1: 0, 2: 0, 3: 0, 4: 0}
+    for record in records:
+        kinds[record[2]] = kinds.get(record[2], 0) + 1
+    duration = records[-1][0] / 1e6 if records else 0.0
+    print(f"{output}: {len(records)} événements sur {duration:.3f} s "
+          f"(encodeurs={kinds[1]} pins={kinds[2]} mux={kinds[4]} midi={kinds[3]})")
+    if overflows:
+        print("attention : tampon plein, l'enregistrement a été tronqué", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""Décodeur de la trace de latence encodeur -> USB (build -DLATENCY_TRACE).
+
+Lit la sortie de la commande série "trace dump" (fichier, stdin ou port série)
+et affiche, pour chaque étage, les percentiles du délai depuis l'étage
+précédent atteint par la même trace, ainsi que la latence de bout en bout.
+
+    python3 native/tools/latency_decode.py capture.log
+    python3 native/tools/latency_decode.py --port /dev/ttyACM0   # requiert pyserial
+"""
+
+import argparse
+import sys
+from collections import defaultdict
+
+STAGES = [
+    "encoder_read",
+    "process_encoders",
+    "input_processor",
+    "event_bus",
+    "midi_mapper",
+    "command",
+    "coalescer",
+    "usb_enqueue",
+    "usb_send",
+]
+USB_SEND = STAGES.index("usb_send")
+
+
+def read_dump(lines):
+    """Retourne (hz, dropped, [(ticks, id, stage)]) du dernier bloc LTRACE."""
+    hz, dropped, records, block = None, 0, [], None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("LTRACE BEGIN"):
+            fields = dict(f.split("=", 1) for f in line.split()[3:] if "=" in f)
+            hz = int(fields.get("hz", "1000000"))
+            dropped = int(fields.get("dropped", "0"))
+            block = []
+        elif line.startswith("LTRACE END"):
+            if block is not None:
+                records = block
+            block = None
+        elif block is not None:
+            parts = line.split()
+            if len(parts) == 3:
+                block.append(tuple(int(p, 16) for p in parts))
+    if hz is None:
+        raise SystemExit("aucun bloc 'LTRACE BEGIN' trouvé")
+    return hz, dropped, records
+
+
+def read_port(port, baud):
+    import serial  # pyserial
+
+    with serial.Serial(port, baud, timeout=2) as link:
+        link.reset_input_buffer()
+        link.write(b"trace dump\n")
+        lines = []
+        while True:
+            raw = link.readline()
+            if not raw:
+                break
+            line = raw.decode("ascii", "replace")
+            lines.append(line)
+            if line.startswith("LTRACE END"):
+                break
+        return lines
+
+
+def percentile(sorted_values, p):
+    if not sorted_values:
+        return 0.0
+    index = min(len(sorted_values) - 1, int(round(p / 100.0 * (len(sorted_values) - 1))))
+    return sorted_values[index]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("capture", nargs="?", help="fichier de capture (stdin par défaut)")
+    parser.add_argument("--port", help="port série : envoie 'trace dump' et lit la réponse")
+    parser.add_argument("--baud", type=int, default=115200)
+    args = parser.parse_args()
+
+    if args.port:
+        lines = read_port(args.port, args.baud)
+    elif args.capture:
+        with open(args.capture, encoding="ascii", errors="replace") as f:
+            lines = f.readlines()
+    else:
+        lines = sys.stdin.readlines()
+
+    hz, dropped, records = read_dump(lines)
+    ticks_per_us = hz / 1e6
+
+    # Premier passage de chaque trace dans chaque étage
+    traces = defaultdict(dict)
+    for ticks, trace_id, stage in records:
+        if trace_id != 0 and stage < len(STAGES):
+            traces[trace_id].setdefault(stage, ticks)
+
+    deltas = defaultdict(list)
+    end_to_end = []
+    incomplete = 0
+    for stamps in traces.values():
+        if 0 not in stamps:
+            continue  # Début écrasé par l'anneau
+        previous = None
+        for stage in sorted(stamps):
+            if previous is not None:
+                us = ((stamps[stage] - stamps[previous]) & 0xFFFFFFFF) / ticks_per_us
+                deltas[(previous, stage)].append(us)
+            previous = stage
+        if USB_SEND in stamps:
+            end_to_end.append(((stamps[USB_SEND] - stamps[0]) & 0xFFFFFFFF) / ticks_per_us)
+        else:
+            incomplete += 1
+
+    print(f"records={len(records)} dropped={dropped} traces={len(traces)} "
+          f"sent={len(end_to_end)} not_sent={incomplete} (navigation, coalescés ou redondants)")
+    print(f"{'étage':<36}{'n':>7}{'p50 us':>10}{'p90 us':>10}{'p99 us':>10}{'max us':>10}")
+
+    rows = sorted(deltas.items())
+    rows.append(((0, USB_SEND), end_to_end))
+    for (src, dst), values in rows:
+        values = sorted(values)
+        label = f"{STAGES[src]} -> {STAGES[dst]}"
+        if (src, dst) == (0, USB_SEND):
+            label = "total " + label
+        print(f"{label:<36}{len(values):>7}"
+              f"{percentile(values, 50):>10.1f}{percentile(values, 90):>10.1f}"
+              f"{percentile(values, 99):>10.1f}{(values[-1] if values else 0):>10.1f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,33 +1,101 @@
 #include "DisplayManagerAdapter.hpp"
 #include <Arduino.h>
+#include <algorithm>
+#include <climits>
 #include "config/SystemConstants.hpp"
+#include "core/domain/events/core/EventTypes.hpp"
 
-DisplayManagerAdapter::DisplayManagerAdapter(std::shared_ptr<Ili9341LvglBridge> lvglBridge)
+DisplayManagerAdapter::DisplayManagerAdapter(std::shared_ptr<Ili9341LvglBridge> lvglBridge,
+                                             std::shared_ptr<MidiController::Events::IEventBus> eventBus)
     : lvglBridge_(lvglBridge)
+    , eventBus_(eventBus)
+    , subscriptionId_(0)
     , refreshIntervalMs_(SystemConstants::Performance::DISPLAY_REFRESH_PERIOD_MS * SystemConstants::Performance::VSYNC_SPACING)
-    , lastRefreshTime_(0) {
+    , lastRefreshTime_(0)
+    , lastSlotTime_(0)
+    , lastActivityTime_(0)
+    , rampUp_(true)
+    , lvglTimerDelayMs_(LV_NO_TIMER_READY)
+    , windowStart_(0)
+    , windowRendered_(0)
+    , windowSkipped_(0)
+    , windowHandlerStartUs_(0) {
+    if (eventBus_) {
+        subscriptionId_ = eventBus_->subscribeToTypes(this,
+                                                      {EventTypes::EncoderTurned,
+                                                       EventTypes::EncoderButton,
+                                                       EventTypes::ButtonPressed,
+                                                       EventTypes::ButtonReleased,
+                                                       EventTypes::HighPriorityEncoderChanged,
+                                                       EventTypes::HighPriorityButtonPress,
+                                                       EventTypes::NavigationRequested},
+                                                      EventPriority::PRIORITY_LOW);
+    }
+}
+
+DisplayManagerAdapter::~DisplayManagerAdapter() {
+    if (eventBus_ && subscriptionId_ != 0) {
+        eventBus_->unsubscribe(subscriptionId_);
+    }
 }
 
 void DisplayManagerAdapter::update() {
     if (!lvglBridge_) {
         return;
     }
-    
+
     unsigned long currentTime = getCurrentTime();
-    
-    if ((currentTime - lastRefreshTime_) >= refreshIntervalMs_) {
-        lvglBridge_->refreshDisplay();
-        lastRefreshTime_ = currentTime;
+    rollStatsWindow(currentTime);
+
+    const bool animating = lvglBridge_->hasRunningAnimations();
+    const bool dirty = animating || lvglBridge_->hasInvalidatedAreas();
+    const bool active = dirty ||
+        (currentTime - lastActivityTime_) < SystemConstants::Performance::DISPLAY_ACTIVE_HOLD_MS;
+    const unsigned long interval =
+        active ? refreshIntervalMs_ : SystemConstants::Performance::DISPLAY_IDLE_REFRESH_PERIOD_MS;
+    stats_.active = active;
+
+    // Échéance du prochain timer LVGL (horloge, timers applicatifs), mesurée au dernier appel
+    const bool timerDue = lvglTimerRemainingMs(currentTime) == 0;
+
+    if (rampUp_ || (currentTime - lastSlotTime_) >= interval) {
+        rampUp_ = false;
+        lastSlotTime_ = currentTime;
+
+        if (dirty) {
+            refresh(currentTime);
+            stats_.frames_rendered++;
+            windowRendered_++;
+        } else if (timerDue ||
+                   (currentTime - lastRefreshTime_) >= SystemConstants::Performance::DISPLAY_IDLE_REFRESH_PERIOD_MS) {
+            // Rien à dessiner : entretenir les timers LVGL à cadence réduite
+            refresh(currentTime);
+            stats_.housekeeping_calls++;
+        } else {
+            stats_.frames_skipped++;
+            windowSkipped_++;
+        }
+    } else if (timerDue) {
+        // Timer LVGL échu entre deux créneaux
+        refresh(currentTime);
+        stats_.housekeeping_calls++;
     }
+
+    // Prochain passage : créneau suivant ou timer LVGL s'il est plus proche
+    // (les invalidations et notifyActivity() réveillent la tâche UI plus tôt)
+    const unsigned long elapsed = currentTime - lastSlotTime_;
+    const unsigned long slotRemaining = elapsed < interval ? interval - elapsed : 0;
+    lvglBridge_->setNextServiceDelayMs(std::min(slotRemaining, lvglTimerRemainingMs(currentTime)));
 }
 
 void DisplayManagerAdapter::forceRefresh() {
     if (!lvglBridge_) {
         return;
     }
-    
-    lvglBridge_->refreshDisplay();
-    lastRefreshTime_ = getCurrentTime();
+
+    unsigned long currentTime = getCurrentTime();
+    refresh(currentTime);
+    lastSlotTime_ = currentTime;
 }
 
 void DisplayManagerAdapter::setRefreshInterval(unsigned long intervalMs) {
@@ -38,6 +106,77 @@ unsigned long DisplayManagerAdapter::getRefreshInterval() const {
     return refreshIntervalMs_;
 }
 
+void DisplayManagerAdapter::notifyActivity() {
+    lastActivityTime_ = getCurrentTime();
+    if (!stats_.active) {
+        // Repos -> pleine cadence sans attendre le créneau suivant
+        rampUp_ = true;
+        stats_.ramp_ups++;
+        if (lvglBridge_) {
+            lvglBridge_->requestService();
+        }
+    }
+}
+
+bool DisplayManagerAdapter::onEvent(const Event& event) {
+    (void)event;
+    notifyActivity();
+    return false;
+}
+
+void DisplayManagerAdapter::resetPacingStats() {
+    stats_ = PacingStats{};
+    windowStart_ = getCurrentTime();
+    windowRendered_ = 0;
+    windowSkipped_ = 0;
+    windowHandlerStartUs_ = lvglBridge_ ? lvglBridge_->getTimerHandlerTimeUs() : 0;
+}
+
+void DisplayManagerAdapter::printPacingStats() const {
+    Serial.printf("DisplayManager [%s] per s: rendered=%lu skipped=%lu lv_timer_handler us=%lu "
+                  "(total rendered=%lu skipped=%lu idle=%lu ramp-ups=%lu)\n",
+                  stats_.active ? "active" : "idle",
+                  static_cast<unsigned long>(stats_.rendered_per_s),
+                  static_cast<unsigned long>(stats_.skipped_per_s),
+                  static_cast<unsigned long>(stats_.handler_us_per_s),
+                  static_cast<unsigned long>(stats_.frames_rendered),
+                  static_cast<unsigned long>(stats_.frames_skipped),
+                  static_cast<unsigned long>(stats_.housekeeping_calls),
+                  static_cast<unsigned long>(stats_.ramp_ups));
+}
+
+void DisplayManagerAdapter::refresh(unsigned long now) {
+    lvglBridge_->refreshDisplay();
+    lastRefreshTime_ = now;
+    lvglTimerDelayMs_ = lvglBridge_->getTimeUntilNextRefreshMs();
+}
+
+unsigned long DisplayManagerAdapter::lvglTimerRemainingMs(unsigned long now) const {
+    if (lvglTimerDelayMs_ == LV_NO_TIMER_READY) {
+        return ULONG_MAX;
+    }
+    const unsigned long elapsed = now - lastRefreshTime_;
+    return elapsed < lvglTimerDelayMs_ ? lvglTimerDelayMs_ - elapsed : 0;
+}
+
+void DisplayManagerAdapter::rollStatsWindow(unsigned long now) {
+    const unsigned long windowMs = now - windowStart_;
+    if (windowMs < 1000) {
+        return;
+    }
+
+    // Ramené à une seconde exacte si la fenêtre a débordé
+    const uint64_t handlerUs = lvglBridge_->getTimerHandlerTimeUs();
+    stats_.rendered_per_s = static_cast<uint32_t>(windowRendered_ * 1000UL / windowMs);
+    stats_.skipped_per_s = static_cast<uint32_t>(windowSkipped_ * 1000UL / windowMs);
+    stats_.handler_us_per_s = static_cast<uint32_t>((handlerUs - windowHandlerStartUs_) * 1000 / windowMs);
+
+    windowStart_ = now;
+    windowRendered_ = 0;
+    windowSkipped_ = 0;
+    windowHandlerStartUs_ = handlerUs;
+}
+
 unsigned long DisplayManagerAdapter::getCurrentTime() const {
     return millis();
-}
\ No newline at end of file
+}
@@ -2,60 +2,146 @@
 
 #include <memory>
 #include "adapters/secondary/hardware/display/Ili9341LvglBridge.hpp"
+#include "core/domain/events/core/IEventBus.hpp"
 #include "core/domain/interfaces/IDisplayManager.hpp"
 
 /**
  * @brief Adapter pour la gestion d'affichage avec timing et rafraîchissement optimisé
- * 
+ *
  * Cette classe implémente IDisplayManager et est responsable de gérer
  * les rafraîchissements d'écran avec limitation de fréquence et timing optimal.
+ *
+ * Cadence adaptative :
+ * - pleine cadence (refreshIntervalMs_) tant que des zones sont invalidées,
+ *   qu'une animation tourne, ou pendant DISPLAY_ACTIVE_HOLD_MS après une entrée
+ * - au repos, les créneaux sans rien à dessiner sont sautés ; lv_timer_handler()
+ *   n'est appelé que toutes les DISPLAY_IDLE_REFRESH_PERIOD_MS pour ses timers
+ * - une entrée (encodeur, bouton) rétablit immédiatement la pleine cadence et
+ *   réveille la tâche UI (Ili9341LvglBridge::requestService())
+ * - la tâche UI se réveille au plus tard au prochain créneau ou au prochain
+ *   timer LVGL, le plus proche des deux
  */
-class DisplayManagerAdapter : public IDisplayManager {
+class DisplayManagerAdapter : public IDisplayManager, public EventListener {
 public:
+    /**
+     * @brief Statistiques de cadence
+     */
+    struct PacingStats {
+        uint32_t frames_rendered = 0;        ///< Créneaux avec zones à dessiner
+        uint32_t frames_skipped = 0;         ///< Créneaux sautés (rien à dessiner)
+        uint32_t housekeeping_calls = 0;     ///< lv_timer_handler() au repos, sans rendu
+        uint32_t ramp_ups = 0;               ///< Retours immédiats à pleine cadence
+        // Dernière fenêtre d'une seconde
+        uint32_t rendered_per_s = 0;
+        uint32_t skipped_per_s = 0;
+        uint32_t handler_us_per_s = 0;       ///< CPU passé dans lv_timer_handler()
+        bool active = false;                 ///< Pleine cadence en cours
+    };
+
     /**
      * @brief Constructeur avec bridge LVGL
      * @param lvglBridge Bridge pour l'affichage LVGL
+     * @param eventBus Bus d'événements (entrées utilisateur), optionnel
      */
-    explicit DisplayManagerAdapter(std::shared_ptr<Ili9341LvglBridge> lvglBridge);
-    
+    explicit DisplayManagerAdapter(std::shared_ptr<Ili9341LvglBridge> lvglBridge,
+                                   std::shared_ptr<MidiController::Events::IEventBus> eventBus = nullptr);
+
     /**
-     * @brief Destructeur par défaut
+     * @brief Destructeur
      */
-    ~DisplayManagerAdapter() override = default;
-    
+    ~DisplayManagerAdapter() override;
+
     /**
      * @brief Met à jour l'affichage si nécessaire
-     * 
+     *
      * Vérifie le timing et rafraîchit l'écran uniquement si l'intervalle
      * requis s'est écoulé pour optimiser les performances.
      */
     void update() override;
-    
+
     /**
      * @brief Force un rafraîchissement immédiat de l'affichage
      */
     void forceRefresh() override;
-    
+
     /**
      * @brief Configure l'intervalle de rafraîchissement
      * @param intervalMs Intervalle en millisecondes
      */
     void setRefreshInterval(unsigned long intervalMs) override;
-    
+
     /**
      * @brief Obtient l'intervalle de rafraîchissement actuel
      * @return Intervalle en millisecondes
      */
     unsigned long getRefreshInterval() const override;
 
+    /**
+     * @brief Signale une activité utilisateur (retour immédiat à pleine cadence)
+     *
+     * Peut être appelé hors de la tâche UI : au passage repos -> pleine cadence,
+     * la tâche UI est réveillée sans attendre son délai de sommeil.
+     */
+    void notifyActivity();
+
+    /**
+     * @brief Reçoit les événements d'entrée
+     * @return false : l'événement reste disponible pour les autres abonnés
+     */
+    bool onEvent(const Event& event) override;
+
+    /**
+     * @brief Obtient les statistiques de cadence
+     */
+    const PacingStats& getPacingStats() const { return stats_; }
+
+    /**
+     * @brief Remet à zéro les statistiques de cadence
+     */
+    void resetPacingStats();
+
+    /**
+     * @brief Affiche les statistiques de cadence sur le port série
+     */
+    void printPacingStats() const;
+
 private:
     std::shared_ptr<Ili9341LvglBridge> lvglBridge_;
+    std::shared_ptr<MidiController::Events::IEventBus> eventBus_;
+    SubscriptionId subscriptionId_;
     unsigned long refreshIntervalMs_;
-    unsigned long lastRefreshTime_;
-    
+    unsigned long lastRefreshTime_;     ///< Dernier appel à lv_timer_handler()
+    unsigned long lastSlotTime_;        ///< Dernier créneau de trame (rendu ou sauté)
+    unsigned long lastActivityTime_;
+    bool rampUp_;
+    uint32_t lvglTimerDelayMs_;         ///< Délai du prochain timer LVGL au dernier appel
+
+    // Fenêtre de mesure d'une seconde
+    PacingStats stats_;
+    unsigned long windowStart_;
+    uint32_t windowRendered_;
+    uint32_t windowSkipped_;
+    uint64_t windowHandlerStartUs_;
+
+    /**
+     * @brief Appelle lv_timer_handler() via le bridge
+     */
+    void refresh(unsigned long now);
+
+    /**
+     * @brief Temps restant avant le prochain timer LVGL
+     * @return Millisecondes, ULONG_MAX si aucun timer n'est actif
+     */
+    unsigned long lvglTimerRemainingMs(unsigned long now) const;
+
+    /**
+     * @brief Clôt la fenêtre de mesure d'une seconde si elle est écoulée
+     */
+    void rollStatsWindow(unsigned long now);
+
     /**
      * @brief Obtient le temps actuel en millisecondes
      * @return Temps actuel
      */
     unsigned long getCurrentTime() const;
-};
\ No newline at end of file
+};
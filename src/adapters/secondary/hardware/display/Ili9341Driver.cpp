@@ -122,6 +122,14 @@ void Ili9341Driver::updateRegion(bool redraw_now, uint16_t* pixels, int x1, int
     tft_->updateRegion(redraw_now, pixels, x1, x2, y1, y2);
 }
 
+bool Ili9341Driver::isTransferActive() const {
+    if (!initialized_ || !tft_) {
+        return false;
+    }
+
+    return tft_->asyncUpdateActive();
+}
+
 void Ili9341Driver::updateFullScreen() {
     if (!initialized_ || !tft_) {
         return;
@@ -56,6 +56,14 @@ public:
     void updateRegion(bool redraw_now, uint16_t* pixels, 
                       int x1, int x2, int y1, int y2);
 
+    /**
+     * @brief Indique si un envoi DMA asynchrone est en cours
+     *
+     * Tant qu'il l'est, le framebuffer interne ne peut pas être modifié :
+     * updateRegion() attendrait la fin du transfert.
+     */
+    bool isTransferActive() const;
+
     /**
      * @brief Force update complet framebuffer
      */
@@ -15,9 +15,12 @@
 #include "config/SystemConstants.hpp"
 
 
-// Static DMAMEM buffers pour performance optimale - Taille selon orientation configurée
-DMAMEM static lv_color_t lvgl_buffer_1[SystemConstants::Display::LVGL_BUFFER_SIZE];
-DMAMEM static lv_color_t lvgl_buffer_2[SystemConstants::Display::LVGL_BUFFER_SIZE];
+// Buffers de rendu partiel RGB565 en DMAMEM : deux demi-buffers dans une trame
+// (2 octets par pixel, LV_COLOR_DEPTH 16)
+DMAMEM static uint16_t lvgl_frame[SystemConstants::Display::FRAMEBUFFER_SIZE];
+
+static_assert(2 * SystemConstants::Display::LVGL_BUFFER_SIZE <= SystemConstants::Display::FRAMEBUFFER_SIZE,
+              "Les deux buffers partiels doivent tenir dans la trame LVGL");
 
 // Instance statique pour callbacks
 static Ili9341LvglBridge* bridge_instance_ = nullptr;
@@ -25,7 +28,8 @@ static Ili9341LvglBridge* bridge_instance_ = nullptr;
 Ili9341LvglBridge::Ili9341LvglBridge(std::shared_ptr<Ili9341Driver> driver,
                                      const LvglConfig& config)
     : config_(config), driver_(std::move(driver)), initialized_(false),
-      display_(nullptr), lvgl_buf1_(nullptr), lvgl_buf2_(nullptr) {
+      display_(nullptr), lvgl_buf1_(nullptr), lvgl_buf2_(nullptr),
+      next_timer_ms_(LV_NO_TIMER_READY) {
     bridge_instance_ = this;
     // TODO DEBUG MSG
 }
@@ -79,12 +83,105 @@ Result<void> Ili9341LvglBridge::initialize() {
     return Result<void>::success();
 }
 
+void Ili9341LvglBridge::resetRenderStats() {
+    frame_profiler_.reset();
+    flush_profiler_.reset();
+    flush_stats_ = FlushStats{};
+}
+
+void Ili9341LvglBridge::printRenderStats() const {
+    Serial.printf("LvglBridge frame avg/min/max us=%lu/%lu/%lu flush avg/max us=%lu/%lu\n",
+                  frame_profiler_.getAverageUpdateTime(), frame_profiler_.getMinUpdateTime(),
+                  frame_profiler_.getMaxUpdateTime(), flush_profiler_.getAverageUpdateTime(),
+                  flush_profiler_.getMaxUpdateTime());
+
+    const uint32_t frames = flush_stats_.frames > 0 ? flush_stats_.frames : 1;
+    Serial.printf("LvglBridge per frame us: render=%lu transfer=%lu overlap=%lu wait=%lu "
+                  "(frames=%lu transfers=%lu deferred=%lu)\n",
+                  static_cast<unsigned long>(flush_stats_.render_us / frames),
+                  static_cast<unsigned long>(flush_stats_.transfer_us / frames),
+                  static_cast<unsigned long>(flush_stats_.overlap_us / frames),
+                  static_cast<unsigned long>(flush_stats_.wait_us / frames),
+                  static_cast<unsigned long>(flush_stats_.frames),
+                  static_cast<unsigned long>(flush_stats_.transfers),
+                  static_cast<unsigned long>(flush_stats_.deferred_flushes));
+}
+
+bool Ili9341LvglBridge::serviceFlush() {
+    pollTransfer();
+
+    if (pending_flush_.active && !transfer_active_) {
+        pending_flush_.active = false;
+        submitToDriver(pending_flush_.area, pending_flush_.px_map, pending_flush_.last);
+        lv_display_flush_ready(display_);
+    }
+
+    return pending_flush_.active || transfer_active_;
+}
+
+bool Ili9341LvglBridge::pollTransfer() {
+    if (!transfer_active_ || driver_->isTransferActive()) {
+        return transfer_active_;
+    }
+
+    const uint32_t end = micros();
+    transfer_active_ = false;
+    flush_stats_.transfers++;
+    flush_stats_.transfer_us += end - transfer_start_us_;
+
+    // Recouvrement : partie du transfert pendant laquelle LVGL rendait
+    const uint32_t window_end = rendering_ ? end : render_end_us_;
+    const uint32_t from = static_cast<int32_t>(render_start_us_ - transfer_start_us_) > 0
+                              ? render_start_us_
+                              : transfer_start_us_;
+    const uint32_t to = static_cast<int32_t>(window_end - end) < 0 ? window_end : end;
+    if (static_cast<int32_t>(to - from) > 0) {
+        const uint32_t overlap = to - from;
+        if (overlap > transfer_wait_us_) {
+            flush_stats_.overlap_us += overlap - transfer_wait_us_;
+        }
+    }
+    transfer_wait_us_ = 0;
+    return false;
+}
+
+void Ili9341LvglBridge::submitToDriver(const lv_area_t& area, uint8_t* px_map, bool last) {
+    flush_profiler_.startMeasurement();
+    // Copie de la bande ; l'envoi DMA n'est lancé qu'avec la dernière
+    driver_->updateRegion(last, reinterpret_cast<uint16_t*>(px_map),
+                          area.x1, area.x2, area.y1, area.y2);
+    flush_profiler_.endMeasurement();
+
+    if (last && driver_->isTransferActive()) {
+        transfer_active_ = true;
+        transfer_start_us_ = micros();
+        transfer_wait_us_ = 0;
+    }
+}
+
 void Ili9341LvglBridge::refreshDisplay() {
     if (!initialized_) {
         return;
     }
 
-    lv_timer_handler();
+    // Terminer le flush laissé en attente par la trame précédente
+    serviceFlush();
+
+    const uint32_t start = micros();
+    next_timer_ms_ = lv_timer_handler();
+    timer_handler_us_ += micros() - start;
+
+    // Flush ou transfert en cours : revenir rapidement pour le terminer
+    if ((pending_flush_.active || transfer_active_) && next_timer_ms_ > 1) {
+        next_timer_ms_ = 1;
+    }
+}
+
+void Ili9341LvglBridge::setNextServiceDelayMs(uint32_t delayMs) {
+    next_timer_ms_ = delayMs;
+    if ((pending_flush_.active || transfer_active_) && next_timer_ms_ > 1) {
+        next_timer_ms_ = 1;
+    }
 }
 
 bool Ili9341LvglBridge::setupLvglCore() {
@@ -107,28 +204,37 @@ bool Ili9341LvglBridge::setupLvglDisplay() {
         return false;
     }
     
-    // Configurer les buffers
+    // Configurer les buffers (rendu partiel)
     lv_display_set_buffers(display_,
                            lvgl_buf1_,
                            lvgl_buf2_,
-                           SystemConstants::Display::LVGL_BUFFER_SIZE * sizeof(lv_color_t),
+                           SystemConstants::Display::LVGL_BUFFER_SIZE * sizeof(uint16_t),
                            LV_DISPLAY_RENDER_MODE_PARTIAL);
 
     // Définir callback flush
     lv_display_set_flush_cb(display_, flush_callback);
+    lv_display_set_flush_wait_cb(display_, flush_wait_callback);
     
     // Stocker référence dans user_data pour callback
     lv_display_set_user_data(display_, this);
 
+    // Signaler les invalidations pour réveiller la tâche UI
+    lv_display_add_event_cb(display_, invalidate_callback, LV_EVENT_INVALIDATE_AREA, this);
+
+    // Mesurer la durée des trames rendues
+    lv_display_add_event_cb(display_, render_callback, LV_EVENT_RENDER_START, this);
+    lv_display_add_event_cb(display_, render_callback, LV_EVENT_RENDER_READY, this);
+
     // TODO DEBUG MSG
     return true;
 }
 
 bool Ili9341LvglBridge::allocateLvglBuffers() {
-    // Utiliser les buffers statiques DMAMEM
-    lvgl_buf1_ = lvgl_buffer_1;
-    lvgl_buf2_ = config_.double_buffering ? lvgl_buffer_2 : nullptr;
-    
+    // Utiliser la trame statique DMAMEM
+    lvgl_buf1_ = lvgl_frame;
+    lvgl_buf2_ = config_.double_buffering ? lvgl_frame + SystemConstants::Display::LVGL_BUFFER_SIZE
+                                          : nullptr;
+
     // TODO DEBUG MSG
     return true;
 }
@@ -155,14 +261,73 @@ void Ili9341LvglBridge::flush_callback(lv_display_t* disp, const lv_area_t* area
         lv_display_flush_ready(disp);
         return;
     }
-    // Conversion coordinates LVGL vers hardware
-    int x1 = area->x1;
-    int y1 = area->y1;
-    int x2 = area->x2;
-    int y2 = area->y2;
-    
-    // Appel driver hardware
-    bridge->driver_->updateRegion(true, reinterpret_cast<uint16_t*>(px_map), x1, x2, y1, y2);
-    // // Signal LVGL que le flush est terminé
+
+    const bool last = lv_display_flush_is_last(disp);
+
+    // DMA occupé : mettre la zone en attente, LVGL continue dans l'autre buffer
+    if (bridge->pollTransfer()) {
+        bridge->pending_flush_ = {true, *area, px_map, last};
+        bridge->flush_stats_.deferred_flushes++;
+        return;
+    }
+
+    bridge->submitToDriver(*area, px_map, last);
+    // Signal LVGL que le flush est terminé (zone copiée dans le framebuffer du driver)
     lv_display_flush_ready(disp);
-}
\ No newline at end of file
+}
+
+void Ili9341LvglBridge::flush_wait_callback(lv_display_t* disp) {
+    auto* bridge = getInstance(disp);
+    if (!bridge) {
+        return;
+    }
+
+    const uint32_t start = micros();
+    while (bridge->pending_flush_.active) {
+        bridge->serviceFlush();
+    }
+    const uint32_t waited = micros() - start;
+
+    bridge->flush_stats_.wait_us += waited;
+    bridge->frame_wait_us_ += waited;
+    bridge->transfer_wait_us_ += waited;
+}
+
+void Ili9341LvglBridge::invalidate_callback(lv_event_t* event) {
+    auto* bridge = static_cast<Ili9341LvglBridge*>(lv_event_get_user_data(event));
+    if (!bridge) {
+        return;
+    }
+
+    bridge->invalidated_ = true;
+    if (bridge->invalidate_callback_) {
+        bridge->invalidate_callback_();
+    }
+}
+
+void Ili9341LvglBridge::render_callback(lv_event_t* event) {
+    auto* bridge = static_cast<Ili9341LvglBridge*>(lv_event_get_user_data(event));
+    if (!bridge) {
+        return;
+    }
+
+    const uint32_t now = micros();
+    if (lv_event_get_code(event) == LV_EVENT_RENDER_START) {
+        // LVGL refuse les invalidations pendant le rendu : tout est pris en compte ici
+        bridge->invalidated_ = false;
+        bridge->frame_profiler_.startMeasurement();
+        bridge->rendering_ = true;
+        bridge->render_start_us_ = now;
+        bridge->frame_wait_us_ = 0;
+    } else {
+        bridge->frame_profiler_.endMeasurement();
+        bridge->rendering_ = false;
+        bridge->render_end_us_ = now;
+
+        const uint32_t elapsed = now - bridge->render_start_us_;
+        const uint32_t render = elapsed > bridge->frame_wait_us_ ? elapsed - bridge->frame_wait_us_ : 0;
+        bridge->flush_stats_.frames++;
+        bridge->flush_stats_.render_us += render;
+        bridge->flush_stats_.last_render_us = render;
+    }
+}
@@ -2,8 +2,10 @@
 
 #include "Ili9341Driver.hpp"
 #include "config/SystemConstants.hpp"
+#include "core/utils/DisplayProfiler.hpp"
 #include "core/utils/Result.hpp"
 #include <lvgl.h>
+#include <functional>
 #include <memory>
 
 /**
@@ -13,15 +15,41 @@
  * - Configuration LVGL display
  * - Callbacks LVGL vers hardware
  * - Gestion buffers LVGL
+ *
+ * Rendu partiel : LVGL dessine dans deux demi-buffers RGB565 en DMAMEM,
+ * chaque zone est copiée dans le framebuffer du driver (updateRegion).
+ *
+ * Le flush est asynchrone : tant que le DMA du driver envoie la trame
+ * précédente, la zone est mise en attente sans appeler
+ * lv_display_flush_ready(), et LVGL rend la bande suivante dans l'autre
+ * buffer. La zone est transmise, puis signalée prête, dès la fin du
+ * transfert (serviceFlush(), ou flush_wait_cb si LVGL doit l'attendre).
  */
 class Ili9341LvglBridge {
 public:
+    /**
+     * @brief Compteurs du pipeline de flush (temps cumulés en microsecondes)
+     *
+     * Les fins de transfert sont observées par scrutation : transfer_us est
+     * majoré de l'intervalle de scrutation.
+     */
+    struct FlushStats {
+        uint32_t frames = 0;            ///< Trames rendues
+        uint32_t transfers = 0;         ///< Envois DMA terminés
+        uint32_t deferred_flushes = 0;  ///< Zones mises en attente (DMA occupé)
+        uint64_t render_us = 0;         ///< Rendu LVGL, attentes de flush exclues
+        uint64_t transfer_us = 0;       ///< Transferts DMA
+        uint64_t overlap_us = 0;        ///< Transferts recouverts par du rendu
+        uint64_t wait_us = 0;           ///< LVGL bloqué en attente de flush
+        uint32_t last_render_us = 0;    ///< Rendu de la dernière trame
+    };
+
     /**
      * @brief Configuration LVGL
      */
     struct LvglConfig {
         uint16_t buffer_lines = SystemConstants::Display::LVGL_BUFFER_LINES;  ///< Utilise SystemConstants
-        bool double_buffering = true;      ///< Activer double buffering
+        bool double_buffering = true;      ///< Activer double buffering (mode partiel)
     };
 
     /**
@@ -63,6 +91,83 @@ public:
      */
     void refreshDisplay();
 
+    /**
+     * @brief Durée des trames rendues (LV_EVENT_RENDER_START -> RENDER_READY)
+     */
+    const DisplayProfiler& getFrameProfiler() const { return frame_profiler_; }
+
+    /**
+     * @brief Durée des envois au driver (par zone rendue)
+     */
+    const DisplayProfiler& getFlushProfiler() const { return flush_profiler_; }
+
+    /**
+     * @brief Compteurs rendu / transfert / recouvrement
+     */
+    const FlushStats& getFlushStats() const { return flush_stats_; }
+
+    /**
+     * @brief Termine le flush en attente si le transfert DMA précédent est fini
+     * @return true si un flush ou un transfert est encore en cours
+     */
+    bool serviceFlush();
+
+    /**
+     * @brief Remet à zéro les mesures de rendu
+     */
+    void resetRenderStats();
+
+    /**
+     * @brief Affiche les mesures de rendu sur le port série
+     */
+    void printRenderStats() const;
+
+    /**
+     * @brief Délai avant le prochain timer LVGL, mesuré au dernier refreshDisplay()
+     * @return Délai en millisecondes, LV_NO_TIMER_READY si aucun timer n'est actif
+     */
+    uint32_t getTimeUntilNextRefreshMs() const { return next_timer_ms_; }
+
+    /**
+     * @brief Callback de réveil de la tâche UI, appelé quand LVGL invalide une zone
+     * ou sur requestService()
+     */
+    void setInvalidateCallback(std::function<void()> callback) {
+        invalidate_callback_ = std::move(callback);
+    }
+
+    /**
+     * @brief Demande un passage de la tâche UI sans invalidation (activité utilisateur)
+     */
+    void requestService() {
+        if (invalidate_callback_) {
+            invalidate_callback_();
+        }
+    }
+
+    /**
+     * @brief Indique si des zones invalidées attendent le prochain rendu
+     */
+    bool hasInvalidatedAreas() const { return invalidated_; }
+
+    /**
+     * @brief Indique si des animations LVGL sont en cours
+     */
+    bool hasRunningAnimations() const { return lv_anim_count_running() > 0; }
+
+    /**
+     * @brief Temps CPU cumulé passé dans lv_timer_handler() (microsecondes)
+     */
+    uint64_t getTimerHandlerTimeUs() const { return timer_handler_us_; }
+
+    /**
+     * @brief Remplace le délai avant le prochain service (cadence imposée par l'appelant)
+     *
+     * Un flush ou un transfert en cours garde un délai d'au plus 1 ms.
+     * @param delayMs Délai en millisecondes
+     */
+    void setNextServiceDelayMs(uint32_t delayMs);
+
 private:
     // Configuration
     LvglConfig config_;
@@ -71,8 +176,35 @@ private:
 
     // LVGL objets
     lv_display_t* display_;
-    lv_color_t* lvgl_buf1_;
-    lv_color_t* lvgl_buf2_;
+    uint16_t* lvgl_buf1_;
+    uint16_t* lvgl_buf2_;
+
+    // Mesures de rendu
+    DisplayProfiler frame_profiler_;
+    DisplayProfiler flush_profiler_;
+
+    // Pipeline de flush asynchrone
+    struct PendingFlush {
+        bool active = false;
+        lv_area_t area{};
+        uint8_t* px_map = nullptr;
+        bool last = false;
+    };
+    PendingFlush pending_flush_;
+    bool transfer_active_ = false;
+    uint32_t transfer_start_us_ = 0;
+    uint32_t transfer_wait_us_ = 0;   ///< Attente LVGL pendant le transfert courant
+    bool rendering_ = false;
+    uint32_t render_start_us_ = 0;
+    uint32_t render_end_us_ = 0;
+    uint32_t frame_wait_us_ = 0;      ///< Attente LVGL pendant la trame courante
+    FlushStats flush_stats_;
+
+    // Réveil de la tâche UI
+    std::function<void()> invalidate_callback_;
+    uint32_t next_timer_ms_;
+    bool invalidated_ = true;          ///< Zones invalidées depuis le dernier rendu
+    uint64_t timer_handler_us_ = 0;    ///< Temps cumulé dans lv_timer_handler()
 
     /**
      * @brief Configure LVGL global (tick, mémoire)
@@ -89,6 +221,17 @@ private:
      */
     bool allocateLvglBuffers();
 
+    /**
+     * @brief Copie une zone dans le framebuffer du driver, lance l'envoi si dernière zone
+     */
+    void submitToDriver(const lv_area_t& area, uint8_t* px_map, bool last);
+
+    /**
+     * @brief Détecte la fin du transfert DMA en cours et la comptabilise
+     * @return true si un transfert est encore en cours
+     */
+    bool pollTransfer();
+
     /**
      * @brief Libère buffers LVGL
      */
@@ -101,6 +244,21 @@ private:
      */
     static void flush_callback(lv_display_t* disp, const lv_area_t* area, uint8_t* px_map);
 
+    /**
+     * @brief Callback d'attente LVGL : termine le flush en attente
+     */
+    static void flush_wait_callback(lv_display_t* disp);
+
+    /**
+     * @brief Callback LV_EVENT_INVALIDATE_AREA du display
+     */
+    static void invalidate_callback(lv_event_t* event);
+
+    /**
+     * @brief Callbacks LV_EVENT_RENDER_START / RENDER_READY (mesure des trames)
+     */
+    static void render_callback(lv_event_t* event);
+
     /**
      * @brief Récupère instance depuis display LVGL
      */
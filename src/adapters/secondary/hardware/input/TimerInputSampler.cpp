@@ -0,0 +1,177 @@
+// adapters/secondary/hardware/input/TimerInputSampler.cpp
+#include "adapters/secondary/hardware/input/TimerInputSampler.hpp"
+
+#include <Arduino.h>
+
+TimerInputSampler::TimerInputSampler(DigitalButtonManager* buttons, EncoderManager* encoders)
+    : buttons_(buttons), encoders_(encoders) {}
+
+TimerInputSampler::~TimerInputSampler() {
+    stop();
+}
+
+bool TimerInputSampler::start(uint32_t periodUs) {
+    stop();
+
+    if (encoders_ && encoders_->size() > lastCounts_.size()) {
+        Serial.print("[TimerInputSampler] ERROR: Too many encoders for timer sampling: ");
+        Serial.println(static_cast<unsigned>(encoders_->size()));
+        return false;
+    }
+
+    // Seuls les changements sont poussés : partir des compteurs actuels
+    encoderCount_ = encoders_ ? static_cast<uint8_t>(encoders_->size()) : 0;
+    for (uint8_t i = 0; i < encoderCount_; ++i) {
+        lastCounts_[i] = encoders_->readCount(i);
+    }
+
+    if (buttons_) {
+        buttons_->useTimerSampling(periodUs);
+    }
+
+    periodUs_ = periodUs;
+    lastScanUs_ = micros();
+    if (!timer_.begin(&TimerInputSampler::onTimer, this, periodUs)) {
+        if (buttons_) {
+            buttons_->usePolling();
+        }
+        return false;
+    }
+    return true;
+}
+
+void TimerInputSampler::stop() {
+    if (!timer_.isRunning()) {
+        return;
+    }
+
+    timer_.end();
+    if (buttons_) {
+        buttons_->usePolling();
+    }
+}
+
+void TimerInputSampler::onTimer(void* context) {
+    static_cast<TimerInputSampler*>(context)->sample();
+}
+
+void TimerInputSampler::sample() {
+    const uint32_t nowUs = micros();
+
+    // Gigue : écart entre l'intervalle réel et la période nominale
+    if (scans_ > 0) {
+        const uint32_t intervalUs = nowUs - lastScanUs_;
+        const uint32_t jitterUs =
+            intervalUs > periodUs_ ? intervalUs - periodUs_ : periodUs_ - intervalUs;
+        jitterSumUs_ += jitterUs;
+        if (jitterUs > maxJitterUs_) {
+            maxJitterUs_ = jitterUs;
+        }
+    }
+    lastScanUs_ = nowUs;
+
+    // Chaque période produit un instantané, même inchangé : l'anti-rebond
+    // compte les échantillons
+    if (buttons_) {
+        push({nowUs, buttons_->sampleDirect(), buttons_->sampleMuxStep()});
+    }
+    if (encoderCount_ > 0) {
+        sampleEncoders(nowUs);
+    }
+
+    const uint32_t scanUs = micros() - nowUs;
+    if (scanUs > maxScanUs_) {
+        maxScanUs_ = scanUs;
+    }
+    scans_ = scans_ + 1;
+}
+
+void TimerInputSampler::push(const RawSample& sample) {
+    if (queue_.write(sample)) {
+        eventsProduced_ = eventsProduced_ + 1;
+    } else {
+        eventsDropped_ = eventsDropped_ + 1;
+    }
+}
+
+void TimerInputSampler::sampleEncoders(uint32_t nowUs) {
+    for (uint8_t i = 0; i < encoderCount_; ++i) {
+        const int32_t count = encoders_->readCount(i);
+        if (count == lastCounts_[i]) {
+            continue;
+        }
+
+        // Compteur absolu : un relevé refusé (file pleine) est repris au tick suivant
+        if (encoderQueue_.write({nowUs, count, i})) {
+            lastCounts_[i] = count;
+            encoderEvents_ = encoderEvents_ + 1;
+        } else {
+            encoderRetries_ = encoderRetries_ + 1;
+        }
+    }
+}
+
+bool TimerInputSampler::pollEncoder(EncoderSample& sample) {
+    return encoderQueue_.read(sample);
+}
+
+bool TimerInputSampler::poll(RawSample& sample) {
+    const uint32_t depth = static_cast<uint32_t>(queue_.size());
+    if (depth > queueHighWater_) {
+        queueHighWater_ = depth;
+    }
+
+    if (!queue_.read(sample)) {
+        return false;
+    }
+
+    const uint32_t ageUs = micros() - sample.timestampUs;
+    ageSumUs_ += ageUs;
+    if (ageUs > maxAgeUs_) {
+        maxAgeUs_ = ageUs;
+    }
+    eventsConsumed_++;
+    return true;
+}
+
+TimerInputSampler::Stats TimerInputSampler::getStats() const {
+    Stats stats{};
+
+    noInterrupts();
+    stats.scans = scans_;
+    stats.max_jitter_us = maxJitterUs_;
+    stats.max_scan_us = maxScanUs_;
+    stats.events_produced = eventsProduced_;
+    stats.events_dropped = eventsDropped_;
+    stats.encoder_events = encoderEvents_;
+    stats.encoder_retries = encoderRetries_;
+    const uint64_t jitterSum = jitterSumUs_;
+    interrupts();
+
+    // Le premier scan n'a pas d'intervalle de référence
+    stats.avg_jitter_us = stats.scans > 1 ? static_cast<uint32_t>(jitterSum / (stats.scans - 1)) : 0;
+
+    stats.events_consumed = eventsConsumed_;
+    stats.max_age_us = maxAgeUs_;
+    stats.avg_age_us = eventsConsumed_ > 0 ? static_cast<uint32_t>(ageSumUs_ / eventsConsumed_) : 0;
+    stats.queue_high_water = queueHighWater_;
+    return stats;
+}
+
+void TimerInputSampler::resetStats() {
+    noInterrupts();
+    scans_ = 0;
+    jitterSumUs_ = 0;
+    maxJitterUs_ = 0;
+    maxScanUs_ = 0;
+    eventsProduced_ = 0;
+    eventsDropped_ = 0;
+    encoderEvents_ = 0;
+    encoderRetries_ = 0;
+    interrupts();
+
+    ageSumUs_ = 0;
+    eventsConsumed_ = 0;
+    maxAgeUs_ = 0;
+    queueHighWater_ = 0;
+}
@@ -0,0 +1,177 @@
+// adapters/secondary/hardware/input/TimerInputSampler.hpp
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "adapters/secondary/hardware/input/buttons/DigitalButtonManager.hpp"
+#include "adapters/secondary/hardware/input/encoders/EncoderManager.hpp"
+#include "adapters/secondary/hardware/timer/PeriodicTimer.hpp"
+#include "config/SystemConstants.hpp"
+#include "core/memory/RingBuffer.hpp"
+
+/**
+ * @brief Échantillonnage des boutons et encodeurs cadencé par un timer matériel
+ *
+ * À chaque tick, le callback de PeriodicTimer relève sans attente :
+ * - les pins directes (DigitalButtonManager::sampleDirect) ;
+ * - un canal du multiplexeur, sélectionné au tick précédent
+ *   (DigitalButtonManager::sampleMuxStep) : le balayage est une machine
+ *   d'états qui avance d'un canal par tick, la période servant de délai de
+ *   stabilisation ;
+ * - les compteurs des encodeurs, poussés seulement s'ils ont changé.
+ *
+ * Les relevés horodatés vont dans deux RingBuffer SPSC (producteur : timer,
+ * consommateur : InputManagerService::update) : un rendu LVGL long ne décale
+ * plus l'échantillonnage, et l'interruption ne fait ni attente ni écriture
+ * d'état partagé avec la tâche.
+ *
+ * Le consommateur rejoue chaque instantané de boutons, dans l'ordre, à
+ * travers l'anti-rebond (DigitalButtonManager::applySample) : une lecture
+ * n'y compte qu'une fois, et seulement pour les boutons qu'elle couvre. Les
+ * relevés d'encodeurs sont convertis en crans avec leur horodatage
+ * (EncoderManager::applyCount), qui sert aussi à l'accélération.
+ */
+class TimerInputSampler {
+public:
+    static constexpr size_t QUEUE_SIZE = SystemConstants::Input::SAMPLER_QUEUE_SIZE;
+
+    /**
+     * @brief Instantané brut horodaté produit par le timer
+     */
+    struct RawSample {
+        uint32_t timestampUs;                  // micros() au moment de la lecture
+        DigitalButtonManager::Mask levels;     // Niveaux actifs des pins directes
+        DigitalButtonManager::MuxRead mux;     // Canal du multiplexeur lu à ce tick
+    };
+
+    /**
+     * @brief Compteur d'encodeur relevé par le timer (poussé s'il a changé)
+     */
+    struct EncoderSample {
+        uint32_t timestampUs;  // micros() au moment du relevé
+        int32_t count;         // Compteur brut de la bibliothèque Encoder
+        uint8_t index;         // Rang dans EncoderManager::getEncoders()
+    };
+
+    /**
+     * @brief Statistiques d'échantillonnage et de latence de consommation
+     */
+    struct Stats {
+        // Côté timer
+        uint32_t scans;             // Nombre de scans effectués
+        uint32_t max_jitter_us;     // Écart maximal |intervalle - période|
+        uint32_t avg_jitter_us;     // Écart moyen |intervalle - période|
+        uint32_t max_scan_us;       // Durée maximale d'un scan
+        uint32_t events_produced;   // Instantanés poussés dans la file
+        uint32_t events_dropped;    // Instantanés perdus (file pleine)
+        uint32_t encoder_events;    // Relevés d'encodeurs poussés
+        uint32_t encoder_retries;   // Relevés différés au tick suivant (file pleine)
+
+        // Côté consommateur
+        uint32_t events_consumed;   // Instantanés lus par la boucle principale
+        uint32_t max_age_us;        // Âge maximal d'un instantané à la consommation
+        uint32_t avg_age_us;        // Âge moyen d'un instantané à la consommation
+        uint32_t queue_high_water;  // Occupation maximale observée de la file
+    };
+
+    /**
+     * @brief Constructeur
+     * @param buttons Gestionnaire de boutons échantillonnés, ou nullptr
+     * @param encoders Gestionnaire d'encodeurs relevés, ou nullptr (lus par la tâche)
+     */
+    explicit TimerInputSampler(DigitalButtonManager* buttons, EncoderManager* encoders = nullptr);
+    ~TimerInputSampler();
+
+    TimerInputSampler(const TimerInputSampler&) = delete;
+    TimerInputSampler& operator=(const TimerInputSampler&) = delete;
+
+    /**
+     * @brief Démarre le timer et passe les seuils d'anti-rebond en périodes de timer
+     * @param periodUs Période d'échantillonnage en microsecondes
+     * @return false si aucun timer n'est disponible ou trop d'encodeurs
+     */
+    bool start(uint32_t periodUs);
+
+    /**
+     * @brief Arrête le timer et rend les seuils de la scrutation
+     */
+    void stop();
+
+    bool isRunning() const {
+        return timer_.isRunning();
+    }
+
+    /**
+     * @brief Indique si les encodeurs sont relevés par le timer
+     */
+    bool capturesEncoders() const {
+        return encoders_ != nullptr;
+    }
+
+    /**
+     * @brief Relève boutons et encodeurs, pousse les instantanés (appelé par le timer)
+     */
+    void sample();
+
+    /**
+     * @brief Lit le prochain instantané de boutons en attente (boucle principale)
+     * @param sample Instantané lu
+     * @return false si la file est vide
+     */
+    bool poll(RawSample& sample);
+
+    /**
+     * @brief Lit le prochain relevé d'encodeur en attente (boucle principale)
+     * @param sample Relevé lu
+     * @return false si la file est vide
+     */
+    bool pollEncoder(EncoderSample& sample);
+
+    /**
+     * @brief Indique si des relevés attendent d'être vidés (sans les consommer)
+     */
+    bool hasPending() const {
+        return !queue_.is_empty() || !encoderQueue_.is_empty();
+    }
+
+    /**
+     * @brief Copie cohérente des statistiques
+     */
+    Stats getStats() const;
+
+    void resetStats();
+
+private:
+    static void onTimer(void* context);
+
+    void push(const RawSample& sample);
+    void sampleEncoders(uint32_t nowUs);
+
+    DigitalButtonManager* buttons_;
+    EncoderManager* encoders_;
+
+    RingBuffer<RawSample, QUEUE_SIZE> queue_;
+    RingBuffer<EncoderSample, SystemConstants::Input::SAMPLER_ENCODER_QUEUE_SIZE> encoderQueue_;
+    PeriodicTimer timer_;
+    uint32_t periodUs_ = 0;
+
+    // Écrits par le timer uniquement
+    uint32_t lastScanUs_ = 0;
+    uint64_t jitterSumUs_ = 0;
+    volatile uint32_t scans_ = 0;
+    volatile uint32_t maxJitterUs_ = 0;
+    volatile uint32_t maxScanUs_ = 0;
+    volatile uint32_t eventsProduced_ = 0;
+    volatile uint32_t eventsDropped_ = 0;
+    volatile uint32_t encoderEvents_ = 0;
+    volatile uint32_t encoderRetries_ = 0;
+    std::array<int32_t, SystemConstants::Input::SAMPLER_MAX_ENCODERS> lastCounts_{};
+    uint8_t encoderCount_ = 0;
+
+    // Écrits par la boucle principale uniquement
+    uint64_t ageSumUs_ = 0;
+    uint32_t eventsConsumed_ = 0;
+    uint32_t maxAgeUs_ = 0;
+    uint32_t queueHighWater_ = 0;
+};
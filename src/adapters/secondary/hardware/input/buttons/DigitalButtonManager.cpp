@@ -1,18 +1,43 @@
 // adapters/secondary/hardware/input/buttons/DigitalButtonManager.cpp
 #include "adapters/secondary/hardware/input/buttons/DigitalButtonManager.hpp"
 #include "adapters/secondary/hardware/input/buttons/ButtonFactory.hpp"
+#include "adapters/secondary/hardware/multiplexer/MultiplexerManager.hpp"
+#include "core/utils/InputRecorder.hpp"
 
 #include <Arduino.h>
 
-DigitalButtonManager::DigitalButtonManager(const std::vector<ButtonConfig>& configs) {
+#include <bit>
+
+DigitalButtonManager::DigitalButtonManager(const std::vector<ButtonConfig>& configs,
+                                           uint32_t scanPeriodUs)
+    : scanPeriodUs_(scanPeriodUs) {
     ownedButtons_.reserve(configs.size());
     buttons_.reserve(configs.size());
 
     for (const auto& cfg : configs) {
+        if (ownedButtons_.size() >= MAX_BUTTONS) {
+            Serial.print("[DigitalButtonManager] ERROR: Too many buttons, ignoring ");
+            Serial.println(cfg.id);
+            continue;
+        }
+
         // Utiliser la factory pour créer le bouton unifié avec la bonne stratégie
         auto button = ButtonFactory::createButton(cfg);
 
         if (button) {
+            const size_t index = ownedButtons_.size();
+            sources_[index] = {cfg.gpio.pin, cfg.gpio.source == GpioPin::Source::MUX, cfg.debounceMs};
+            if (sources_[index].isMux) {
+                muxMask_ |= Mask{1} << index;
+                muxChannels_ |= static_cast<uint16_t>(1u << (cfg.gpio.pin & 0x0F));
+                channelButtons_[cfg.gpio.pin & 0x0F] |= Mask{1} << index;
+            } else {
+                directMask_ |= Mask{1} << index;
+            }
+            if (cfg.activeLow) {
+                activeLowMask_ |= Mask{1} << index;
+            }
+
             buttons_.push_back(button.get());
             ownedButtons_.push_back(std::move(button));
         } else {
@@ -20,14 +45,180 @@ DigitalButtonManager::DigitalButtonManager(const std::vector<ButtonConfig>& conf
             Serial.println(cfg.id);
         }
     }
+
+    // Tour du balayage étalé : canaux câblés dans l'ordre du code de Gray
+    for (uint8_t step = 0; step < muxSequence_.size(); ++step) {
+        const uint8_t channel = step ^ (step >> 1);
+        if ((muxChannels_ >> channel) & 0x01) {
+            muxSequence_[muxSequenceLength_++] = channel;
+        }
+    }
+
+    applyThresholds(scanPeriodUs_, scanPeriodUs_);
+
+    // État initial stable, sans changement signalé
+    const Mask raw = sampleDirect() | sampleMux();
+    debouncer_.reset(raw);
+    for (size_t i = 0; i < ownedButtons_.size(); ++i) {
+        ownedButtons_[i]->applyStableState((raw >> i) & 1);
+        refreshPressedBit(i);
+    }
 }
 
 DigitalButtonManager::~DigitalButtonManager() = default;
 
 void DigitalButtonManager::updateAll() {
-    for (auto& btn : ownedButtons_) {
-        btn->update();
+    scan();
+}
+
+DigitalButtonManager::Mask DigitalButtonManager::scan() {
+    return applySample(sampleDirect() | sampleMux());
+}
+
+DigitalButtonManager::Mask DigitalButtonManager::applySample(Mask active) {
+#ifdef INPUT_RECORDER
+    recordLevels(active, ~Mask{0}, micros());
+#endif
+    return applyLevels(active, ~Mask{0});
+}
+
+DigitalButtonManager::Mask DigitalButtonManager::applySample(Mask direct, MuxRead mux,
+                                                             uint32_t timestampUs) {
+    Mask sampled = directMask_;
+    Mask active = direct;
+    if (mux.channel < channelButtons_.size()) {
+        const Mask onChannel = channelButtons_[mux.channel];
+        sampled |= onChannel;
+        active |= ((mux.level ? onChannel : 0) ^ activeLowMask_) & onChannel;
+    }
+#ifdef INPUT_RECORDER
+    recordLevels(active, sampled, timestampUs);
+#else
+    (void)timestampUs;
+#endif
+    return applyLevels(active, sampled);
+}
+
+DigitalButtonManager::Mask DigitalButtonManager::applyLevels(Mask active, Mask sampled) {
+    const Mask before = pressedMask_;
+    Mask changed = debouncer_.update(active, sampled);
+    const Mask stable = debouncer_.getState();
+
+    while (changed) {
+        const size_t index = static_cast<size_t>(std::countr_zero(changed));
+        changed &= changed - 1;
+        ownedButtons_[index]->applyStableState((stable >> index) & 1);
+        refreshPressedBit(index);
+    }
+
+    return pressedMask_ ^ before;
+}
+
+DigitalButtonManager::Mask DigitalButtonManager::sampleDirect() const {
+    Mask raw = 0;
+    Mask pending = directMask_;
+    while (pending) {
+        const size_t index = static_cast<size_t>(std::countr_zero(pending));
+        pending &= pending - 1;
+        raw |= static_cast<Mask>(digitalRead(sources_[index].pin) ? 1 : 0) << index;
+    }
+
+    // Logique active-low appliquée à tous les bits en une opération
+    return (raw ^ activeLowMask_) & directMask_;
+}
+
+DigitalButtonManager::Mask DigitalButtonManager::sampleMux() {
+    if (muxMask_ == 0) {
+        return 0;
     }
+
+    // Un seul balayage du multiplexeur pour tous les boutons, limité aux canaux câblés
+    MultiplexerManager& mux = MultiplexerManager::getInstance();
+    mux.scanAll(muxChannels_);
+    const uint16_t muxSnapshot = mux.getSnapshot();
+
+    Mask raw = 0;
+    Mask pending = muxMask_;
+    while (pending) {
+        const size_t index = static_cast<size_t>(std::countr_zero(pending));
+        pending &= pending - 1;
+        raw |= static_cast<Mask>((muxSnapshot >> sources_[index].pin) & 1) << index;
+    }
+    return (raw ^ activeLowMask_) & muxMask_;
+}
+
+DigitalButtonManager::MuxRead DigitalButtonManager::sampleMuxStep() {
+    MuxRead read{NO_MUX_CHANNEL, false};
+    if (muxSequenceLength_ == 0) {
+        return read;
+    }
+
+    MultiplexerManager& mux = MultiplexerManager::getInstance();
+    if (muxStepPrimed_) {
+        read = {muxSequence_[muxStep_], mux.readDigital()};
+        muxStep_ = muxStep_ + 1 < muxSequenceLength_ ? muxStep_ + 1 : 0;
+    }
+
+    // Lu au pas suivant : la période du timer tient lieu de délai de stabilisation
+    mux.selectChannelDeferred(muxSequence_[muxStep_]);
+    muxStepPrimed_ = true;
+    return read;
+}
+
+void DigitalButtonManager::useTimerSampling(uint32_t tickUs) {
+    muxStep_ = 0;
+    muxStepPrimed_ = false;
+    applyThresholds(tickUs, tickUs * (muxSequenceLength_ > 0 ? muxSequenceLength_ : 1));
+}
+
+void DigitalButtonManager::usePolling() {
+    applyThresholds(scanPeriodUs_, scanPeriodUs_);
+}
+
+void DigitalButtonManager::applyThresholds(uint32_t directPeriodUs, uint32_t muxPeriodUs) {
+    for (size_t i = 0; i < ownedButtons_.size(); ++i) {
+        const uint32_t periodUs = sources_[i].isMux ? muxPeriodUs : directPeriodUs;
+        if (!debouncer_.setThreshold(
+                i, VerticalCounterDebouncer::samplesFor(sources_[i].debounceMs, periodUs))) {
+            Serial.print("[DigitalButtonManager] WARNING: Too many debounce thresholds, button ");
+            Serial.println(ownedButtons_[i]->getId());
+        }
+    }
+}
+
+#ifdef INPUT_RECORDER
+void DigitalButtonManager::recordLevels(Mask active, Mask sampled, uint32_t timestampUs) {
+    if (!InputRecorder::isRecording()) {
+        return;
+    }
+
+    // Nouvel enregistrement : état complet de chaque bouton à sa première lecture
+    if (recordedSession_ != InputRecorder::session()) {
+        recordedSession_ = InputRecorder::session();
+        recordedMask_ = 0;
+    }
+
+    sampled &= directMask_ | muxMask_;
+    Mask changed = ((active ^ recordedLevels_) | ~recordedMask_) & sampled;
+    recordedMask_ |= sampled;
+    recordedLevels_ = (recordedLevels_ & ~sampled) | (active & sampled);
+
+    while (changed) {
+        const size_t index = static_cast<size_t>(std::countr_zero(changed));
+        changed &= changed - 1;
+        const bool level = ((active ^ activeLowMask_) >> index) & 1;  // Niveau électrique
+        if (sources_[index].isMux) {
+            InputRecorder::recordMux(sources_[index].pin, level, timestampUs);
+        } else {
+            InputRecorder::recordPin(sources_[index].pin, level, timestampUs);
+        }
+    }
+}
+#endif
+
+void DigitalButtonManager::refreshPressedBit(size_t index) {
+    const Mask bit = Mask{1} << index;
+    pressedMask_ = ownedButtons_[index]->isPressed() ? (pressedMask_ | bit) : (pressedMask_ & ~bit);
 }
 
 const std::vector<ButtonPort*>& DigitalButtonManager::getButtons() const {
@@ -35,15 +226,17 @@ const std::vector<ButtonPort*>& DigitalButtonManager::getButtons() const {
 }
 
 void DigitalButtonManager::resetAllToggleStates() {
-    for (auto& btn : ownedButtons_) {
-        btn->resetState();  // Méthode directe sur UnifiedButton
+    for (size_t i = 0; i < ownedButtons_.size(); ++i) {
+        ownedButtons_[i]->resetState();  // Méthode directe sur UnifiedButton
+        refreshPressedBit(i);
     }
 }
 
 void DigitalButtonManager::resetToggleState(ButtonId buttonId) {
-    for (auto& btn : ownedButtons_) {
-        if (btn->getId() == buttonId) {
-            btn->resetState();  // Méthode directe sur UnifiedButton
+    for (size_t i = 0; i < ownedButtons_.size(); ++i) {
+        if (ownedButtons_[i]->getId() == buttonId) {
+            ownedButtons_[i]->resetState();  // Méthode directe sur UnifiedButton
+            refreshPressedBit(i);
             break;
         }
     }
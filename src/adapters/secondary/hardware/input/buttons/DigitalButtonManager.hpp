@@ -1,19 +1,51 @@
 // adapters/secondary/hardware/input/buttons/DigitalButtonManager.hpp
 #pragma once
 
+#include <array>
 #include <memory>
 #include <vector>
 
 #include "adapters/secondary/hardware/input/buttons/ButtonConfig.hpp"
 #include "adapters/secondary/hardware/input/buttons/UnifiedButton.hpp"
+#include "adapters/secondary/hardware/input/buttons/VerticalCounterDebouncer.hpp"
+#include "config/SystemConstants.hpp"
 #include "core/ports/input/ButtonPort.hpp"
 
 /**
  * @brief Manager pour plusieurs Button configurés dynamiquement.
+ *
+ * Le scan est groupé : un balayage du multiplexeur, une lecture des pins
+ * directes dans un mot de 64 bits (bit n = bouton n), puis un anti-rebond
+ * bit-parallèle (VerticalCounterDebouncer) qui fournit le masque des
+ * boutons ayant changé. Seuls ces boutons sont mis à jour.
+ *
+ * En mode timer, l'échantillonnage est scindé : sampleDirect() et
+ * sampleMuxStep() en interruption (pins directes, puis un seul canal du
+ * multiplexeur par tick, sans attente de stabilisation), applySample() dans
+ * la tâche d'entrée. L'état des boutons, pressedMask_ et l'anti-rebond ne
+ * sont donc modifiés que hors interruption. Un bouton du multiplexeur n'est
+ * lu qu'une fois par tour de canaux : son seuil d'anti-rebond est compté en
+ * tours (useTimerSampling()) et seules ses propres lectures le font avancer.
+ *
+ * Avec -DINPUT_RECORDER, les changements de niveau électrique des boutons
+ * lus sont enregistrés à l'entrée de l'anti-rebond (pin ou canal du
+ * multiplexeur), horodatés au relevé.
  */
 class DigitalButtonManager {
 public:
-    explicit DigitalButtonManager(const std::vector<ButtonConfig>& configs);
+    using Mask = VerticalCounterDebouncer::Mask;
+    static constexpr size_t MAX_BUTTONS = VerticalCounterDebouncer::MAX_INPUTS;
+    static constexpr uint8_t NO_MUX_CHANNEL = 0xFF;
+    static_assert(MAX_BUTTONS == SystemConstants::Buttons::MAX_BUTTONS,
+                  "La limite validée par la configuration doit suivre l'anti-rebond");
+
+    /**
+     * @brief Constructeur
+     * @param configs Configurations des boutons (64 au maximum)
+     * @param scanPeriodUs Période d'appel de scan(), pour convertir debounceMs en échantillons
+     */
+    explicit DigitalButtonManager(const std::vector<ButtonConfig>& configs,
+                                  uint32_t scanPeriodUs = SystemConstants::Performance::INPUT_TIME_INTERVAL);
     ~DigitalButtonManager();
 
     // Désactiver la copie
@@ -27,11 +59,132 @@ public:
     void updateAll();
     const std::vector<ButtonPort*>& getButtons() const;
 
+    /**
+     * @brief Échantillonne et débounce tous les boutons en une passe
+     * @return Masque des boutons dont isPressed() a changé (bit n = getButtons()[n])
+     */
+    Mask scan();
+
+    /**
+     * @brief Lit les boutons sur pins directes (bit à 1 = actif)
+     *
+     * Sans effet de bord ni attente : appelable depuis une interruption.
+     */
+    Mask sampleDirect() const;
+
+    /**
+     * @brief Balaye le multiplexeur et lit les boutons qui y sont câblés (bit à 1 = actif)
+     *
+     * Attentes de stabilisation du multiplexeur : jamais en interruption.
+     */
+    Mask sampleMux();
+
+    /**
+     * @brief Lecture brute d'un canal du multiplexeur
+     */
+    struct MuxRead {
+        uint8_t channel;  // Canal lu, NO_MUX_CHANNEL si aucun
+        bool level;       // Niveau électrique lu sur la pin de signal
+    };
+
+    /**
+     * @brief Pas du balayage étalé : lit un canal puis sélectionne le suivant
+     *
+     * Le canal lu est celui sélectionné au pas précédent, stabilisé depuis une
+     * période ; le premier pas ne fait que sélectionner. Les canaux câblés sont
+     * parcourus dans l'ordre du code de Gray. Sans attente : appelable depuis
+     * une interruption.
+     */
+    MuxRead sampleMuxStep();
+
+    /**
+     * @brief Débounce un échantillon et met à jour les boutons qui changent
+     * @param active Niveaux actifs de tous les boutons (sampleDirect() | sampleMux())
+     * @return Masque des boutons dont isPressed() a changé
+     */
+    Mask applySample(Mask active);
+
+    /**
+     * @brief Débounce un instantané du timer : pins directes et un canal du multiplexeur
+     *
+     * Seuls les boutons lus par cet instantané avancent dans l'anti-rebond.
+     * @param direct Niveaux actifs des pins directes (sampleDirect())
+     * @param mux Canal lu par sampleMuxStep()
+     * @param timestampUs Horodatage de l'instantané
+     * @return Masque des boutons dont isPressed() a changé
+     */
+    Mask applySample(Mask direct, MuxRead mux, uint32_t timestampUs);
+
+    /**
+     * @brief Seuils d'anti-rebond pour l'échantillonnage timer
+     *
+     * Pins directes lues à chaque tick, boutons du multiplexeur une fois par
+     * tour de canaux câblés. Repart du premier canal.
+     * @param tickUs Période du timer
+     */
+    void useTimerSampling(uint32_t tickUs);
+
+    /**
+     * @brief Revient aux seuils de scan(), tous les boutons lus à chaque période
+     */
+    void usePolling();
+
+    /**
+     * @brief Nombre de canaux du multiplexeur câblés (longueur d'un tour)
+     */
+    uint8_t getMuxChannelCount() const {
+        return muxSequenceLength_;
+    }
+
+    /**
+     * @brief État isPressed() de tous les boutons (bit n = getButtons()[n])
+     */
+    Mask getPressedMask() const {
+        return pressedMask_;
+    }
+
     // Nouvelles méthodes pour contrôler les boutons
     void resetAllToggleStates();               // Réinitialiser tous les boutons toggle
     void resetToggleState(ButtonId buttonId);  // Réinitialiser un bouton toggle spécifique
 
 private:
+    /**
+     * @brief Source matérielle d'un bouton, résolue une fois à la construction
+     */
+    struct InputSource {
+        uint8_t pin;  // Pin MCU ou canal du multiplexeur
+        bool isMux;
+        uint16_t debounceMs;
+    };
+
+    void refreshPressedBit(size_t index);
+    Mask applyLevels(Mask active, Mask sampled);
+#ifdef INPUT_RECORDER
+    void recordLevels(Mask active, Mask sampled, uint32_t timestampUs);
+#endif
+    void applyThresholds(uint32_t directPeriodUs, uint32_t muxPeriodUs);
+
     std::vector<std::unique_ptr<UnifiedButton>> ownedButtons_;  // possession des boutons unifiés
     std::vector<ButtonPort*> buttons_;                          // pointeurs pour use-cases
+
+    std::array<InputSource, MAX_BUTTONS> sources_{};
+    Mask activeLowMask_ = 0;
+    Mask directMask_ = 0;  // Boutons sur pins MCU
+    Mask muxMask_ = 0;     // Boutons sur le multiplexeur
+    uint16_t muxChannels_ = 0;  // Canaux du multiplexeur câblés (bit n = canal n)
+    std::array<Mask, 16> channelButtons_{};  // Boutons câblés sur chaque canal
+    uint32_t scanPeriodUs_;
+
+    // Balayage étalé (écrit par l'interruption du timer uniquement)
+    std::array<uint8_t, 16> muxSequence_{};  // Canaux câblés, ordre du code de Gray
+    uint8_t muxSequenceLength_ = 0;
+    uint8_t muxStep_ = 0;
+    bool muxStepPrimed_ = false;
+    VerticalCounterDebouncer debouncer_;
+    Mask pressedMask_ = 0;
+#ifdef INPUT_RECORDER
+    Mask recordedLevels_ = 0;  // Derniers niveaux actifs enregistrés
+    Mask recordedMask_ = 0;    // Boutons déjà enregistrés dans la session
+    uint32_t recordedSession_ = 0;
+#endif
 };
\ No newline at end of file
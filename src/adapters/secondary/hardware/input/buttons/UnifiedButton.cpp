@@ -41,9 +41,6 @@ void UnifiedButton::update() {
     // Lire l'état actuel (déjà débouncé par Bounce2)
     bool currentState = readCurrentState();
 
-    // Détecter un front montant
-    bool rising = currentState && !lastState_;
-
     // Debug : afficher les changements d'état (optionnel)
     #ifdef DEBUG_UNIFIED_BUTTONS
     bool stateChanged = currentState != lastState_;
@@ -55,7 +52,12 @@ void UnifiedButton::update() {
     }
     #endif
 
-    lastState_ = currentState;
+    applyStableState(currentState);
+}
+
+void UnifiedButton::applyStableState(bool active) {
+    const bool rising = active && !lastState_;
+    lastState_ = active;
 
     // Gérer selon le mode
     if (cfg_.mode == ButtonMode::TOGGLE) {
@@ -64,7 +66,7 @@ void UnifiedButton::update() {
         }
         pressed_ = toggleState_;
     } else {
-        pressed_ = currentState;
+        pressed_ = active;
     }
 }
 
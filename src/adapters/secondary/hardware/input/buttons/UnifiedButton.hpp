@@ -26,6 +26,16 @@ public:
     ButtonId getId() const override;
     void resetState() override;
 
+    /**
+     * @brief Applique un état déjà débouncé (scan groupé de DigitalButtonManager)
+     * @param active État logique après application d'activeLow
+     */
+    void applyStableState(bool active);
+
+    const ButtonConfig& getConfig() const {
+        return cfg_;
+    }
+
 private:
     ButtonConfig cfg_;
     std::unique_ptr<IPinReader> pinReader_;
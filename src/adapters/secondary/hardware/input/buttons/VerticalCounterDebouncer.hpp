@@ -0,0 +1,147 @@
+// adapters/secondary/hardware/input/buttons/VerticalCounterDebouncer.hpp
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Anti-rebond bit-parallèle à compteurs verticaux
+ *
+ * Chaque bit du mot représente un bouton. Le compteur de chaque bouton est
+ * réparti sur COUNTER_BITS plans de bits (bit n du plan p = bit p du compteur
+ * du bouton n) : l'incrémentation et la remise à zéro de tous les compteurs
+ * se font en quelques opérations logiques par échantillon.
+ *
+ * Un bouton change d'état stable après `threshold` échantillons consécutifs
+ * différents de cet état. Les seuils par bouton (issus de debounceMs) sont
+ * regroupés en classes : la comparaison coûte COUNTER_BITS opérations par
+ * seuil distinct, et non par bouton.
+ */
+class VerticalCounterDebouncer {
+public:
+    using Mask = uint64_t;
+
+    static constexpr size_t MAX_INPUTS = 64;
+    static constexpr uint8_t COUNTER_BITS = 6;
+    static constexpr uint8_t MAX_THRESHOLD = (1 << COUNTER_BITS) - 1;
+    static constexpr size_t MAX_THRESHOLD_CLASSES = 8;
+
+    VerticalCounterDebouncer() = default;
+
+    /**
+     * @brief Définit le seuil d'un bouton en nombre d'échantillons
+     * @param index Bit du bouton (0-63)
+     * @param samples Échantillons consécutifs requis (borné à 1..MAX_THRESHOLD)
+     * @return false si l'index est invalide ou si trop de seuils distincts
+     */
+    bool setThreshold(size_t index, uint8_t samples) {
+        if (index >= MAX_INPUTS) {
+            return false;
+        }
+        samples = samples == 0 ? 1 : (samples > MAX_THRESHOLD ? MAX_THRESHOLD : samples);
+
+        const Mask bit = Mask{1} << index;
+        for (size_t c = 0; c < classCount_; ++c) {
+            classes_[c].members &= ~bit;
+        }
+
+        for (size_t c = 0; c < classCount_; ++c) {
+            if (classes_[c].threshold == samples) {
+                classes_[c].members |= bit;
+                return true;
+            }
+        }
+        if (classCount_ >= MAX_THRESHOLD_CLASSES) {
+            return false;
+        }
+        classes_[classCount_++] = {bit, samples};
+        return true;
+    }
+
+    /**
+     * @brief Convertit un délai d'anti-rebond en nombre d'échantillons
+     * @param debounceMs Délai en millisecondes
+     * @param samplePeriodUs Période d'échantillonnage en microsecondes
+     */
+    static uint8_t samplesFor(uint16_t debounceMs, uint32_t samplePeriodUs) {
+        if (samplePeriodUs == 0) {
+            return MAX_THRESHOLD;
+        }
+        const uint32_t samples =
+            (static_cast<uint32_t>(debounceMs) * 1000 + samplePeriodUs - 1) / samplePeriodUs;
+        return samples > MAX_THRESHOLD ? MAX_THRESHOLD : static_cast<uint8_t>(samples);
+    }
+
+    /**
+     * @brief Initialise l'état stable sans générer de changement
+     */
+    void reset(Mask state) {
+        state_ = state;
+        counters_.fill(0);
+    }
+
+    /**
+     * @brief Intègre un échantillon brut de tous les boutons
+     * @param raw Échantillon (bit à 1 = actif)
+     * @return Masque des boutons dont l'état stable vient de changer
+     */
+    Mask update(Mask raw) {
+        return update(raw, ~Mask{0});
+    }
+
+    /**
+     * @brief Intègre un échantillon ne couvrant qu'une partie des boutons
+     *
+     * Les compteurs des boutons absents de `sampled` ne bougent pas : un
+     * bouton lu moins souvent (canal du multiplexeur) ne compte que ses
+     * propres lectures.
+     * @param raw Échantillon (bit à 1 = actif), seuls les bits de `sampled` comptent
+     * @param sampled Boutons effectivement lus dans cet échantillon
+     * @return Masque des boutons dont l'état stable vient de changer
+     */
+    Mask update(Mask raw, Mask sampled) {
+        const Mask differs = (raw ^ state_) & sampled;
+
+        // Remise à zéro des compteurs des boutons lus et conformes, puis +1 sur les autres
+        const Mask keep = differs | ~sampled;
+        Mask carry = differs;
+        for (auto& plane : counters_) {
+            plane &= keep;
+            const Mask nextCarry = plane & carry;
+            plane ^= carry;
+            carry = nextCarry;
+        }
+
+        // Boutons lus dont le compteur atteint le seuil de leur classe
+        Mask changed = 0;
+        for (size_t c = 0; c < classCount_; ++c) {
+            Mask equal = classes_[c].members & sampled;
+            for (uint8_t p = 0; p < COUNTER_BITS; ++p) {
+                equal &= (classes_[c].threshold >> p) & 1 ? counters_[p] : ~counters_[p];
+            }
+            changed |= equal;
+        }
+
+        state_ ^= changed;
+        for (auto& plane : counters_) {
+            plane &= ~changed;
+        }
+        return changed;
+    }
+
+    Mask getState() const {
+        return state_;
+    }
+
+private:
+    struct ThresholdClass {
+        Mask members;
+        uint8_t threshold;
+    };
+
+    std::array<Mask, COUNTER_BITS> counters_{};
+    std::array<ThresholdClass, MAX_THRESHOLD_CLASSES> classes_{};
+    size_t classCount_ = 0;
+    Mask state_ = 0;
+};
@@ -41,5 +41,9 @@ bool MuxPinReader::readPin() {
         return false;  // Valeur par défaut sécurisée
     }
 
+    // Instantané du balayage en cours (scanAll), sinon sélection et lecture directes
+    if (mux.hasFreshSnapshot() && mux.snapshotCovers(channel_)) {
+        return mux.readFromSnapshot(channel_);
+    }
     return mux.readDigitalFromChannel(channel_);
 }
\ No newline at end of file
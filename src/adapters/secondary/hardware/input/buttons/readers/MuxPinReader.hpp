@@ -6,7 +6,8 @@
 /**
  * @brief Lecteur pour pins connectées via le multiplexeur CD74HC4067
  *
- * Gère automatiquement la sélection du canal et la lecture via le MultiplexerManager.
+ * Lit l'instantané produit par MultiplexerManager::scanAll() lorsqu'il est
+ * récent ; sinon sélectionne le canal et lit directement.
  */
 class MuxPinReader : public IPinReader {
 public:
@@ -0,0 +1,150 @@
+// adapters/secondary/hardware/input/encoders/EncoderAccelerator.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Courbe d'accélération d'encodeur basée sur la vitesse (virgule fixe).
+ *
+ * La vitesse est mesurée par l'intervalle entre crans successifs, lissé par une
+ * moyenne glissante entière. Le gain est interpolé linéairement dans une table
+ * configurable (intervalle croissant -> gain Q8 décroissant). Aucun calcul
+ * flottant dans apply() : la conversion des paramètres flottants de
+ * configuration se fait une seule fois dans configure().
+ */
+class EncoderAccelerator {
+public:
+    static constexpr size_t MAX_CURVE_POINTS = 8;
+    static constexpr uint8_t GAIN_FRACTION_BITS = 8;
+    static constexpr uint16_t UNITY_GAIN = 1 << GAIN_FRACTION_BITS;
+
+    /**
+     * @brief Point de la courbe : en dessous de intervalUs entre crans, gain >= gainQ8
+     */
+    struct CurvePoint {
+        uint32_t intervalUs;  ///< Intervalle entre crans (µs), trié par ordre croissant
+        uint16_t gainQ8;      ///< Gain en Q8 (256 = x1)
+    };
+
+    EncoderAccelerator() = default;
+
+    /**
+     * @brief Construit la courbe par défaut à partir des paramètres d'EncoderConfig
+     * @param thresholdMs Intervalle entre crans au-delà duquel le gain vaut x1
+     * @param maxAcceleration Gain maximal atteint à thresholdMs / 8
+     */
+    void configure(uint16_t thresholdMs, float maxAcceleration) {
+        const uint32_t thresholdUs = static_cast<uint32_t>(thresholdMs) * 1000;
+        const int32_t maxGain = static_cast<int32_t>(maxAcceleration * UNITY_GAIN);
+        const int32_t span = maxGain > UNITY_GAIN ? maxGain - UNITY_GAIN : 0;
+
+        const CurvePoint points[] = {
+            {thresholdUs / 8, static_cast<uint16_t>(UNITY_GAIN + span)},
+            {thresholdUs / 4, static_cast<uint16_t>(UNITY_GAIN + (span * 2) / 3)},
+            {thresholdUs / 2, static_cast<uint16_t>(UNITY_GAIN + span / 3)},
+            {thresholdUs, UNITY_GAIN},
+        };
+        setCurve(points, sizeof(points) / sizeof(points[0]));
+    }
+
+    /**
+     * @brief Remplace la table d'accélération
+     * @param points Points triés par intervalle croissant
+     * @param count Nombre de points (tronqué à MAX_CURVE_POINTS)
+     */
+    void setCurve(const CurvePoint* points, size_t count) {
+        count_ = count > MAX_CURVE_POINTS ? MAX_CURVE_POINTS : static_cast<uint8_t>(count);
+        for (uint8_t i = 0; i < count_; ++i) {
+            curve_[i] = points[i];
+            if (curve_[i].gainQ8 < UNITY_GAIN) {
+                curve_[i].gainQ8 = UNITY_GAIN;  // Jamais de décélération
+            }
+        }
+        reset();
+    }
+
+    /**
+     * @brief Applique l'accélération à un nombre de crans
+     * @param steps Crans lus depuis le dernier appel (signé)
+     * @param nowUs Horodatage courant (micros())
+     * @return Nombre de pas accélérés (|résultat| >= |steps|)
+     */
+    int32_t apply(int32_t steps, uint32_t nowUs) {
+        if (steps == 0 || count_ == 0) {
+            return steps;
+        }
+
+        const int8_t direction = steps > 0 ? 1 : -1;
+        const uint32_t absSteps = static_cast<uint32_t>(steps > 0 ? steps : -steps);
+        const uint32_t intervalUs = (nowUs - lastDetentUs_) / absSteps;
+        lastDetentUs_ = nowUs;
+
+        // Premier cran, changement de sens ou pause : repartir à vitesse nulle
+        if (!hasHistory_ || direction != lastDirection_ ||
+            intervalUs >= curve_[count_ - 1].intervalUs) {
+            hasHistory_ = true;
+            lastDirection_ = direction;
+            smoothedIntervalUs_ = curve_[count_ - 1].intervalUs;
+            remainderQ8_ = 0;
+            return steps;
+        }
+        smoothedIntervalUs_ = (smoothedIntervalUs_ * 3 + intervalUs) / 4;
+
+        const int32_t gainQ8 = gainFor(smoothedIntervalUs_);
+        const int32_t scaledQ8 = steps * gainQ8 + remainderQ8_;
+        const int32_t result = scaledQ8 / UNITY_GAIN;  // Troncature vers zéro
+        remainderQ8_ = scaledQ8 - result * UNITY_GAIN;
+        return result;
+    }
+
+    /**
+     * @brief Gain Q8 interpolé pour un intervalle entre crans
+     */
+    uint16_t gainFor(uint32_t intervalUs) const {
+        if (count_ == 0) {
+            return UNITY_GAIN;
+        }
+        if (intervalUs <= curve_[0].intervalUs) {
+            return curve_[0].gainQ8;
+        }
+        for (uint8_t i = 1; i < count_; ++i) {
+            const CurvePoint& hi = curve_[i];
+            if (intervalUs <= hi.intervalUs) {
+                const CurvePoint& lo = curve_[i - 1];
+                const int64_t range = hi.intervalUs - lo.intervalUs;
+                if (range == 0) {
+                    return hi.gainQ8;
+                }
+                const int64_t offset = intervalUs - lo.intervalUs;
+                return static_cast<uint16_t>(
+                    lo.gainQ8 + ((static_cast<int64_t>(hi.gainQ8) - lo.gainQ8) * offset) / range);
+            }
+        }
+        return curve_[count_ - 1].gainQ8;
+    }
+
+    /**
+     * @brief Oublie l'historique de vitesse
+     */
+    void reset() {
+        smoothedIntervalUs_ = 0;
+        remainderQ8_ = 0;
+        lastDirection_ = 0;
+        hasHistory_ = false;
+    }
+
+    bool isEnabled() const {
+        return count_ > 0;
+    }
+
+private:
+    CurvePoint curve_[MAX_CURVE_POINTS] = {};
+    uint8_t count_ = 0;
+
+    uint32_t lastDetentUs_ = 0;
+    uint32_t smoothedIntervalUs_ = 0;
+    int32_t remainderQ8_ = 0;  // Fraction de pas reportée au cran suivant
+    int8_t lastDirection_ = 0;
+    bool hasHistory_ = false;
+};
@@ -19,8 +19,8 @@ struct EncoderConfig {
     float sensitivity = SystemConstants::Input::DEFAULT_ENCODER_SENSITIVITY;  ///< Utilise SystemConstants
     bool enableAcceleration = true;                  ///< Active l'accélération basée sur la vitesse
     uint8_t stepsPerDetent = 4;                      ///< Nombre de steps par cran mécanique
-    uint16_t accelerationThreshold = 100;           ///< Seuil d'accélération en ms entre steps
-    float maxAcceleration = 5.0f;                   ///< Facteur d'accélération maximum
+    uint16_t accelerationThreshold = SystemConstants::Encoders::ACCELERATION_THRESHOLD_MS;  ///< Seuil d'accélération en ms entre crans
+    float maxAcceleration = SystemConstants::Encoders::MAX_ACCELERATION;  ///< Facteur d'accélération maximum
     
     /**
      * @brief Vérifie si la configuration de l'encodeur est valide
@@ -17,7 +17,29 @@ public:
     void updateAll();
     const std::vector<EncoderPort*>& getEncoders() const;
 
+    size_t size() const {
+        return ownedEncoders_.size();
+    }
+
+    /**
+     * @brief Compteur brut d'un encodeur (appelable en interruption)
+     * @param index Rang dans getEncoders()
+     */
+    int32_t readCount(size_t index) {
+        return ownedEncoders_[index]->readCount();
+    }
+
+    /**
+     * @brief Convertit un compteur relevé par le timer en crans (tâche d'entrée)
+     * @param index Rang dans getEncoders()
+     * @param count Compteur relevé par readCount()
+     * @param timestampUs Horodatage du relevé
+     */
+    int8_t applyCount(size_t index, int32_t count, uint32_t timestampUs) {
+        return ownedEncoders_[index]->applyCount(count, timestampUs);
+    }
+
 private:
-    std::vector<std::unique_ptr<EncoderPort>> ownedEncoders_;
+    std::vector<std::unique_ptr<QuadratureEncoder>> ownedEncoders_;
     std::vector<EncoderPort*> encoders_;
 };
\ No newline at end of file
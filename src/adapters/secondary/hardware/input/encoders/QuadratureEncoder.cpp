@@ -1,22 +1,29 @@
 // adapters/secondary/hardware/input/encoders/QuadratureEncoder.cpp
 #include <Arduino.h>
-#include <cmath>
 
 #include "adapters/secondary/hardware/input/encoders/QuadratureEncoder.hpp"
+#include "core/utils/InputRecorder.hpp"
 
 QuadratureEncoder::QuadratureEncoder(const EncoderConfig& cfg)
     : id_(cfg.id),
+      pinA_(cfg.pinA.pin),
       encoder_(cfg.pinA.pin, cfg.pinB.pin),
       ppr_(cfg.ppr),
-      stepsPerDetent_(cfg.stepsPerDetent),
+      stepsPerDetent_(cfg.stepsPerDetent > 0 ? cfg.stepsPerDetent : 1),  // Diviseur de readDelta()
       lastPosition_(0),
+      lastChangeMs_(0),
+      extremeChangeMs_(0),
       physicalPosition_(0),
       absolutePosition_(0),
       stepAccumulator_(0),
-      normalizedAccumulator_(0.0f) {
+      normalizedAccumulatorQ16_(0) {
     // Normalisation PPR : référence 24 PPR
     const int32_t REFERENCE_PPR = 24;
-    normalizationRatio_ = static_cast<float>(REFERENCE_PPR) / static_cast<float>(ppr_);
+    normalizationRatioQ16_ = (REFERENCE_PPR << 16) / static_cast<int32_t>(ppr_);
+
+    if (cfg.enableAcceleration) {
+        accelerator_.configure(cfg.accelerationThreshold, cfg.maxAcceleration);
+    }
 }
 
 QuadratureEncoder::~QuadratureEncoder() {
@@ -24,17 +31,23 @@ QuadratureEncoder::~QuadratureEncoder() {
 }
 
 int8_t QuadratureEncoder::readDelta() {
-    // Filtrage temporel
-    static uint32_t lastChangeTime = 0;
+    return applyCount(encoder_.read(), micros());
+}
+
+int32_t QuadratureEncoder::readCount() {
+    return encoder_.read();
+}
+
+int8_t QuadratureEncoder::applyCount(int32_t count, uint32_t timestampUs) {
+    // Filtrage temporel (propre à chaque encodeur)
     static const uint32_t MIN_CHANGE_INTERVAL_MS = 1;
 
-    uint32_t currentTime = millis();
-    if (currentTime - lastChangeTime < MIN_CHANGE_INTERVAL_MS) {
+    const uint32_t currentTime = timestampUs / 1000;
+    if (currentTime - lastChangeMs_ < MIN_CHANGE_INTERVAL_MS) {
         return 0;
     }
 
-    // Lire l'encodeur
-    int32_t newPosition = encoder_.read();
+    int32_t newPosition = count;
     int32_t delta = newPosition - lastPosition_;
 
     if (delta == 0) return 0;
@@ -42,16 +55,18 @@ int8_t QuadratureEncoder::readDelta() {
     // Filtrage aux extrémités
     if ((physicalPosition_ <= 1 && delta < 0) ||
         (physicalPosition_ >= 126 && delta > 0)) {
-        static uint32_t extremeChangeTime = 0;
         static const uint32_t EXTREME_DEBOUNCE_MS = 4;
 
-        if (currentTime - extremeChangeTime < EXTREME_DEBOUNCE_MS) {
+        if (currentTime - extremeChangeMs_ < EXTREME_DEBOUNCE_MS) {
             return 0;
         }
-        extremeChangeTime = currentTime;
+        extremeChangeMs_ = currentTime;
     }
 
-    lastChangeTime = currentTime;
+    lastChangeMs_ = currentTime;
+
+    // Pas bruts, avant crans et accélération : le rejeu les réinjecte dans l'encodeur
+    INPUT_RECORD_ENCODER(pinA_, delta, timestampUs);
 
     // Mettre à jour la position
     lastPosition_ = newPosition;
@@ -60,7 +75,7 @@ int8_t QuadratureEncoder::readDelta() {
     // Accumulation par crans
     stepAccumulator_ += delta;
     
-    int8_t detentSteps = 0;
+    int32_t detentSteps = 0;
     if (abs(stepAccumulator_) >= stepsPerDetent_) {
         detentSteps = stepAccumulator_ / static_cast<int32_t>(stepsPerDetent_);
         stepAccumulator_ %= static_cast<int32_t>(stepsPerDetent_);
@@ -70,12 +85,14 @@ int8_t QuadratureEncoder::readDelta() {
         return 0;
     }
 
-    // Normalisation PPR avec accumulation flottante
-    float normalizedFloat = detentSteps * normalizationRatio_;
-    normalizedAccumulator_ += normalizedFloat;
-    
-    int32_t normalizedDelta = static_cast<int32_t>(normalizedAccumulator_);
-    normalizedAccumulator_ -= normalizedDelta;
+    // Accélération selon l'intervalle entre crans (no-op si désactivée)
+    detentSteps = accelerator_.apply(detentSteps, timestampUs);
+
+    // Normalisation PPR avec accumulation Q16 (reste conservé au signe près)
+    normalizedAccumulatorQ16_ += detentSteps * normalizationRatioQ16_;
+
+    int32_t normalizedDelta = normalizedAccumulatorQ16_ / (1 << 16);
+    normalizedAccumulatorQ16_ -= normalizedDelta * (1 << 16);
 
     // Limiter à int8_t
     int8_t result = (normalizedDelta > INT8_MAX)   ? INT8_MAX
@@ -109,5 +126,6 @@ void QuadratureEncoder::resetPosition() {
     physicalPosition_ = 0;
     absolutePosition_ = 0;
     stepAccumulator_ = 0;
-    normalizedAccumulator_ = 0.0f;
+    normalizedAccumulatorQ16_ = 0;
+    accelerator_.reset();
 }
\ No newline at end of file
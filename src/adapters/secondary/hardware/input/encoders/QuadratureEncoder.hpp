@@ -4,6 +4,7 @@
 #include <Arduino.h>
 #include <Encoder.h>  // Ajout de la bibliothèque Encoder
 
+#include "adapters/secondary/hardware/input/encoders/EncoderAccelerator.hpp"
 #include "adapters/secondary/hardware/input/encoders/EncoderConfig.hpp"
 #include "core/ports/input/EncoderPort.hpp"
 
@@ -12,6 +13,12 @@
  *
  * Utilise la bibliothèque Encoder pour une lecture fiable des rotations
  * avec gestion automatique des interruptions et du debounce.
+ * Si enableAcceleration est actif, les crans sont multipliés selon la vitesse
+ * de rotation (EncoderAccelerator, calcul entier uniquement).
+ *
+ * En mode timer, la lecture est scindée : readCount() relève le compteur en
+ * interruption, applyCount() le convertit en crans dans la tâche d'entrée,
+ * avec l'horodatage du relevé pour l'accélération.
  */
 class QuadratureEncoder : public EncoderPort {
 public:
@@ -19,6 +26,19 @@ public:
     ~QuadratureEncoder() override;
 
     int8_t readDelta() override;
+
+    /**
+     * @brief Compteur brut de la bibliothèque Encoder (appelable en interruption)
+     */
+    int32_t readCount();
+
+    /**
+     * @brief Convertit un compteur relevé en crans normalisés
+     * @param count Compteur brut (readCount())
+     * @param timestampUs micros() au moment du relevé
+     * @return Delta, comme readDelta()
+     */
+    int8_t applyCount(int32_t count, uint32_t timestampUs);
     EncoderId getId() const override;
     uint16_t getPpr() const override;
 
@@ -29,6 +49,7 @@ public:
 
 private:
     EncoderId id_;
+    uint8_t pinA_;     // Identifie l'encodeur dans les enregistrements d'entrées
     Encoder encoder_;  // Utilisation de la classe Encoder au lieu de la gestion manuelle
     uint16_t ppr_;     // Pulses Par Revolution
     uint8_t stepsPerDetent_;  // Nombre de steps par cran mécanique
@@ -36,18 +57,25 @@ private:
     // Variables pour le calcul du delta
     int32_t lastPosition_;
 
+    // Filtrage temporel (ms)
+    uint32_t lastChangeMs_;
+    uint32_t extremeChangeMs_;
+
     // Position physique totale (non normalisée)
     int32_t physicalPosition_;
 
     // Position absolue normalisée (cumulative)
     int32_t absolutePosition_;
 
-    // Facteur de normalisation pré-calculé (flottant pour plus de précision)
-    float normalizationRatio_;
+    // Facteur de normalisation pré-calculé (virgule fixe Q16)
+    int32_t normalizationRatioQ16_;
     
     // Accumulation pour les encodeurs crantés
     int32_t stepAccumulator_;  // Accumule les steps jusqu'au seuil stepsPerDetent
     
-    // Accumulation flottante pour la normalisation PPR
-    float normalizedAccumulator_;  // Accumule les mouvements normalisés
+    // Accumulation Q16 pour la normalisation PPR
+    int32_t normalizedAccumulatorQ16_;  // Accumule les mouvements normalisés
+
+    // Accélération basée sur la vitesse (désactivée si courbe vide)
+    EncoderAccelerator accelerator_;
 };
\ No newline at end of file
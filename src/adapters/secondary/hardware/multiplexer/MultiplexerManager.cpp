@@ -53,14 +53,100 @@ void MultiplexerManager::selectChannel(uint8_t channel) {
     }
 
     if (channel != currentChannel_) {
-        mux_->channel(channel);
-        currentChannel_ = channel;
+        writeSelectLines(channel);
 
         // Délai pour stabilisation du signal après changement
         delayMicroseconds(SWITCH_DELAY_US);
     }
 }
 
+void MultiplexerManager::selectChannelDeferred(uint8_t channel) {
+    if (!initialized_) {
+        return;
+    }
+
+    const uint8_t target = channel & 0x0F;
+    if (target != currentChannel_) {
+        writeSelectLines(target);
+    }
+}
+
+void MultiplexerManager::writeSelectLines(uint8_t channel) {
+    static constexpr uint8_t SELECT_PINS[4] = {S0_PIN, S1_PIN, S2_PIN, S3_PIN};
+
+    // Les lignes sont à LOW après construction de CD74HC4067 : currentChannel_ les reflète
+    const uint8_t changed = channel ^ currentChannel_;
+    for (uint8_t bit = 0; bit < 4; ++bit) {
+        if (changed & (1 << bit)) {
+            digitalWrite(SELECT_PINS[bit], (channel >> bit) & 0x01);
+            lineToggles_++;
+        }
+    }
+    currentChannel_ = channel;
+}
+
+void MultiplexerManager::scanAll(uint16_t channelMask) {
+    if (!initialized_) {
+        return;
+    }
+
+    const uint32_t startUs = micros();
+    uint16_t snapshot = 0;
+
+    // Code de Gray cyclique : une seule ligne change par pas, y compris 8 -> 0
+    for (uint8_t step = 0; step < MAX_CHANNELS; ++step) {
+        const uint8_t channel = step ^ (step >> 1);
+        if (!((channelMask >> channel) & 0x01)) {
+            continue;  // Canal non câblé : ni sélection ni délai
+        }
+        channelReads_++;
+        if (channel != currentChannel_) {
+            writeSelectLines(channel);
+            delayMicroseconds(SWITCH_DELAY_US);
+        }
+        if (digitalRead(SIGNAL_PIN)) {
+            snapshot |= static_cast<uint16_t>(1u << channel);
+        }
+    }
+
+    const uint32_t endUs = micros();
+    snapshot_ = snapshot;
+    snapshotMask_ = channelMask;
+    snapshotTimeUs_ = endUs;
+    hasSnapshot_ = true;
+
+    lastScanUs_ = endUs - startUs;
+    if (lastScanUs_ > maxScanUs_) {
+        maxScanUs_ = lastScanUs_;
+    }
+    totalScanUs_ += lastScanUs_;
+    scans_++;
+}
+
+bool MultiplexerManager::hasFreshSnapshot(uint32_t maxAgeUs) const {
+    return hasSnapshot_ && (micros() - snapshotTimeUs_) <= maxAgeUs;
+}
+
+MultiplexerManager::ScanStats MultiplexerManager::getScanStats() const {
+    ScanStats stats{};
+    stats.scans = scans_;
+    stats.last_scan_us = lastScanUs_;
+    stats.max_scan_us = maxScanUs_;
+    stats.avg_scan_us = scans_ > 0 ? static_cast<uint32_t>(totalScanUs_ / scans_) : 0;
+    stats.line_toggles = lineToggles_;
+    stats.channel_reads = channelReads_;
+    return stats;
+}
+
+void MultiplexerManager::resetScanStats() {
+    scans_ = 0;
+    lastScanUs_ = 0;
+    maxScanUs_ = 0;
+    totalScanUs_ = 0;
+    lineToggles_ = 0;
+    channelReads_ = 0;
+}
+
 bool MultiplexerManager::readDigital() const {
     if (!initialized_) {
         // Retour silencieux avec valeur par défaut
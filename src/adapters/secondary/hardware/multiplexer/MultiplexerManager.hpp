@@ -13,6 +13,8 @@
  */
 class MultiplexerManager {
 public:
+    static constexpr uint16_t ALL_CHANNELS = 0xFFFF;
+
     /**
      * @brief Obtient l'instance unique du gestionnaire
      */
@@ -29,6 +31,16 @@ public:
      */
     void selectChannel(uint8_t channel);
 
+    /**
+     * @brief Sélectionne un canal sans attendre sa stabilisation
+     *
+     * Pour un balayage étalé dans le temps (un canal par tick de
+     * TimerInputSampler) : le canal est lu au tick suivant, la période tenant
+     * lieu de délai. Sans attente, appelable en interruption.
+     * @param channel Canal à sélectionner (0-15)
+     */
+    void selectChannelDeferred(uint8_t channel);
+
     /**
      * @brief Lit une valeur digitale du canal actuellement sélectionné
      * @return État logique du canal (HIGH/LOW)
@@ -55,6 +67,60 @@ public:
      */
     uint16_t readAnalogFromChannel(uint8_t channel);
 
+    /**
+     * @brief Balaye les canaux demandés et mémorise leurs états dans un instantané
+     *
+     * Les canaux sont parcourus dans l'ordre du code de Gray : entre deux canaux
+     * consécutifs d'un balayage complet, une seule ligne de sélection change,
+     * suivie d'un unique délai de stabilisation. Les canaux absents du masque
+     * ne coûtent ni écriture ni délai.
+     * @param channelMask Canaux à lire (bit n = canal n), tous par défaut
+     */
+    void scanAll(uint16_t channelMask = ALL_CHANNELS);
+
+    /**
+     * @brief Indique si un instantané récent est disponible
+     * @param maxAgeUs Âge maximal accepté en microsecondes
+     */
+    bool hasFreshSnapshot(uint32_t maxAgeUs = SystemConstants::Multiplexer::SNAPSHOT_MAX_AGE_US) const;
+
+    /**
+     * @brief Indique si le dernier instantané contient le canal
+     */
+    bool snapshotCovers(uint8_t channel) const {
+        return (snapshotMask_ >> (channel & 0x0F)) & 0x01;
+    }
+
+    /**
+     * @brief Lit l'état d'un canal dans le dernier instantané
+     * @param channel Canal à lire (0-15)
+     * @return État logique du canal lors du dernier scanAll()
+     */
+    bool readFromSnapshot(uint8_t channel) const {
+        return (snapshot_ >> (channel & 0x0F)) & 0x01;
+    }
+
+    /**
+     * @brief Obtient le dernier instantané (bit n = canal n)
+     */
+    uint16_t getSnapshot() const { return snapshot_; }
+
+    /**
+     * @brief Compteurs de temps de balayage
+     */
+    struct ScanStats {
+        uint32_t scans;         // Nombre de balayages
+        uint32_t last_scan_us;  // Durée du dernier balayage
+        uint32_t max_scan_us;   // Durée maximale d'un balayage
+        uint32_t avg_scan_us;   // Durée moyenne d'un balayage
+        uint32_t line_toggles;  // Écritures de lignes de sélection
+        uint32_t channel_reads; // Canaux lus par les balayages
+    };
+
+    ScanStats getScanStats() const;
+
+    void resetScanStats();
+
     /**
      * @brief Vérifie si le multiplexeur est initialisé
      */
@@ -73,7 +139,26 @@ private:
     MultiplexerManager(const MultiplexerManager&) = delete;
     MultiplexerManager& operator=(const MultiplexerManager&) = delete;
 
+    /**
+     * @brief Positionne les lignes de sélection en n'écrivant que celles qui changent
+     */
+    void writeSelectLines(uint8_t channel);
+
     std::unique_ptr<CD74HC4067> mux_;
     uint8_t currentChannel_ = 0;
     bool initialized_ = false;
+
+    // Instantané du dernier balayage
+    uint16_t snapshot_ = 0;
+    uint16_t snapshotMask_ = 0;  // Canaux lus lors du dernier balayage
+    uint32_t snapshotTimeUs_ = 0;
+    bool hasSnapshot_ = false;
+
+    // Compteurs de balayage
+    uint32_t scans_ = 0;
+    uint32_t lastScanUs_ = 0;
+    uint32_t maxScanUs_ = 0;
+    uint64_t totalScanUs_ = 0;
+    uint32_t lineToggles_ = 0;
+    uint32_t channelReads_ = 0;
 };
\ No newline at end of file
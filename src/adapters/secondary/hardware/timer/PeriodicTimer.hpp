@@ -0,0 +1,159 @@
+// adapters/secondary/hardware/timer/PeriodicTimer.hpp
+#pragma once
+
+#include <Arduino.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Timer périodique matériel, abstraction au-dessus d'IntervalTimer.
+ *
+ * Sur Teensy, le callback est exécuté en contexte d'interruption (PIT) :
+ * il doit rester court et ne communiquer avec le reste du système que par
+ * des structures lock-free (RingBuffer SPSC).
+ *
+ * Hors Teensy (build hôte), un stub remplace IntervalTimer : les timers
+ * actifs sont déclenchés par serviceAll(nowUs), appelé depuis la boucle
+ * principale ou par une horloge virtuelle de test.
+ *
+ * Le nombre d'instances actives est limité par les canaux PIT disponibles.
+ */
+class PeriodicTimer {
+public:
+    using Callback = void (*)(void* context);
+
+    static constexpr size_t MAX_TIMERS = 4;  // Canaux PIT du i.MX RT1062
+
+    PeriodicTimer() = default;
+
+    ~PeriodicTimer() {
+        end();
+    }
+
+    // Non copiable : l'instance est référencée par son slot
+    PeriodicTimer(const PeriodicTimer&) = delete;
+    PeriodicTimer& operator=(const PeriodicTimer&) = delete;
+
+    /**
+     * @brief Démarre le timer
+     * @param callback Fonction appelée à chaque période
+     * @param context Pointeur transmis au callback
+     * @param periodUs Période en microsecondes
+     * @return true si un canal a pu être attribué
+     */
+    bool begin(Callback callback, void* context, uint32_t periodUs) {
+        end();
+        if (!callback || periodUs == 0) {
+            return false;
+        }
+
+        int8_t slot = allocateSlot();
+        if (slot < 0) {
+            return false;
+        }
+
+        Slot& s = slots()[slot];
+        s.callback = callback;
+        s.context = context;
+        s.periodUs = periodUs;
+        s.nextDueUs = micros() + periodUs;
+
+#if defined(TEENSYDUINO)
+        if (!timer_.begin(TRAMPOLINES[slot], periodUs)) {
+            s = Slot{};
+            return false;
+        }
+#endif
+        slot_ = slot;
+        return true;
+    }
+
+    /**
+     * @brief Arrête le timer et libère son canal
+     */
+    void end() {
+        if (slot_ < 0) {
+            return;
+        }
+#if defined(TEENSYDUINO)
+        timer_.end();
+#endif
+        slots()[slot_] = Slot{};
+        slot_ = -1;
+    }
+
+    bool isRunning() const {
+        return slot_ >= 0;
+    }
+
+    uint32_t getPeriodUs() const {
+        return slot_ >= 0 ? slots()[slot_].periodUs : 0;
+    }
+
+    /**
+     * @brief Déclenche les timers échus (stub hôte uniquement)
+     *
+     * Sur Teensy les timers sont cadencés par le matériel : no-op.
+     * Un timer en retard de plusieurs périodes n'est déclenché qu'une fois,
+     * comme un PIT dont l'interruption a été masquée.
+     */
+    static void serviceAll(uint32_t nowUs) {
+#if defined(TEENSYDUINO)
+        (void)nowUs;
+#else
+        for (auto& s : slots()) {
+            if (!s.callback || static_cast<int32_t>(nowUs - s.nextDueUs) < 0) {
+                continue;
+            }
+            s.nextDueUs += s.periodUs;
+            if (static_cast<int32_t>(nowUs - s.nextDueUs) >= 0) {
+                s.nextDueUs = nowUs + s.periodUs;
+            }
+            s.callback(s.context);
+        }
+#endif
+    }
+
+private:
+    struct Slot {
+        Callback callback = nullptr;
+        void* context = nullptr;
+        uint32_t periodUs = 0;
+        uint32_t nextDueUs = 0;  // Échéance suivante (stub hôte)
+    };
+
+    static std::array<Slot, MAX_TIMERS>& slots() {
+        static std::array<Slot, MAX_TIMERS> instances{};
+        return instances;
+    }
+
+    static int8_t allocateSlot() {
+        auto& all = slots();
+        for (size_t i = 0; i < MAX_TIMERS; ++i) {
+            if (!all[i].callback) {
+                return static_cast<int8_t>(i);
+            }
+        }
+        return -1;
+    }
+
+#if defined(TEENSYDUINO)
+    // IntervalTimer n'accepte qu'un pointeur de fonction sans contexte
+    template <size_t Index>
+    static void trampoline() {
+        const Slot& s = slots()[Index];
+        if (s.callback) {
+            s.callback(s.context);
+        }
+    }
+
+    static constexpr void (*TRAMPOLINES[MAX_TIMERS])() = {
+        &trampoline<0>, &trampoline<1>, &trampoline<2>, &trampoline<3>};
+
+    IntervalTimer timer_;
+#endif
+
+    int8_t slot_ = -1;
+};
@@ -7,6 +7,8 @@
 #include "config/GlobalSettings.hpp"
   // Pour avoir accès à PERFORMANCE_MODE
 #include "core/domain/events/core/EventTypes.hpp"
+#include "core/utils/CycleProfiler.hpp"
+#include "core/utils/LatencyTrace.hpp"
 #include "tools/Diagnostics.hpp"
 
 //=============================================================================
@@ -17,7 +19,7 @@ MidiMapper::MidiMapper(MidiOutputPort& midiOut, CommandManager& commandManager)
     : midiOut_(midiOut),
       commandManager_(commandManager),
       defaultConfig_(
-          {0, 0, false})  // Canal 0, CC 0, mode absolu
+          {0, 0, false, MidiResolution::CC_7BIT, 0, 0})  // Canal 0, CC 0, mode absolu, 7 bits
 {
     // Initialisation préalable des pool d'objets
     for (auto& cmd : midiCCCommandPool_) {
@@ -27,6 +29,10 @@ MidiMapper::MidiMapper(MidiOutputPort& midiOut, CommandManager& commandManager)
     for (auto& cmd : midiNoteCommandPool_) {
         cmd.reset(midiOut_, 0, 0, 0, 0);
     }
+
+    for (auto& cmd : midiHighResCommandPool_) {
+        cmd.reset(midiOut_, MidiResolution::CC_14BIT, 0, 0, 0, 0, 0);
+    }
 }
 
 //=============================================================================
@@ -49,6 +55,12 @@ SendMidiNoteCommand& MidiMapper::getNextNoteCommand() {
     return cmd;
 }
 
+SendMidiHighResCommand& MidiMapper::getNextHighResCommand() {
+    SendMidiHighResCommand& cmd = midiHighResCommandPool_[nextHighResCommandIndex_];
+    nextHighResCommandIndex_ = (nextHighResCommandIndex_ + 1) % COMMAND_POOL_SIZE;
+    return cmd;
+}
+
 void MidiMapper::logDiagnostic(const char* format, ...) const {
 #ifndef PERFORMANCE_MODE
     char buffer[100];
@@ -78,6 +90,8 @@ void MidiMapper::setMappingFromControlDefinition(const ControlDefinition& contro
             info.lastMidiValue = 0;
             info.lastEncoderPosition = 0;  // Sera initialisé lors du premier appel
             info.isFirstCall = true;
+            info.hiResAccumulator = 0;
+            info.lastHiResValue = 0;
 
             // Créer une clé composite qui inclut le type de contrôle
             uint32_t compositeKey = makeCompositeKey(controlDef.id, mappingSpec.appliesTo);
@@ -220,10 +234,59 @@ int16_t MidiMapper::calculateMidiValue(MappingInfo& info, int32_t delta, int32_t
     return newValue;
 }
 
+uint16_t MidiMapper::calculateHighResValue(MappingInfo& info, int32_t delta, int32_t position) {
+    const ControlDefinition::MidiConfig& midiConfig = info.midiConfig;
+    const int32_t step = midiConfig.hiResStep > 0 ? midiConfig.hiResStep
+                                                  : SystemConstants::Audio::HIRES_DEFAULT_STEP;
+
+    if (midiConfig.isRelative) {
+        // Mode relatif : la sensibilité est appliquée en Q8 pour conserver
+        // les fractions de pas au lieu de les tronquer
+        float sensitivity = GlobalSettings::getInstance().getEncoderSensitivity();
+        int32_t sensitivityQ8 = static_cast<int32_t>(sensitivity * (1 << HIRES_FRACTION_BITS));
+        int64_t next = static_cast<int64_t>(info.hiResAccumulator) +
+                       static_cast<int64_t>(delta) * step * sensitivityQ8;
+        info.hiResAccumulator =
+            static_cast<int32_t>(constrain(next, int64_t(0), int64_t(HIRES_ACCUMULATOR_MAX)));
+    } else {
+        // Mode absolu : position 0 = centre de la plage 14 bits
+        int32_t centered = (SystemConstants::Audio::HIRES_VALUE_MAX + 1) / 2 + position * step;
+        centered = constrain(centered, 0, static_cast<int32_t>(SystemConstants::Audio::HIRES_VALUE_MAX));
+        info.hiResAccumulator = centered << HIRES_FRACTION_BITS;
+    }
+
+    return static_cast<uint16_t>(info.hiResAccumulator >> HIRES_FRACTION_BITS);
+}
+
+void MidiMapper::processHighResolutionChange(MappingInfo& info, EncoderId encoderId,
+                                             int32_t delta, int32_t position) {
+    const ControlDefinition::MidiConfig& midiConfig = info.midiConfig;
+
+    uint16_t newValue = calculateHighResValue(info, delta, position);
+    if (newValue == info.lastHiResValue) {
+        return;
+    }
+    const uint16_t previousValue = info.lastHiResValue;
+    info.lastHiResValue = newValue;
+
+    // Garder la valeur 7 bits cohérente (MSB) pour getMidiConfig et l'UI
+    info.lastMidiValue = static_cast<uint8_t>(newValue >> 7);
+
+    uint16_t number = midiConfig.resolution == MidiResolution::NRPN ? midiConfig.nrpnParameter
+                                                                     : midiConfig.control;
+
+    // Une seule commande par mise à jour : la paire MSB/LSB (ou la séquence NRPN) est émise d'un bloc
+    SendMidiHighResCommand& command = getNextHighResCommand();
+    command.reset(midiOut_, midiConfig.resolution, midiConfig.channel, number, newValue,
+                  previousValue, encoderId);
+    commandManager_.executeShared(command);
+}
+
 void MidiMapper::processEncoderChange(EncoderId encoderId, int32_t position) {
     // MidiMapper est responsable de tout le traitement des encodeurs MIDI,
     // y compris la limitation de taux, le suivi des positions et la détection des doublons.
-
+    LATENCY_TRACE_STAGE(MidiMapper);
+    CYCLE_PROFILE_SCOPE("midi.mapper");
 
     // Vérifier si l'encodeur doit être traité (limitation de taux)
     if (!shouldProcessEncoder(encoderId, position)) {
@@ -253,12 +316,18 @@ void MidiMapper::processEncoderChange(EncoderId encoderId, int32_t position) {
         return;  // Pas de changement
     }
 
-    // Appliquer la sensibilité aux mouvements d'encodeur
-    delta = applyEncoderSensitivity(delta, encoderId);
-
     // Mettre à jour la dernière position
     mappingInfo.lastEncoderPosition = position;
 
+    // Mode haute résolution : accumulateur 14 bits, sensibilité en virgule fixe
+    if (midiConfig.resolution != MidiResolution::CC_7BIT) {
+        processHighResolutionChange(mappingInfo, encoderId, delta, position);
+        return;
+    }
+
+    // Appliquer la sensibilité aux mouvements d'encodeur
+    delta = applyEncoderSensitivity(delta, encoderId);
+
     // Calculer la nouvelle valeur MIDI selon le mode
     int16_t newValue = calculateMidiValue(mappingInfo, delta, position);
 
@@ -11,6 +11,7 @@
 #include "core/domain/types.hpp"
 #include "core/domain/commands/CommandManager.hpp"
 #include "core/domain/commands/midi/SendMidiCCCommand.hpp"
+#include "core/domain/commands/midi/SendMidiHighResCommand.hpp"
 #include "core/domain/commands/midi/SendMidiNoteCommand.hpp"
 #include "core/domain/events/MidiEvents.hpp"
 #include "core/domain/events/core/EventBus.hpp"
@@ -97,6 +98,13 @@ public:
      */
     void update();
 
+    /**
+     * @brief Indique si des commandes temporisées sont en cours
+     */
+    bool hasActiveNotes() const {
+        return !activeNotes_.empty();
+    }
+
 private:
     //=============================================================================
     // Constantes
@@ -107,6 +115,11 @@ private:
     static constexpr unsigned long ENCODER_RATE_LIMIT_MS = SystemConstants::Performance::ENCODER_RATE_LIMIT_MS;
     static constexpr unsigned long DUPLICATE_CHECK_MS = SystemConstants::Performance::DUPLICATE_CHECK_MS;
 
+    // Accumulateur haute résolution en virgule fixe (Q14.8)
+    static constexpr int32_t HIRES_FRACTION_BITS = 8;
+    static constexpr int32_t HIRES_ACCUMULATOR_MAX =
+        static_cast<int32_t>(SystemConstants::Audio::HIRES_VALUE_MAX) << HIRES_FRACTION_BITS;
+
     //=============================================================================
     // Types et structures
     //=============================================================================
@@ -117,6 +130,8 @@ private:
         uint8_t lastMidiValue;
         int32_t lastEncoderPosition;
         bool isFirstCall;  // Pour détecter le premier appel et initialiser correctement
+        int32_t hiResAccumulator;  // Valeur 14 bits en Q14.8 (modes CC_14BIT et NRPN)
+        uint16_t lastHiResValue;   // Dernière valeur 14 bits envoyée
     };
 
     //=============================================================================
@@ -132,6 +147,9 @@ private:
     // Obtient la prochaine commande Note disponible du pool
     SendMidiNoteCommand& getNextNoteCommand();
 
+    // Obtient la prochaine commande 14 bits disponible du pool
+    SendMidiHighResCommand& getNextHighResCommand();
+
     // Fonction de log diagnostique conditionnelle
     void logDiagnostic(const char* format, ...) const;
 
@@ -145,6 +163,13 @@ private:
     // Calcule la nouvelle valeur MIDI en fonction du mode (relatif/absolu)
     int16_t calculateMidiValue(MappingInfo& info, int32_t delta, int32_t position);
 
+    // Calcule la nouvelle valeur 14 bits via l'accumulateur en virgule fixe
+    uint16_t calculateHighResValue(MappingInfo& info, int32_t delta, int32_t position);
+
+    // Traite un changement d'encodeur pour un mapping 14 bits / NRPN
+    void processHighResolutionChange(MappingInfo& info, EncoderId encoderId, int32_t delta,
+                                     int32_t position);
+
     // Traite les événements de type bouton (encodeur ou bouton standard)
     void processButtonEvent(InputId buttonId, bool pressed, MappingControlType type);
 
@@ -160,6 +185,10 @@ private:
     std::array<SendMidiNoteCommand, COMMAND_POOL_SIZE> midiNoteCommandPool_;
     uint8_t nextNoteCommandIndex_ = 0;
 
+    // Pool d'objets pour les commandes MIDI 14 bits
+    std::array<SendMidiHighResCommand, COMMAND_POOL_SIZE> midiHighResCommandPool_;
+    uint8_t nextHighResCommandIndex_ = 0;
+
     MidiOutputPort& midiOut_;
     CommandManager& commandManager_;
     std::unordered_map<uint32_t, MappingInfo> mappings_;  // Clé: (controlId << 8 | controlType)
@@ -0,0 +1,387 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <array>
+
+#include "config/SystemConstants.hpp"
+#include "core/ports/output/MidiOutputPort.hpp"
+#include "core/utils/CycleProfiler.hpp"
+#include "core/utils/LatencyTrace.hpp"
+
+/**
+ * @brief Étage de coalescence "dernière valeur gagnante" pour les Control Change
+ *
+ * Cette classe décore un MidiOutputPort : les CC sont indexés par (canal, CC)
+ * et seule la dernière valeur reçue dans une fenêtre de vidage est transmise.
+ * Les CC 14 bits sont coalescés par paire (clé du MSB) et toujours réémis
+ * ensemble. Un CC isolé est toujours transmis, même s'il répète la valeur
+ * précédente (CC de déclenchement, resynchronisation avec le DAW) : seule une
+ * clé fusionnée dans la fenêtre qui suit son envoi et revenue à la valeur
+ * transmise est abandonnée. Les autres messages (Note On/Off, NRPN, Program Change, ...) sont transmis
+ * immédiatement et dans l'ordre, après avoir vidé les CC en attente pour
+ * préserver la causalité.
+ *
+ * L'état par clé tient en 8 octets (16 Ko pour les 2048 clés) ; les rares
+ * clés à débit limité ont leur intervalle et leur dernier envoi dans une
+ * petite table à part.
+ *
+ * Le temps est passé explicitement à update(now_us) pour permettre les tests
+ * avec un port factice et une horloge virtuelle.
+ */
+class MidiOutputCoalescer : public MidiOutputPort {
+public:
+    static constexpr size_t CHANNEL_COUNT = 16;
+    static constexpr size_t CC_COUNT = 128;
+    static constexpr size_t KEY_COUNT = CHANNEL_COUNT * CC_COUNT;
+    static constexpr size_t MAX_PENDING_KEYS = SystemConstants::Performance::MAX_MIDI_PENDING_PARAMS;
+    static constexpr size_t MAX_RATE_LIMITED_KEYS = SystemConstants::Audio::CC_RATE_LIMITED_KEYS;
+
+    /**
+     * @brief Configuration de l'étage de coalescence
+     */
+    struct Config {
+        uint32_t flush_window_us;      // Fenêtre minimale entre deux vidages
+
+        Config() : flush_window_us(SystemConstants::Audio::CC_COALESCE_WINDOW_US) {}
+    };
+
+    /**
+     * @brief Statistiques de coalescence
+     */
+    struct Stats {
+        uint32_t cc_received;     // CC reçus en entrée
+        uint32_t cc_sent;         // CC transmis au port de base
+        uint32_t cc_merged;       // CC écrasés par une valeur plus récente
+        uint32_t cc_redundant;    // Clés fusionnées revenues à la valeur du vidage précédent
+        uint32_t rate_deferred;   // Vidages reportés par la limite de débit d'une clé
+        uint32_t passthrough;     // Messages non-CC transmis directement
+        uint32_t pending_overflows;  // Vidages forcés par liste de clés pleine
+    };
+
+    /**
+     * @brief Constructeur
+     * @param basePort Port MIDI de base à décorer
+     * @param config Configuration de coalescence
+     */
+    explicit MidiOutputCoalescer(MidiOutputPort& basePort, const Config& config = Config())
+        : m_basePort(basePort), m_config(config) {}
+
+    // === CONFIGURATION ===
+
+    /**
+     * @brief Définit le débit maximal pour une clé (canal, CC)
+     * @param ch Canal MIDI (0-15)
+     * @param cc Numéro de contrôleur (0-127)
+     * @param minIntervalUs Intervalle minimal entre deux envois (0 = illimité)
+     * @return false si MAX_RATE_LIMITED_KEYS clés sont déjà limitées
+     */
+    bool setKeyMinInterval(MidiChannel ch, MidiCC cc, uint32_t minIntervalUs) {
+        const uint16_t key = makeKey(ch, cc);
+        RateLimit* limit = findRateLimit(key);
+
+        if (minIntervalUs == 0) {
+            if (limit) {
+                *limit = m_rateLimits[--m_rateLimitCount];
+                m_slots[key].flags &= ~RATE_LIMITED;
+            }
+            return true;
+        }
+
+        if (!limit) {
+            if (m_rateLimitCount >= MAX_RATE_LIMITED_KEYS) {
+                return false;
+            }
+            limit = &m_rateLimits[m_rateLimitCount++];
+            *limit = RateLimit{key, 0, 0, false};
+            m_slots[key].flags |= RATE_LIMITED;
+        }
+        limit->min_interval_us = minIntervalUs;
+        return true;
+    }
+
+    /**
+     * @brief Définit la fenêtre de vidage
+     * @param windowUs Durée minimale entre deux vidages (0 = à chaque update)
+     */
+    void setFlushWindow(uint32_t windowUs) {
+        m_config.flush_window_us = windowUs;
+    }
+
+    // === TRAITEMENT ===
+
+    /**
+     * @brief Vide les CC en attente si la fenêtre est écoulée
+     * @param nowUs Temps courant en microsecondes
+     */
+    void update(uint32_t nowUs) {
+        if ((nowUs - m_lastFlushUs) < m_config.flush_window_us) {
+            return;
+        }
+        if (m_pendingCount == 0) {
+            // Fenêtre vide : les CC suivants n'en prolongent plus aucune
+            m_window++;
+            return;
+        }
+        flushPending(nowUs, false);
+    }
+
+    /**
+     * @brief Indique si des CC en attente peuvent être transmis
+     * @param nowUs Temps courant en microsecondes
+     */
+    bool isFlushDue(uint32_t nowUs) const {
+        return m_pendingCount > 0 && (nowUs - m_lastFlushUs) >= m_config.flush_window_us;
+    }
+
+    /**
+     * @brief Vide les CC en attente en utilisant micros()
+     */
+    void update() {
+        update(micros());
+    }
+
+    /**
+     * @brief Transmet immédiatement tous les CC en attente, sans limite de débit
+     */
+    void flush() {
+        flushPending(micros(), true);
+    }
+
+    // === INTERFACE MidiOutputPort ===
+
+    void sendCc(MidiChannel ch, MidiCC cc, uint8_t value, uint8_t source) override {
+        enqueueCc(makeKey(ch, cc), value, source, false);
+    }
+
+    void sendControlChange14(MidiChannel ch, MidiCC msbCc, uint16_t value,
+                             uint8_t source) override {
+        enqueueCc(makeKey(ch, msbCc), value, source, true);
+    }
+
+    void sendNrpn(MidiChannel ch, uint16_t parameter, uint16_t value, uint8_t source) override {
+        // Séquence NRPN atomique : la coalescence casserait l'association numéro/valeur
+        flushBeforePassthrough();
+        m_basePort.sendNrpn(ch, parameter, value, source);
+    }
+
+    void sendControlChange(MidiChannel ch, MidiCC cc, uint8_t value) override {
+        sendCc(ch, cc, value, 0);
+    }
+
+    void sendNoteOn(MidiChannel ch, MidiNote note, uint8_t velocity) override {
+        flushBeforePassthrough();
+        m_basePort.sendNoteOn(ch, note, velocity);
+    }
+
+    void sendNoteOff(MidiChannel ch, MidiNote note, uint8_t velocity) override {
+        flushBeforePassthrough();
+        m_basePort.sendNoteOff(ch, note, velocity);
+    }
+
+    void sendProgramChange(MidiChannel ch, uint8_t program) override {
+        flushBeforePassthrough();
+        m_basePort.sendProgramChange(ch, program);
+    }
+
+    void sendPitchBend(MidiChannel ch, uint16_t value) override {
+        flushBeforePassthrough();
+        m_basePort.sendPitchBend(ch, value);
+    }
+
+    void sendChannelPressure(MidiChannel ch, uint8_t pressure) override {
+        flushBeforePassthrough();
+        m_basePort.sendChannelPressure(ch, pressure);
+    }
+
+    void sendSysEx(const uint8_t* data, uint16_t length) override {
+        flushBeforePassthrough();
+        m_basePort.sendSysEx(data, length);
+    }
+
+    // === STATISTIQUES ===
+
+    const Stats& getStats() const {
+        return m_stats;
+    }
+
+    void resetStats() {
+        m_stats = Stats{};
+    }
+
+    size_t getPendingCount() const {
+        return m_pendingCount;
+    }
+
+private:
+    // Drapeaux d'une clé
+    static constexpr uint8_t PENDING = 1 << 0;
+    static constexpr uint8_t HAS_SENT = 1 << 1;
+    static constexpr uint8_t MERGED = 1 << 2;        // Plusieurs valeurs reçues depuis la mise en attente
+    static constexpr uint8_t AFTER_SEND = 1 << 3;    // Mise en attente dans la fenêtre qui suit un envoi
+    static constexpr uint8_t IS_14BIT = 1 << 4;      // Paire MSB/LSB (clé = CC du MSB)
+    static constexpr uint8_t LAST_IS_14BIT = 1 << 5; // Format de la dernière valeur transmise
+    static constexpr uint8_t RATE_LIMITED = 1 << 6;  // Entrée dans m_rateLimits
+
+    /**
+     * @brief État d'une clé (canal, CC)
+     */
+    struct Slot {
+        uint16_t value = 0;
+        uint16_t last_value = 0;
+        uint16_t sent_window = 0;  // Fenêtre du dernier envoi
+        uint8_t source = 0;
+        uint8_t flags = 0;
+    };
+    static_assert(sizeof(Slot) == 8, "Coalescer slot must stay 8 bytes");
+
+    /**
+     * @brief Limite de débit d'une clé (table creuse)
+     */
+    struct RateLimit {
+        uint16_t key;
+        uint32_t min_interval_us;
+        uint32_t last_sent_us;
+        bool has_sent;
+    };
+
+    RateLimit* findRateLimit(uint16_t key) {
+        for (size_t i = 0; i < m_rateLimitCount; ++i) {
+            if (m_rateLimits[i].key == key) {
+                return &m_rateLimits[i];
+            }
+        }
+        return nullptr;
+    }
+
+    static uint16_t makeKey(MidiChannel ch, MidiCC cc) {
+        return static_cast<uint16_t>((ch & 0x0F) << 7 | (cc & 0x7F));
+    }
+
+    void enqueueCc(uint16_t key, uint16_t value, uint8_t source, bool is14bit) {
+        m_stats.cc_received++;
+
+        Slot& slot = m_slots[key];
+        const uint8_t format = is14bit ? IS_14BIT : 0;
+
+        if (slot.flags & PENDING) {
+            // Valeur plus récente pour une clé déjà en attente
+            m_stats.cc_merged++;
+            slot.flags = static_cast<uint8_t>((slot.flags & ~IS_14BIT) | MERGED | format);
+            slot.value = value;
+            slot.source = source;
+#ifdef LATENCY_TRACE
+            m_traceIds[key] = LatencyTrace::currentId();
+#endif
+            return;
+        }
+
+        if (m_pendingCount >= MAX_PENDING_KEYS) {
+            m_stats.pending_overflows++;
+            flushPending(micros(), true);
+        }
+
+        const bool afterSend = (slot.flags & HAS_SENT) &&
+                               slot.sent_window == static_cast<uint16_t>(m_window - 1);
+        slot.flags = static_cast<uint8_t>((slot.flags & (HAS_SENT | LAST_IS_14BIT | RATE_LIMITED)) |
+                                          PENDING | format | (afterSend ? AFTER_SEND : 0));
+        slot.value = value;
+        slot.source = source;
+#ifdef LATENCY_TRACE
+        m_traceIds[key] = LatencyTrace::currentId();
+#endif
+        m_pendingKeys[m_pendingCount++] = key;
+    }
+
+    /**
+     * @brief Valeur fusionnée dans la fenêtre qui suit son dernier envoi et
+     * revenue à la valeur transmise (aller-retour rapide de l'encodeur)
+     *
+     * Une clé mise en attente plus tard est toujours renvoyée : le DAW a pu
+     * modifier le paramètre entre-temps.
+     */
+    static bool isRedundant(const Slot& slot) {
+        constexpr uint8_t REQUIRED = MERGED | AFTER_SEND;
+        return (slot.flags & REQUIRED) == REQUIRED &&
+               ((slot.flags & IS_14BIT) != 0) == ((slot.flags & LAST_IS_14BIT) != 0) &&
+               slot.last_value == slot.value;
+    }
+
+    void flushBeforePassthrough() {
+        m_stats.passthrough++;
+        if (m_pendingCount > 0) {
+            flushPending(micros(), true);
+        }
+    }
+
+    /**
+     * @brief Transmet les CC en attente
+     * @param nowUs Temps courant
+     * @param force Ignorer la limite de débit par clé
+     */
+    void flushPending(uint32_t nowUs, bool force) {
+        CYCLE_PROFILE_SCOPE("midi.coalesce");
+        size_t kept = 0;
+
+        for (size_t i = 0; i < m_pendingCount; ++i) {
+            const uint16_t key = m_pendingKeys[i];
+            Slot& slot = m_slots[key];
+
+            RateLimit* limit = (slot.flags & RATE_LIMITED) ? findRateLimit(key) : nullptr;
+            if (!force && limit && limit->has_sent &&
+                (nowUs - limit->last_sent_us) < limit->min_interval_us) {
+                // Clé limitée en débit : la garder pour un prochain vidage
+                m_stats.rate_deferred++;
+                m_pendingKeys[kept++] = key;
+                continue;
+            }
+
+            slot.flags &= ~PENDING;
+            if (isRedundant(slot)) {
+                m_stats.cc_redundant++;
+                continue;
+            }
+
+            const MidiChannel ch = static_cast<MidiChannel>(key >> 7);
+            const MidiCC cc = static_cast<MidiCC>(key & 0x7F);
+#ifdef LATENCY_TRACE
+            LatencyTrace::ScopedId traceScope(m_traceIds[key]);
+            LATENCY_TRACE_STAGE(CoalescerFlush);
+#endif
+            const bool is14bit = slot.flags & IS_14BIT;
+            if (is14bit) {
+                m_basePort.sendControlChange14(ch, cc, slot.value, slot.source);
+            } else {
+                m_basePort.sendCc(ch, cc, static_cast<uint8_t>(slot.value), slot.source);
+            }
+            slot.last_value = slot.value;
+            slot.flags = static_cast<uint8_t>((slot.flags & ~LAST_IS_14BIT) | HAS_SENT |
+                                              (is14bit ? LAST_IS_14BIT : 0));
+            slot.sent_window = m_window;
+            if (limit) {
+                limit->last_sent_us = nowUs;
+                limit->has_sent = true;
+            }
+            m_stats.cc_sent++;
+        }
+
+        m_pendingCount = kept;
+        m_lastFlushUs = nowUs;
+        m_window++;
+    }
+
+    MidiOutputPort& m_basePort;  // Port MIDI de base
+    Config m_config;
+    Stats m_stats{};
+
+    std::array<Slot, KEY_COUNT> m_slots{};                   // Indexé par (canal << 7 | CC)
+    std::array<RateLimit, MAX_RATE_LIMITED_KEYS> m_rateLimits{};
+    size_t m_rateLimitCount = 0;
+#ifdef LATENCY_TRACE
+    std::array<uint16_t, KEY_COUNT> m_traceIds{};  // Trace de la valeur en attente (la plus récente)
+#endif
+    std::array<uint16_t, MAX_PENDING_KEYS> m_pendingKeys{};  // Clés en attente, ordre d'arrivée
+    size_t m_pendingCount = 0;
+    uint32_t m_lastFlushUs = 0;
+    uint16_t m_window = 0;  // Numéro de la fenêtre de vidage courante
+};
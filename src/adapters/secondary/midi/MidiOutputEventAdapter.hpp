@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+
+#include "config/SystemConstants.hpp"
 #include "core/domain/events/MidiEvents.hpp"
 #include "core/domain/events/core/Event.hpp"
 #include "core/domain/events/core/IEventBus.hpp"
@@ -59,6 +62,67 @@ public:
         sendCc(ch, cc, value, 0);
     }
 
+    /**
+     * @brief Envoie un Control Change 14 bits et émet un événement (valeur MSB)
+     * @param ch Canal MIDI (0-15)
+     * @param msbCc Numéro du contrôleur MSB (0-31)
+     * @param value Valeur 14 bits (0-16383)
+     * @param source Identifiant de la source du message
+     */
+    void sendControlChange14(MidiChannel ch, MidiCC msbCc, uint16_t value,
+                             uint8_t source) override {
+        m_basePort.sendControlChange14(ch, msbCc, value, source);
+
+        if (m_eventBus) {
+            MidiCCEvent event(ch, msbCc, (value >> 7) & 0x7F, source);
+            m_eventBus->publish(event);
+        }
+    }
+
+    /**
+     * @brief Associe un NRPN au contrôleur qui l'identifie côté UI
+     *
+     * Un mapping NRPN garde un numéro de CC comme identifiant de widget
+     * (ControlBuilder::withMidiNRPN) : les envois de ce NRPN sont publiés
+     * comme des MidiCCEvent sur ce contrôleur.
+     * @return false si la table est pleine
+     */
+    bool setNrpnController(MidiChannel ch, uint16_t parameter, MidiCC controller) {
+        for (size_t i = 0; i < m_nrpnControllerCount; ++i) {
+            if (m_nrpnControllers[i].channel == ch && m_nrpnControllers[i].parameter == parameter) {
+                m_nrpnControllers[i].controller = controller;
+                return true;
+            }
+        }
+        if (m_nrpnControllerCount >= m_nrpnControllers.size()) {
+            return false;
+        }
+        m_nrpnControllers[m_nrpnControllerCount++] = {parameter, ch, controller};
+        return true;
+    }
+
+    /**
+     * @brief Envoie un NRPN 14 bits et émet un événement (valeur MSB)
+     * @param ch Canal MIDI (0-15)
+     * @param parameter Numéro de paramètre NRPN (0-16383)
+     * @param value Valeur 14 bits (0-16383)
+     * @param source Identifiant de la source du message
+     */
+    void sendNrpn(MidiChannel ch, uint16_t parameter, uint16_t value, uint8_t source) override {
+        m_basePort.sendNrpn(ch, parameter, value, source);
+
+        if (!m_eventBus) {
+            return;
+        }
+        for (size_t i = 0; i < m_nrpnControllerCount; ++i) {
+            if (m_nrpnControllers[i].channel == ch && m_nrpnControllers[i].parameter == parameter) {
+                MidiCCEvent event(ch, m_nrpnControllers[i].controller, (value >> 7) & 0x7F, source);
+                m_eventBus->publish(event);
+                return;
+            }
+        }
+    }
+
     /**
      * @brief Envoie un message MIDI Note On et émet un événement
      * @param ch Canal MIDI (0-15)
@@ -158,6 +222,14 @@ public:
     }
 
 private:
+    struct NrpnController {
+        uint16_t parameter;
+        MidiChannel channel;
+        MidiCC controller;
+    };
+
     MidiOutputPort& m_basePort;  // Port MIDI de base
     std::shared_ptr<MidiController::Events::IEventBus> m_eventBus;  // Bus d'événements injecté
+    std::array<NrpnController, SystemConstants::Audio::MAX_NRPN_UI_CONTROLLERS> m_nrpnControllers{};
+    size_t m_nrpnControllerCount = 0;
 };
\ No newline at end of file
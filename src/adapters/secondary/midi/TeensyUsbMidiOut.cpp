@@ -2,74 +2,161 @@
 
 #include <Arduino.h>
 
-TeensyUsbMidiOut::TeensyUsbMidiOut() {
+#include "core/utils/CycleProfiler.hpp"
+
+TeensyUsbMidiOut::TeensyUsbMidiOut(const Config& config) : config_(config) {
     // Initialiser le tableau de notes actives
     for (size_t i = 0; i < MAX_ACTIVE_NOTES; i++) {
         activeNotes_[i].active = false;
     }
 
+    // Un paquet ne peut pas dépasser la capacité de la file
+    if (config_.events_per_packet == 0) {
+        config_.events_per_packet = 1;
+    } else if (config_.events_per_packet > outgoing_.capacity()) {
+        config_.events_per_packet = outgoing_.capacity();
+    }
+
     // S'assurer que l'USB MIDI est prêt
     // Rien à faire, Teensy gère cela automatiquement
 }
 
 void TeensyUsbMidiOut::sendControlChange(MidiChannel ch, MidiCC cc, uint8_t value) {
-    // Envoyer via usbMIDI
-    usbMIDI.sendControlChange(cc, value, ch + 1);  // Les canaux MIDI commencent à 1 pour Teensy
-
-    // Appeler send_now pour assurer la transmission immédiate
-    usbMIDI.send_now();
+    enqueue(0xB0 | (ch & 0x0F), cc, value);
 }
 
 void TeensyUsbMidiOut::sendNoteOn(MidiChannel ch, MidiNote note, uint8_t velocity) {
     // Enregistrer cette note comme active
     markNoteActive(ch, note);
 
-    // Envoyer via usbMIDI
-    usbMIDI.sendNoteOn(note, velocity, ch + 1);  // Les canaux MIDI commencent à 1 pour Teensy
-
-    // Appeler send_now pour assurer la transmission immédiate
-    usbMIDI.send_now();
+    enqueue(0x90 | (ch & 0x0F), note, velocity);
 }
 
 void TeensyUsbMidiOut::sendNoteOff(MidiChannel ch, MidiNote note, uint8_t velocity) {
     // Marquer cette note comme inactive
     markNoteInactive(ch, note);
 
-    // Envoyer via usbMIDI
-    usbMIDI.sendNoteOff(note, velocity, ch + 1);  // Les canaux MIDI commencent à 1 pour Teensy
-
-    // Appeler send_now pour assurer la transmission immédiate
-    usbMIDI.send_now();
+    enqueue(0x80 | (ch & 0x0F), note, velocity);
 }
 
-// Nouvelles méthodes implémentées
 void TeensyUsbMidiOut::sendProgramChange(MidiChannel ch, uint8_t program) {
-    usbMIDI.sendProgramChange(program, ch + 1);
-    usbMIDI.send_now();
+    enqueue(0xC0 | (ch & 0x0F), program, 0);
 }
 
 void TeensyUsbMidiOut::sendPitchBend(MidiChannel ch, uint16_t value) {
-    usbMIDI.sendPitchBend(value, ch + 1);
-    usbMIDI.send_now();
+    // Valeur 14 bits (0-16383) : LSB puis MSB
+    enqueue(0xE0 | (ch & 0x0F), value & 0x7F, (value >> 7) & 0x7F);
 }
 
 void TeensyUsbMidiOut::sendChannelPressure(MidiChannel ch, uint8_t pressure) {
-    usbMIDI.sendAfterTouch(pressure, ch + 1);
-    usbMIDI.send_now();
+    enqueue(0xD0 | (ch & 0x0F), pressure, 0);
 }
 
 void TeensyUsbMidiOut::sendSysEx(const uint8_t* data, uint16_t length) {
+    // Les SysEx ne passent pas par la file : vider d'abord pour préserver l'ordre
+    flush();
     usbMIDI.sendSysEx(length, data);
     usbMIDI.send_now();
+    stats_.packets_sent++;
 }
 
 void TeensyUsbMidiOut::flush() {
-    // Forcer l'envoi des messages en attente
-    usbMIDI.send_now();
+    CYCLE_PROFILE_SCOPE("midi.usb_flush");
+    MidiBuffers::MidiMessage message;
+    uint8_t eventsInPacket = 0;
+#ifdef LATENCY_TRACE
+    uint16_t packetTraceIds[OUTGOING_SIZE];
+#endif
+
+    while (outgoing_.read(message)) {
+#ifdef LATENCY_TRACE
+        outgoingTraceIds_.read(packetTraceIds[eventsInPacket]);
+#endif
+        writeToUsb(message);
+        eventsInPacket++;
+
+        // Paquet USB complet : le transmettre
+        if (eventsInPacket >= config_.events_per_packet) {
+            usbMIDI.send_now();
+#ifdef LATENCY_TRACE
+            traceSent(packetTraceIds, eventsInPacket);
+#endif
+            stats_.packets_sent++;
+            stats_.full_packets++;
+            eventsInPacket = 0;
+        }
+    }
+
+    // Transmettre le paquet partiel restant
+    if (eventsInPacket > 0) {
+        usbMIDI.send_now();
+#ifdef LATENCY_TRACE
+        traceSent(packetTraceIds, eventsInPacket);
+#endif
+        stats_.packets_sent++;
+    }
+}
 
-    // Traiter les messages entrants
-    usbMIDI.read();
+void TeensyUsbMidiOut::update() {
+    if (!outgoing_.is_empty()) {
+        flush();
+    }
+}
+
+void TeensyUsbMidiOut::enqueue(uint8_t status, uint8_t data1, uint8_t data2) {
+    MidiBuffers::MidiMessage message(status, data1, data2, micros());
+    LATENCY_TRACE_STAGE(UsbEnqueue);
+
+    if (!config_.enable_batching) {
+        writeToUsb(message);
+        usbMIDI.send_now();
+        LATENCY_TRACE_STAGE(UsbSend);
+        stats_.packets_sent++;
+        return;
+    }
+
+    // File pleine : vider avant d'ajouter
+    if (!outgoing_.write(message)) {
+        stats_.queue_overflows++;
+        flush();
+        outgoing_.write(message);
+    }
+#ifdef LATENCY_TRACE
+    outgoingTraceIds_.write(LatencyTrace::currentId());
+#endif
+
+    const size_t pending = outgoing_.size();
+    if (pending > stats_.queue_high_water) {
+        stats_.queue_high_water = pending;
+    }
+
+    // Un paquet complet est disponible : inutile d'attendre le prochain tick
+    if (pending >= config_.events_per_packet) {
+        flush();
+        return;
+    }
+
+    // Le plus ancien message a atteint la latence maximale
+    MidiBuffers::MidiMessage oldest;
+    if (outgoing_.peek(oldest) && (message.timestamp - oldest.timestamp) >= config_.max_hold_us) {
+        stats_.deadline_flushes++;
+        flush();
+    }
+}
+
+void TeensyUsbMidiOut::writeToUsb(const MidiBuffers::MidiMessage& message) {
+    // usbMIDI::send attend le type (nibble haut) et un canal 1-16
+    usbMIDI.send(message.status & 0xF0, message.data1, message.data2, (message.status & 0x0F) + 1, 0);
+    stats_.events_sent++;
+}
+
+#ifdef LATENCY_TRACE
+void TeensyUsbMidiOut::traceSent(const uint16_t* traceIds, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        LatencyTrace::stageFor(traceIds[i], LatencyTrace::Stage::UsbSend);
+    }
 }
+#endif
 
 void TeensyUsbMidiOut::markNoteActive(MidiChannel ch, MidiNote note) {
     // Rechercher un emplacement libre ou la même note
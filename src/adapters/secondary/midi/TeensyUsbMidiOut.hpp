@@ -2,17 +2,64 @@
 #include <Arduino.h>
 
 #include "config/SystemConstants.hpp"
+#include "core/memory/RingBuffer.hpp"
 #include "core/ports/output/MidiOutputPort.hpp"
+#include "core/utils/LatencyTrace.hpp"
 
 /**
  * @brief Implémentation de MidiOutputPort pour le port USB MIDI natif de Teensy
  *
  * Cette classe utilise l'interface USB MIDI native de Teensy pour envoyer
  * des messages MIDI via USB sans avoir besoin d'une bibliothèque externe.
+ *
+ * En mode batching, les messages sont placés dans une file de sortie et
+ * regroupés en paquets USB complets (événements de 4 octets) au lieu d'un
+ * send_now() par message. La file est vidée à chaque tick (update()), dès
+ * qu'un paquet est plein, ou quand le plus ancien message dépasse la latence
+ * maximale configurée.
  */
+#ifdef MIDI_TX_SIZE_480
+// Taille de paquet tirée du descripteur USB du core Teensy (usb_desc.h)
+static_assert(SystemConstants::Audio::USB_MIDI_EVENTS_PER_PACKET * 4 == MIDI_TX_SIZE_480,
+              "USB_MIDI_EVENTS_PER_PACKET must fill one High-Speed MIDI bulk packet");
+#endif
+
 class TeensyUsbMidiOut : public MidiOutputPort {
 public:
-    TeensyUsbMidiOut();
+    /**
+     * @brief Configuration de la file de sortie USB
+     */
+    struct Config {
+        bool enable_batching;        // false = send_now() après chaque message
+        uint8_t events_per_packet;   // Événements de 4 octets par paquet USB (128 en High-Speed)
+        uint32_t max_hold_us;        // Latence max d'un message dans la file
+
+        Config()
+            : enable_batching(SystemConstants::Audio::USB_MIDI_BATCHING_DEFAULT),
+              events_per_packet(SystemConstants::Audio::USB_MIDI_EVENTS_PER_PACKET),
+              max_hold_us(SystemConstants::Audio::USB_MIDI_MAX_HOLD_US) {}
+    };
+
+    /**
+     * @brief Statistiques de la file de sortie USB
+     */
+    struct Stats {
+        uint32_t events_sent;       // Événements MIDI transmis
+        uint32_t packets_sent;      // Paquets USB émis (send_now)
+        uint32_t full_packets;      // Paquets émis car pleins
+        uint32_t deadline_flushes;  // Vidages forcés par max_hold_us
+        uint32_t queue_overflows;   // Vidages forcés par file pleine
+        size_t queue_high_water;    // Profondeur maximale atteinte par la file
+
+        /**
+         * @brief Nombre moyen d'événements par paquet (x100 pour précision)
+         */
+        uint32_t eventsPerPacketX100() const {
+            return packets_sent > 0 ? (events_sent * 100) / packets_sent : 0;
+        }
+    };
+
+    explicit TeensyUsbMidiOut(const Config& config = Config());
 
     void sendControlChange(MidiChannel ch, MidiCC cc, uint8_t value) override;
     void sendNoteOn(MidiChannel ch, MidiNote note, uint8_t velocity) override;
@@ -24,9 +71,38 @@ public:
     void sendChannelPressure(MidiChannel ch, uint8_t pressure) override;
     void sendSysEx(const uint8_t* data, uint16_t length) override;
 
-    // Méthode additionelle pour vider le buffer et envoyer réellement les messages
+    /**
+     * @brief Vide la file de sortie et envoie réellement les messages
+     */
     void flush();
 
+    /**
+     * @brief À appeler à chaque tick du scheduler : vide la file si elle
+     * contient des messages
+     */
+    void update();
+
+    /**
+     * @brief Obtient les statistiques de la file de sortie
+     */
+    const Stats& getStats() const {
+        return stats_;
+    }
+
+    /**
+     * @brief Réinitialise les statistiques
+     */
+    void resetStats() {
+        stats_ = Stats{};
+    }
+
+    /**
+     * @brief Nombre de messages actuellement en attente
+     */
+    size_t getPendingCount() const {
+        return outgoing_.size();
+    }
+
 private:
     // Buffer pour garder la trace des notes actives et éviter les notes bloquées (utilise SystemConstants)
     static constexpr size_t MAX_ACTIVE_NOTES = SystemConstants::Audio::MAX_ACTIVE_NOTES;
@@ -37,8 +113,27 @@ private:
         bool active;
     };
 
+    Config config_;
+    Stats stats_{};
+    MidiBuffers::OutgoingMidiBuffer outgoing_;
+#ifdef LATENCY_TRACE
+    // Identifiants de trace, lus et écrits en phase avec outgoing_ (même taille)
+    static constexpr size_t OUTGOING_SIZE = 256;
+    RingBuffer<uint16_t, OUTGOING_SIZE> outgoingTraceIds_;
+#endif
     ActiveNote activeNotes_[MAX_ACTIVE_NOTES];
 
+    // Place un message dans la file (ou l'envoie directement si batching désactivé)
+    void enqueue(uint8_t status, uint8_t data1, uint8_t data2);
+
+    // Écrit un message dans le paquet USB courant de usbMIDI
+    void writeToUsb(const MidiBuffers::MidiMessage& message);
+
+#ifdef LATENCY_TRACE
+    // Horodate l'envoi USB des messages d'un paquet
+    void traceSent(const uint16_t* traceIds, uint8_t count);
+#endif
+
     // Marque une note comme active
     void markNoteActive(MidiChannel ch, MidiNote note);
 
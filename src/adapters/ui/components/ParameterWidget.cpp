@@ -3,6 +3,12 @@
 #include "adapters/ui/components/ButtonIndicator.hpp"
 #include "core/utils/FlashStrings.hpp"
 
+ParameterWidget::UpdateStats ParameterWidget::update_stats_;
+unsigned long ParameterWidget::stats_window_start_ = 0;
+uint32_t ParameterWidget::window_received_ = 0;
+uint32_t ParameterWidget::window_applied_ = 0;
+std::function<void()> ParameterWidget::update_callback_;
+
 
 
 //=============================================================================
@@ -133,19 +139,40 @@ void ParameterWidget::positionLabels() {
 
 void ParameterWidget::setParameter(uint8_t cc_number, uint8_t channel, uint8_t value, 
                                   const String& parameter_name, bool animate) {
-    cc_number_ = cc_number;
+    update_stats_.received++;
+    window_received_++;
+
+    // Le label ne dépend que du nom et du CC
+    if (cc_number != cc_number_ || parameter_name != parameter_name_) {
+        cc_number_ = cc_number;
+        parameter_name_ = parameter_name;
+        labels_dirty_ = true;
+    }
     channel_ = channel;
     current_value_ = value;
-    parameter_name_ = parameter_name;
-    
-    updateLabels();
-    updateArcValue(animate);
+    markPending(animate);
 }
 
 void ParameterWidget::setValue(uint8_t value, bool animate) {
+    update_stats_.received++;
+    window_received_++;
+
     if (current_value_ != value) {
         current_value_ = value;
-        updateArcValue(animate);
+        markPending(animate);
+    }
+}
+
+void ParameterWidget::markPending(bool animate) {
+    pending_animate_ = animate;
+    if (pending_value_update_) {
+        return;
+    }
+
+    // Premier changement depuis la dernière trame : réveiller la tâche UI
+    pending_value_update_ = true;
+    if (update_callback_) {
+        update_callback_();
     }
 }
 
@@ -213,8 +240,42 @@ void ParameterWidget::setInteractionEnabled(bool enable) {
 }
 
 void ParameterWidget::processPendingUpdates() {
-    // Plus besoin de pending updates avec EventBatcher
-    // Méthode conservée pour compatibilité mais vide
+    rollUpdateStats();
+
+    if (!pending_value_update_) {
+        return;
+    }
+    pending_value_update_ = false;
+
+    update_stats_.applied++;
+    window_applied_++;
+
+    if (labels_dirty_) {
+        labels_dirty_ = false;
+        updateLabels();
+        update_stats_.label_rebuilds++;
+    }
+
+    updateArcValue(pending_animate_);
+}
+
+void ParameterWidget::resetUpdateStats() {
+    update_stats_ = UpdateStats{};
+    stats_window_start_ = millis();
+    window_received_ = 0;
+    window_applied_ = 0;
+}
+
+void ParameterWidget::printUpdateStats() {
+    Serial.printf("ParameterWidget per s: received=%lu applied=%lu "
+                  "(total received=%lu applied=%lu labels=%lu arc=%lu arc skipped=%lu)\n",
+                  static_cast<unsigned long>(update_stats_.received_per_s),
+                  static_cast<unsigned long>(update_stats_.applied_per_s),
+                  static_cast<unsigned long>(update_stats_.received),
+                  static_cast<unsigned long>(update_stats_.applied),
+                  static_cast<unsigned long>(update_stats_.label_rebuilds),
+                  static_cast<unsigned long>(update_stats_.arc_updates),
+                  static_cast<unsigned long>(update_stats_.arc_skips));
 }
 
 //=============================================================================
@@ -232,18 +293,39 @@ void ParameterWidget::updateLabels() {
 void ParameterWidget::updateArcValue(bool animate) {
     if (!arc_) return;
 
-    // Vérifier si la valeur a réellement changé pour éviter redraws inutiles
-    int32_t current_arc_value = lv_arc_get_value(arc_);
-    if (current_arc_value == current_value_) {
-        return; // Pas de changement, éviter le redraw
+    // Extrémité de l'arc immobile au pixel près : éviter le redraw
+    const uint16_t pixel = arcPixelFor(current_value_);
+    if (pixel == applied_arc_pixel_) {
+        if (lv_arc_get_value(arc_) != current_value_) {
+            update_stats_.arc_skips++;
+        }
+        return;
     }
+    applied_arc_pixel_ = pixel;
 
-    // Utiliser directement la valeur MIDI (0-127) car l'arc est configuré avec cette plage
+    // Utiliser directement la valeur MIDI (0-127) car l'arc est configuré avec cette plage.
+    // lv_arc_set_value() invalide lui-même la portion d'arc et le knob déplacés
     lv_arc_set_value(arc_, current_value_);
-    
-    // Invalider seulement la zone de l'arc pour optimiser le redraw
-    lv_obj_invalidate(arc_);
+    update_stats_.arc_updates++;
+}
+
+uint16_t ParameterWidget::arcPixelFor(uint8_t value) const {
+    // Course de 270° sur un rayon arc_size_/2 : longueur = rayon * 3π/2
+    return static_cast<uint16_t>((static_cast<uint32_t>(value) * (arc_size_ / 2) * 4712) / (127 * 1000));
+}
+
+void ParameterWidget::rollUpdateStats() {
+    const unsigned long now = millis();
+    const unsigned long windowMs = now - stats_window_start_;
+    if (windowMs < 1000) {
+        return;
+    }
 
+    update_stats_.received_per_s = static_cast<uint32_t>(window_received_ * 1000UL / windowMs);
+    update_stats_.applied_per_s = static_cast<uint32_t>(window_applied_ * 1000UL / windowMs);
+    stats_window_start_ = now;
+    window_received_ = 0;
+    window_applied_ = 0;
 }
 
 void ParameterWidget::setupLegacyStyles() {
@@ -23,6 +23,22 @@ class ButtonIndicator;
  */
 class ParameterWidget {
 public:
+    /**
+     * @brief Compteurs de mises à jour, communs à tous les widgets
+     *
+     * Les mises à jour reçues pendant une trame sont regroupées : seule la
+     * dernière valeur est appliquée par processPendingUpdates().
+     */
+    struct UpdateStats {
+        uint32_t received = 0;              ///< Appels setParameter() / setValue()
+        uint32_t applied = 0;               ///< Mises à jour appliquées (une par widget et par trame)
+        uint32_t label_rebuilds = 0;        ///< Textes de label reconstruits
+        uint32_t arc_updates = 0;           ///< Valeurs transmises à l'arc LVGL
+        uint32_t arc_skips = 0;             ///< Valeurs sans déplacement d'un pixel, ignorées
+        // Dernière fenêtre d'une seconde
+        uint32_t received_per_s = 0;
+        uint32_t applied_per_s = 0;
+    };
 
     /**
      * @brief Constructeur avec UITheme (recommandé)
@@ -54,6 +70,8 @@ public:
 
     /**
      * @brief Met à jour les informations du paramètre
+     *
+     * La mise à jour est différée jusqu'au prochain processPendingUpdates().
      * @param cc_number Numéro CC (0-127)
      * @param channel Canal MIDI (1-16)
      * @param value Valeur (0-127)
@@ -64,7 +82,7 @@ public:
                      const String& parameter_name, bool animate = true);
 
     /**
-     * @brief Met à jour uniquement la valeur
+     * @brief Met à jour uniquement la valeur (différée comme setParameter())
      * @param value Nouvelle valeur (0-127)
      * @param animate Utiliser animation
      */
@@ -134,10 +152,38 @@ public:
     lv_obj_t* getArc() const { return arc_; }
     
     /**
-     * @brief Traite les mises à jour différées (appelé périodiquement)
+     * @brief Applique la mise à jour en attente (appelé une fois par trame)
+     *
+     * Le label n'est reconstruit que si le nom ou le CC a changé, et l'arc
+     * n'est modifié que si son extrémité se déplace d'au moins un pixel.
      */
     void processPendingUpdates();
 
+    /**
+     * @brief Callback de réveil de la tâche UI, commun à tous les widgets
+     *
+     * Appelé quand un widget passe de l'état à jour à une mise à jour en
+     * attente, y compris depuis une autre tâche (retour MIDI du DAW).
+     */
+    static void setUpdateCallback(std::function<void()> callback) {
+        update_callback_ = std::move(callback);
+    }
+
+    /**
+     * @brief Obtient les compteurs de mises à jour de tous les widgets
+     */
+    static const UpdateStats& getUpdateStats() { return update_stats_; }
+
+    /**
+     * @brief Remet à zéro les compteurs de mises à jour
+     */
+    static void resetUpdateStats();
+
+    /**
+     * @brief Affiche les compteurs de mises à jour sur le port série
+     */
+    static void printUpdateStats();
+
     // === GESTION BUTTON INDICATOR ===
 
     /**
@@ -198,8 +244,18 @@ private:
     // Widget optionnel pour indicateur de bouton
     std::unique_ptr<ButtonIndicator> button_indicator_;  ///< Indicateur bouton (optionnel)
     
-    // Optimisation performance
+    // Mise à jour différée : l'état ci-dessus est appliqué une fois par trame
     bool pending_value_update_ = false;
+    bool pending_animate_ = false;
+    bool labels_dirty_ = false;
+    uint16_t applied_arc_pixel_ = 0;    ///< Position de l'extrémité de l'arc affichée
+
+    // Compteurs communs et fenêtre d'une seconde
+    static UpdateStats update_stats_;
+    static unsigned long stats_window_start_;
+    static uint32_t window_received_;
+    static uint32_t window_applied_;
+    static std::function<void()> update_callback_;
     
     
     // === MÉTHODES PRIVÉES ===
@@ -229,6 +285,22 @@ private:
      * @param animate Utiliser animation
      */
     void updateArcValue(bool animate);
+
+    /**
+     * @brief Position en pixels de l'extrémité de l'arc le long de sa course
+     * @param value Valeur (0-127)
+     */
+    uint16_t arcPixelFor(uint8_t value) const;
+
+    /**
+     * @brief Marque la mise à jour en attente, réveille la tâche UI au premier changement
+     */
+    void markPending(bool animate);
+
+    /**
+     * @brief Clôt la fenêtre de mesure d'une seconde si elle est écoulée
+     */
+    static void rollUpdateStats();
     
     /**
      * @brief Positionne l'indicateur de bouton dans le widget
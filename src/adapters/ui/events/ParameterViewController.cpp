@@ -382,7 +382,9 @@ void ParameterViewController::subscribeToEvents() {
     }
     
     // S'abonner avec HAUTE PRIORITÉ pour recevoir les événements HighPriorityButtonPress
-    event_subscription_id_ = eventBus_->subscribeHigh(this);
+    event_subscription_id_ = eventBus_->subscribeToTypes(
+        this, {UIDisplayEvents::UIParameterUpdate, EventTypes::HighPriorityButtonPress},
+        EventPriority::PRIORITY_HIGH);
     logDebug("Subscribed to events with ID: " + String(event_subscription_id_));
 }
 
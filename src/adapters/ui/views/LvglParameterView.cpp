@@ -200,7 +200,9 @@ void LvglParameterView::subscribeToEvents() {
     }
     
     // S'abonner avec HAUTE PRIORITÉ pour recevoir les événements HighPriorityButtonPress
-    event_subscription_id_ = eventBus_->subscribeHigh(this);
+    event_subscription_id_ = eventBus_->subscribeToTypes(
+        this, {UIDisplayEvents::UIParameterUpdate, EventTypes::HighPriorityButtonPress},
+        EventPriority::PRIORITY_HIGH);
 }
 
 void LvglParameterView::unsubscribeFromEvents() {
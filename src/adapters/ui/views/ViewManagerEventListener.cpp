@@ -12,7 +12,17 @@ ViewManagerEventListener::~ViewManagerEventListener() {
 
 void ViewManagerEventListener::subscribe() {
     if (m_subscriptionId == 0 && m_eventBus) {
-        m_subscriptionId = m_eventBus->subscribe(this);
+        // Seuls les types traités par handleMidiEvent/handleInputEvent : les
+        // événements UI (batch MIDI à la cadence d'affichage) ne passent plus ici
+        m_subscriptionId = m_eventBus->subscribeToTypes(this,
+                                                        {EventTypes::MidiControlChange,
+                                                         EventTypes::MidiNoteOn,
+                                                         EventTypes::MidiNoteOff,
+                                                         EventTypes::MidiMapping,
+                                                         EventTypes::EncoderTurned,
+                                                         EventTypes::EncoderButton,
+                                                         EventTypes::ButtonPressed,
+                                                         EventTypes::ButtonReleased});
         // TODO DEBUG MSG
     }
 }
@@ -3,6 +3,7 @@
 #include <Arduino.h>
 
 // Inclusions nécessaires pour l'implémentation
+#include "adapters/ui/components/ParameterWidget.hpp"
 #include "adapters/ui/views/DefaultViewManager.hpp"
 #include "adapters/secondary/hardware/display/Ili9341Driver.hpp"
 #include "adapters/secondary/hardware/display/Ili9341LvglBridge.hpp"
@@ -200,10 +201,20 @@ Result<bool> InitializationScript::initializeSubsystems(
              container->registerDependency<IInputSystem>(system);
              auto initResult = system->init();
              if (initResult.isSuccess()) {
-                 scheduler->addTask([system]() { system->update(); },
-                                    SystemConstants::Performance::INPUT_TIME_INTERVAL,
-                                    0,
-                                    "InputUpdate");
+                 if (SystemConstants::Performance::EVENT_DRIVEN_TASKS) {
+                     // Réveil dès qu'un instantané du timer est en file ; en mode
+                     // polling, l'attente maximale conserve la cadence de scan
+                     scheduler->addEventTask([system]() { system->update(); },
+                                             SystemConstants::Performance::INPUT_TIME_INTERVAL,
+                                             0,
+                                             "InputUpdate",
+                                             [system]() { return system->hasPendingWork(); });
+                 } else {
+                     scheduler->addTask([system]() { system->update(); },
+                                        SystemConstants::Performance::INPUT_TIME_INTERVAL,
+                                        0,
+                                        "InputUpdate");
+                 }
              }
              return initResult;
          }});
@@ -215,10 +226,27 @@ Result<bool> InitializationScript::initializeSubsystems(
              container->registerDependency<IMidiSystem>(system);
              auto initResult = system->init();
              if (initResult.isSuccess()) {
-                 scheduler->addTask([system]() { system->update(); },
-                                    SystemConstants::Performance::MIDI_TIME_INTERVAL,
-                                    1,
-                                    "MidiUpdate");
+                 if (SystemConstants::Performance::EVENT_DRIVEN_TASKS) {
+                     TaskScheduler* sched = scheduler.get();
+                     scheduler->addEventTask(
+                         [system, sched]() {
+                             system->update();
+                             // Notes temporisées : réveil à la cadence MIDI tant qu'elles sont actives
+                             if (system->hasTimedCommands()) {
+                                 sched->wakeAfter(sched->getCurrentTask(),
+                                                  SystemConstants::Performance::MIDI_TIME_INTERVAL);
+                             }
+                         },
+                         SystemConstants::Performance::MIDI_MAX_SLEEP_US,
+                         1,
+                         "MidiUpdate",
+                         [system]() { return system->hasPendingWork(); });
+                 } else {
+                     scheduler->addTask([system]() { system->update(); },
+                                        SystemConstants::Performance::MIDI_TIME_INTERVAL,
+                                        1,
+                                        "MidiUpdate");
+                 }
                  
                  // REFACTOR: Navigation maintenant gérée par InputSubsystem
                  // Plus besoin de synchronisation manuelle depuis MidiSubsystem
@@ -231,10 +259,39 @@ Result<bool> InitializationScript::initializeSubsystems(
              container->registerDependency<IUISystem>(system);
              auto initResult = system->init(true);  // true = enable full UI
              if (initResult.isSuccess()) {
-                 scheduler->addTask([system]() { system->update(); },
-                                    SystemConstants::Performance::DISPLAY_REFRESH_PERIOD_MS * 1000,
-                                    1,
-                                    "UIUpdate");
+                 auto bridge = container->resolve<Ili9341LvglBridge>();
+                 if (SystemConstants::Performance::EVENT_DRIVEN_TASKS && bridge) {
+                     TaskScheduler* sched = scheduler.get();
+                     auto eventBus = container->resolve<EventBus>();
+                     TaskHandle uiTask = scheduler->addEventTask(
+                         [system, sched, bridge]() {
+                             system->update();
+                             // Réveil au prochain timer LVGL (rafraîchissement, animations)
+                             uint32_t nextMs = bridge->getTimeUntilNextRefreshMs();
+                             if (nextMs != LV_NO_TIMER_READY) {
+                                 sched->wakeAfter(sched->getCurrentTask(), nextMs * 1000);
+                             }
+                         },
+                         SystemConstants::Performance::UI_MAX_SLEEP_US,
+                         1,
+                         "UIUpdate",
+                         [eventBus]() { return eventBus && eventBus->hasPendingWork(); });
+
+                     // Les invalidations faites par la tâche UI sont rendues dans le même passage
+                     auto wakeUi = [sched, uiTask]() {
+                         if (sched->getCurrentTask() != uiTask) {
+                             sched->notify(uiTask);
+                         }
+                     };
+                     bridge->setInvalidateCallback(wakeUi);
+                     // Retour de valeur depuis la tâche MIDI (publication immédiate sur le bus)
+                     ParameterWidget::setUpdateCallback(wakeUi);
+                 } else {
+                     scheduler->addTask([system]() { system->update(); },
+                                        SystemConstants::Performance::DISPLAY_REFRESH_PERIOD_MS * 1000,
+                                        1,
+                                        "UIUpdate");
+                 }
              }
              return initResult;
          }});
@@ -289,7 +346,13 @@ void InitializationScript::setupMidiEventListeners(std::shared_ptr<DependencyCon
         return;
     }
     MidiMapper& midiMapper = midiSystem->getMidiMapper();
-    SubscriptionId subscriptionId = eventBus->subscribeHigh(&midiMapper);
+    // Seuls les événements d'entrée traités par MidiMapper::onEvent lui sont distribués
+    SubscriptionId subscriptionId = eventBus->subscribeToTypes(
+        &midiMapper,
+        {EventTypes::HighPriorityEncoderChanged, EventTypes::HighPriorityButtonPress,
+         EventTypes::EncoderTurned, EventTypes::EncoderButton, EventTypes::ButtonPressed,
+         EventTypes::ButtonReleased},
+        EventPriority::PRIORITY_HIGH);
     
     if (subscriptionId != 0) {
     } else {
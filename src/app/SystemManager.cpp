@@ -1,6 +1,7 @@
 #include "SystemManager.hpp"
 
 #include "app/InitializationScript.hpp"
+#include "tools/Diagnostics.hpp"
 
 SystemManager::SystemManager()
     : currentState_(State::UNINITIALIZED), lastErrorTime_(0) {}
@@ -113,6 +114,7 @@ Result<void> SystemManager::attemptRecovery() {
 void SystemManager::updateRunningState() {
     if (app_) {
         app_->update();
+        DiagnosticsManager::pollSerialCommands();
     } else {
         Serial.println("⚠️  App became null during runtime, entering recovery mode");
         enterRecoveryMode();
@@ -1,11 +1,16 @@
 #include "InputManagerService.hpp"
 
+#include "adapters/secondary/hardware/input/TimerInputSampler.hpp"
 #include "adapters/secondary/hardware/input/buttons/DigitalButtonManager.hpp"
 #include "adapters/secondary/hardware/input/encoders/EncoderManager.hpp"
 #include "core/controllers/InputController.hpp"
+#include "core/use_cases/ButtonGestureRecognizer.hpp"
 #include "core/use_cases/ProcessButtons.hpp"
 #include "core/use_cases/ProcessEncoders.hpp"
+
+#include <bit>
 #include "core/utils/Error.hpp"
+#include "core/utils/LatencyTrace.hpp"
 
 InputManagerService::InputManagerService(const ManagerConfig& config)
     : config_(config)
@@ -40,8 +45,14 @@ Result<bool> InputManagerService::initialize(const std::vector<ControlDefinition
             return processorResult;
         }
 
+        createGestureRecognizer(buttonConfigs);
+
         // Connecter les processeurs au contrôleur
         connectProcessors();
+
+        if (config_.enableTimerSampling) {
+            startTimerSampling();
+        }
     }
 
     initialized_ = true;
@@ -53,6 +64,20 @@ void InputManagerService::update() {
         return;
     }
 
+    // Mode timer : boutons et encodeurs sont relevés en interruption, il reste à
+    // débouncer les instantanés et à convertir les compteurs en crans
+    if (sampler_) {
+        PeriodicTimer::serviceAll(micros());  // No-op sur Teensy, horloge du stub hôte
+        if (!sampler_->capturesEncoders() && processEncoders_) {
+            processEncoders_->update();
+        }
+        drainSampledEvents();
+        if (gestures_) {
+            gestures_->advance(micros());
+        }
+        return;
+    }
+
     // Mettre à jour les gestionnaires de matériel
     if (config_.enableEncoders && encoderManager_) {
         encoderManager_->updateAll();
@@ -71,6 +96,10 @@ void InputManagerService::update() {
         if (processButtons_) {
             processButtons_->update();
         }
+
+        if (gestures_) {
+            gestures_->advance(micros());
+        }
     }
 }
 
@@ -82,7 +111,9 @@ Result<bool> InputManagerService::reconfigure(const std::vector<ControlDefinitio
     // Réinitialiser complètement avec les nouvelles configurations
     initialized_ = false;
     
-    // Nettoyer les anciens composants
+    // Nettoyer les anciens composants (arrêter le timer avant de libérer les ports)
+    sampler_.reset();
+    gestures_.reset();
     processEncoders_.reset();
     processButtons_.reset();
     encoderManager_.reset();
@@ -128,6 +159,18 @@ DigitalButtonManager* InputManagerService::getButtonManager() const {
     return buttonManager_.get();
 }
 
+bool InputManagerService::hasPendingWork() const {
+    return sampler_ && sampler_->hasPending();
+}
+
+TimerInputSampler* InputManagerService::getInputSampler() const {
+    return sampler_.get();
+}
+
+ButtonGestureRecognizer* InputManagerService::getGestureRecognizer() const {
+    return gestures_.get();
+}
+
 std::vector<EncoderConfig> InputManagerService::extractEncoderConfigs(const std::vector<ControlDefinition>& controlDefinitions) const {
     std::vector<EncoderConfig> encoderConfigs;
     
@@ -143,8 +186,13 @@ std::vector<EncoderConfig> InputManagerService::extractEncoderConfigs(const std:
                 hwConfig.enableAcceleration = encConfig->enableAcceleration;
                 hwConfig.stepsPerDetent = encConfig->stepsPerDetent;
                 hwConfig.invertDirection = false;      // Valeur par défaut
-                hwConfig.accelerationThreshold = 100;  // Valeur par défaut
-                hwConfig.maxAcceleration = 5.0f;       // Valeur par défaut
+                hwConfig.accelerationThreshold =
+                    encConfig->accelerationThresholdMs > 0
+                        ? encConfig->accelerationThresholdMs
+                        : SystemConstants::Encoders::ACCELERATION_THRESHOLD_MS;
+                hwConfig.maxAcceleration = encConfig->maxAcceleration > 0.0f
+                                               ? encConfig->maxAcceleration
+                                               : SystemConstants::Encoders::MAX_ACCELERATION;
                 
                 encoderConfigs.push_back(hwConfig);
             }
@@ -170,7 +218,7 @@ std::vector<ButtonConfig> InputManagerService::extractButtonConfigs(const std::v
                     hwConfig.longPressMs = *btnConfig->longPressMs;
                     hwConfig.enableLongPress = true;
                 } else {
-                    hwConfig.longPressMs = 800;  // Valeur par défaut
+                    hwConfig.longPressMs = SystemConstants::Buttons::DEFAULT_LONG_PRESS_MS;
                     hwConfig.enableLongPress = false;
                 }
                 
@@ -194,7 +242,9 @@ Result<bool> InputManagerService::createManagers(const std::vector<EncoderConfig
 
     // Créer le gestionnaire de boutons si activé et qu'il y a des configurations
     if (config_.enableButtons && !buttonConfigs.empty()) {
-        buttonManager_ = std::make_unique<DigitalButtonManager>(buttonConfigs);
+        // Seuils de la scrutation ; TimerInputSampler::start() les recalcule en ticks
+        buttonManager_ = std::make_unique<DigitalButtonManager>(
+            buttonConfigs, SystemConstants::Performance::INPUT_TIME_INTERVAL);
         if (!buttonManager_) {
             return Result<bool>::error(Error(ErrorCode::InitializationFailed, "Failed to create DigitalButtonManager"));
         }
@@ -235,5 +285,93 @@ void InputManagerService::connectProcessors() {
     
     if (processButtons_) {
         processButtons_->setInputController(inputController_.get());
+
+        // Mode scrutation : le flux de boutons alimente aussi les gestes
+        if (gestures_) {
+            processButtons_->setOnButtonStateChangedCallback([this](uint8_t id, bool pressed) {
+                inputController_->processButtonPress(id, pressed);
+                gestures_->onButtonEvent(id, pressed, micros());
+            });
+        }
     }
-}
\ No newline at end of file
+
+    if (gestures_) {
+        gestures_->setCallback([this](const ButtonGesture& gesture) {
+            inputController_->processButtonGesture(gesture);
+        });
+    }
+}
+
+void InputManagerService::startTimerSampling() {
+    if (!buttonManager_ && !encoderManager_) {
+        return;
+    }
+
+    sampler_ = std::make_unique<TimerInputSampler>(buttonManager_.get(), encoderManager_.get());
+    if (!sampler_->start(config_.samplingPeriodUs)) {
+        Serial.println("[InputManagerService] WARNING: Timer sampling unavailable, falling back to polling");
+        sampler_.reset();
+        return;
+    }
+
+    // L'état initial des boutons est suivi par l'échantillonneur
+    if (processButtons_) {
+        processButtons_->initStates();
+    }
+}
+
+void InputManagerService::drainSampledEvents() {
+    // Compteurs d'encodeurs : crans et accélération à l'horodatage du relevé
+    TimerInputSampler::EncoderSample step;
+    while (sampler_->pollEncoder(step)) {
+        LATENCY_TRACE_TIMESTAMP(readStart);
+        const int8_t delta = encoderManager_->applyCount(step.index, step.count, step.timestampUs);
+        if (delta == 0 || !inputController_) {
+            continue;
+        }
+        LATENCY_TRACE_BEGIN(readStart);
+        const EncoderPort* encoder = encoderManager_->getEncoders()[step.index];
+        inputController_->processEncoderTurn(encoder->getId(), encoder->getAbsolutePosition(), delta);
+        LATENCY_TRACE_END();
+    }
+
+    if (!buttonManager_) {
+        return;
+    }
+
+    DigitalButtonManager& buttons = *buttonManager_;
+    const auto& ports = buttons.getButtons();
+
+    // Chaque instantané porte les pins directes et un seul canal du multiplexeur :
+    // l'anti-rebond n'avance que pour les boutons lus à ce tick
+    TimerInputSampler::RawSample sample;
+    while (sampler_->poll(sample)) {
+        DigitalButtonManager::Mask changed = buttons.applySample(sample.levels, sample.mux, sample.timestampUs);
+        if (!changed || !inputController_) {
+            continue;
+        }
+
+        const DigitalButtonManager::Mask pressedMask = buttons.getPressedMask();
+        while (changed) {
+            const size_t index = static_cast<size_t>(std::countr_zero(changed));
+            changed &= changed - 1;
+            const InputId id = ports[index]->getId();
+            const bool pressed = (pressedMask >> index) & 1;
+            inputController_->processButtonPress(id, pressed);
+            if (gestures_) {
+                gestures_->onButtonEvent(id, pressed, sample.timestampUs);
+            }
+        }
+    }
+}
+
+void InputManagerService::createGestureRecognizer(const std::vector<ButtonConfig>& buttonConfigs) {
+    if (!config_.enableButtons || buttonConfigs.empty()) {
+        return;
+    }
+
+    gestures_ = std::make_unique<ButtonGestureRecognizer>();
+    for (const auto& cfg : buttonConfigs) {
+        gestures_->addButton(cfg.id, cfg.enableLongPress ? cfg.longPressMs : 0);
+    }
+}
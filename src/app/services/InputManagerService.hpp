@@ -15,6 +15,8 @@ class DigitalButtonManager;
 class ProcessEncoders;
 class ProcessButtons;
 class InputController;
+class TimerInputSampler;
+class ButtonGestureRecognizer;
 
 /**
  * @brief Service de gestion centralisée des entrées utilisateur
@@ -50,6 +52,14 @@ public:
      */
     void update() override;
 
+    /**
+     * @brief Indique si des instantanés du timer attendent d'être traités
+     *
+     * Sans effet de bord ; sonde de réveil de la tâche d'entrée. Toujours
+     * false en mode polling, où la tâche garde sa cadence INPUT_TIME_INTERVAL.
+     */
+    bool hasPendingWork() const;
+
     /**
      * @brief Reconfigure les entrées avec nouvelles définitions
      * @param controlDefinitions Nouvelles définitions de contrôles
@@ -75,6 +85,18 @@ public:
      */
     DigitalButtonManager* getButtonManager() const;
 
+    /**
+     * @brief Obtient l'échantillonneur timer (statistiques de gigue et d'âge)
+     * @return Pointeur vers TimerInputSampler ou nullptr en mode scrutation
+     */
+    TimerInputSampler* getInputSampler() const;
+
+    /**
+     * @brief Obtient le reconnaisseur de gestes (appui long, double clic, accord)
+     * @return Pointeur vers ButtonGestureRecognizer ou nullptr
+     */
+    ButtonGestureRecognizer* getGestureRecognizer() const;
+
 private:
     ManagerConfig config_;
     bool initialized_;
@@ -87,6 +109,12 @@ private:
     std::unique_ptr<ProcessEncoders> processEncoders_;
     std::unique_ptr<ProcessButtons> processButtons_;
 
+    // Relevé des boutons et encodeurs en interruption timer (nullptr en mode scrutation)
+    std::unique_ptr<TimerInputSampler> sampler_;
+
+    // Gestes bouton, alimentés par le flux d'événements débouncés
+    std::unique_ptr<ButtonGestureRecognizer> gestures_;
+
     // Contrôleur d'entrée
     std::shared_ptr<InputController> inputController_;
 
@@ -123,4 +151,20 @@ private:
      * @brief Connecte les processeurs au contrôleur
      */
     void connectProcessors();
+
+    /**
+     * @brief Démarre l'échantillonnage timer, repli sur la scrutation en cas d'échec
+     */
+    void startTimerSampling();
+
+    /**
+     * @brief Traite les relevés du timer (crans d'encodeurs, boutons débouncés)
+     */
+    void drainSampledEvents();
+
+    /**
+     * @brief Crée le reconnaisseur de gestes à partir des configurations de boutons
+     * @param buttonConfigs Configurations de boutons (seuils d'appui long)
+     */
+    void createGestureRecognizer(const std::vector<ButtonConfig>& buttonConfigs);
 };
\ No newline at end of file
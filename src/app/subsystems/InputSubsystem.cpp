@@ -74,6 +74,10 @@ void InputSubsystem::update() {
     inputManager_->update();
 }
 
+bool InputSubsystem::hasPendingWork() const {
+    return initialized_ && inputManager_ && inputManager_->hasPendingWork();
+}
+
 Result<bool> InputSubsystem::configureInputs(const std::vector<ControlDefinition>& controlDefinitions) {
     if (!initialized_ || !inputManager_) {
         return Result<bool>::error({ErrorCode::OperationFailed, "InputSubsystem not initialized"});
@@ -54,6 +54,11 @@ public:
      */
     void update() override;
 
+    /**
+     * @brief Sonde de réveil de la tâche d'entrée (voir InputManagerService::hasPendingWork)
+     */
+    bool hasPendingWork() const;
+
     Result<bool> configureInputs(const std::vector<ControlDefinition>& controlDefinitions) override;
     std::vector<ControlDefinition> getAllActiveControlDefinitions() const override;
     std::optional<ControlDefinition> getControlDefinitionById(InputId id) const override;
@@ -4,10 +4,12 @@
 #include <usb_midi.h>
 #include <set>
 
+#include "adapters/secondary/midi/MidiOutputCoalescer.hpp"
 #include "adapters/secondary/midi/MidiOutputEventAdapter.hpp"
 #include "adapters/secondary/midi/TeensyUsbMidiOut.hpp"
 #include "core/domain/commands/CommandManager.hpp"
 #include "core/utils/Error.hpp"
+#include "core/utils/InputRecorder.hpp"
 
 MidiSubsystem::MidiSubsystem(std::shared_ptr<DependencyContainer> container)
     : container_(container), initialized_(false) {}
@@ -53,8 +55,17 @@ Result<bool> MidiSubsystem::init() {
         return Result<bool>::error({ErrorCode::DependencyMissing, "Failed to resolve IEventBus"});
     }
     
-    // Créer l'MidiOutputEventAdapter qui va décorer directement TeensyUsbMidiOut
-    auto midiOutputEventAdapter = std::make_shared<MidiOutputEventAdapter>(*baseMidiOut, eventBus);
+    // Créer l'étage de coalescence des CC devant TeensyUsbMidiOut
+    auto midiOutputCoalescer = std::make_shared<MidiOutputCoalescer>(*baseMidiOut);
+    if (!midiOutputCoalescer) {
+        return Result<bool>::error(
+            {ErrorCode::InitializationFailed, "Failed to create MidiOutputCoalescer"});
+    }
+
+    // Créer l'MidiOutputEventAdapter qui décore l'étage de coalescence
+    // (les événements UI restent émis pour chaque valeur, seul l'USB est coalescé)
+    auto midiOutputEventAdapter =
+        std::make_shared<MidiOutputEventAdapter>(*midiOutputCoalescer, eventBus);
     if (!midiOutputEventAdapter) {
         return Result<bool>::error(
             {ErrorCode::InitializationFailed, "Failed to create MidiOutputEventAdapter"});
@@ -63,12 +74,16 @@ Result<bool> MidiSubsystem::init() {
 
     // Utiliser MidiOutputEventAdapter comme interface MidiOutputPort
     midiOut_ = midiOutputEventAdapter;
+    usbMidiOut_ = baseMidiOut;
+    coalescer_ = midiOutputCoalescer;
+    eventAdapter_ = midiOutputEventAdapter;
 
     // Enregistrer l'implémentation que nous venons de créer
     container_->registerImplementation<MidiOutputPort, MidiOutputPort>(midiOut_);
 
     // Enregistrer également les objets intermédiaires pour éviter qu'ils soient détruits
     container_->registerDependency<TeensyUsbMidiOut>(baseMidiOut);
+    container_->registerDependency<MidiOutputCoalescer>(midiOutputCoalescer);
     container_->registerDependency<MidiOutputEventAdapter>(midiOutputEventAdapter);
 
     // Créer le MidiMapper
@@ -88,7 +103,9 @@ Result<bool> MidiSubsystem::init() {
     midiConfig.enable_event_integration = true;
     midiConfig.enable_performance_monitoring = true;
     
-    highPerformanceMidiManager_ = std::make_unique<HighPerformanceMidiManager>(midiConfig, eventPoolManager_);
+    // Les retours CC entrants sont publiés sur l'EventBus à la cadence d'affichage
+    highPerformanceMidiManager_ =
+        std::make_unique<HighPerformanceMidiManager>(midiConfig, eventPoolManager_, eventBus);
     if (!highPerformanceMidiManager_) {
         return Result<bool>::error({ErrorCode::InitializationFailed, "Failed to create HighPerformanceMidiManager"});
     }
@@ -106,23 +123,55 @@ Result<bool> MidiSubsystem::init() {
     return Result<bool>::success(true);
 }
 
+uint32_t MidiSubsystem::readIncomingUsb() {
+    uint32_t count = 0;
+
+    // Lire tous les messages MIDI disponibles
+    while (usbMIDI.read()) {
+        uint8_t type = usbMIDI.getType();
+        uint8_t channel = usbMIDI.getChannel() - 1; // Lib Teensy utilise canaux 1-16, nous utilisons 0-15
+        uint8_t data1 = usbMIDI.getData1();
+        uint8_t data2 = usbMIDI.getData2();
+
+        // Construire le status byte MIDI
+        uint8_t status = type | channel;
+        INPUT_RECORD_MIDI(status, data1, data2);
+
+        // Envoyer au gestionnaire haute performance
+        highPerformanceMidiManager_->processMidiMessage(status, data1, data2);
+        count++;
+    }
+
+    return count;
+}
+
+bool MidiSubsystem::hasPendingWork() const {
+    if (!highPerformanceMidiManager_) {
+        return false;
+    }
+
+    // Teensy n'expose pas d'interruption de réception USB MIDI : l'occupation
+    // de la file de réception du core est consultée sans la consommer
+    if (usb_midi_available() > 0 || highPerformanceMidiManager_->hasPendingWork()) {
+        return true;
+    }
+
+    if (usbMidiOut_ && usbMidiOut_->getPendingCount() > 0) {
+        return true;
+    }
+
+    return coalescer_ && coalescer_->isFlushDue(micros());
+}
+
+bool MidiSubsystem::hasTimedCommands() const {
+    return midiMapper_ && midiMapper_->hasActiveNotes();
+}
+
 void MidiSubsystem::update() {
     // Lire les messages MIDI entrants depuis usbMIDI et les envoyer au gestionnaire haute performance
     if (highPerformanceMidiManager_) {
-        // Lire tous les messages MIDI disponibles
-        while (usbMIDI.read()) {
-            uint8_t type = usbMIDI.getType();
-            uint8_t channel = usbMIDI.getChannel() - 1; // Lib Teensy utilise canaux 1-16, nous utilisons 0-15
-            uint8_t data1 = usbMIDI.getData1();
-            uint8_t data2 = usbMIDI.getData2();
-            
-            // Construire le status byte MIDI
-            uint8_t status = type | channel;
-            
-            // Envoyer au gestionnaire haute performance
-            highPerformanceMidiManager_->processMidiMessage(status, data1, data2);
-        }
-        
+        readIncomingUsb();
+
         // Traiter les messages MIDI entrants via le gestionnaire haute performance
         highPerformanceMidiManager_->update();
     }
@@ -131,6 +180,16 @@ void MidiSubsystem::update() {
     if (midiMapper_) {
         midiMapper_->update();
     }
+
+    // Transmettre la dernière valeur de chaque CC modifié pendant ce tick
+    if (coalescer_) {
+        coalescer_->update();
+    }
+
+    // Transmettre les messages sortants accumulés pendant ce tick
+    if (usbMidiOut_) {
+        usbMidiOut_->update();
+    }
 }
 
 Result<bool> MidiSubsystem::sendNoteOn(uint8_t channel, uint8_t note,
@@ -251,4 +310,16 @@ void MidiSubsystem::setupMidiMappingFromControlDefinition(const ControlDefinitio
     
     // Configuration simplifiée : pas besoin de stratégies
     midiMapper_->setMappingFromControlDefinition(controlDef);
+
+    // Les NRPN sont affichés sous le CC qui identifie le contrôle côté UI
+    for (const auto& mappingSpec : controlDef.mappings) {
+        if (mappingSpec.role != MappingRole::MIDI) {
+            continue;
+        }
+        const auto& midiConfig = std::get<ControlDefinition::MidiConfig>(mappingSpec.config);
+        if (midiConfig.resolution == MidiResolution::NRPN && eventAdapter_) {
+            eventAdapter_->setNrpnController(midiConfig.channel, midiConfig.nrpnParameter,
+                                             midiConfig.control);
+        }
+    }
 }
\ No newline at end of file
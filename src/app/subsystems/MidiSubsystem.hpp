@@ -4,6 +4,9 @@
 
 #include "config/unified/ControlDefinition.hpp"  // Pour ControlDefinition
 #include "adapters/secondary/midi/MidiMapper.hpp"
+#include "adapters/secondary/midi/MidiOutputCoalescer.hpp"
+#include "adapters/secondary/midi/MidiOutputEventAdapter.hpp"
+#include "adapters/secondary/midi/TeensyUsbMidiOut.hpp"
 #include "app/di/DependencyContainer.hpp"
 #include "core/domain/interfaces/IConfiguration.hpp"
 #include "core/domain/interfaces/IMidiSystem.hpp"
@@ -35,7 +38,7 @@ public:
      * @brief Initialise le sous-système MIDI
      *
      * Cette méthode configure la chaîne de traitement MIDI:
-     * TeensyUsbMidiOut -> BufferedMidiOut -> MidiOutputEventAdapter
+     * TeensyUsbMidiOut -> MidiOutputCoalescer -> MidiOutputEventAdapter
      *
      * @return Result<bool> Succès ou message d'erreur
      */
@@ -47,10 +50,26 @@ public:
      * Cette méthode effectue les opérations suivantes :
      * 1. Traite les messages MIDI entrants via HighPerformanceMidiManager
      * 2. Met à jour le MidiMapper pour les commandes temporisées
-     * 3. Traite les messages MIDI en attente dans BufferedMidiOut
+     * 3. Transmet les CC coalescés par MidiOutputCoalescer
+     * 4. Vide la file de sortie USB de TeensyUsbMidiOut (un paquet par tick)
      */
     void update() override;
 
+    /**
+     * @brief Indique si update() a du travail à effectuer maintenant
+     *
+     * Sans effet de bord : consulte la file de réception USB (sans lecture),
+     * les files entrante et sortante et les CC coalescés dus. Sert de sonde de
+     * réveil à la tâche MIDI de l'ordonnanceur, évaluée à chaque cycle.
+     * @return true si la tâche MIDI doit être réveillée
+     */
+    bool hasPendingWork() const;
+
+    /**
+     * @brief Indique si des commandes temporisées (notes) sont en cours
+     */
+    bool hasTimedCommands() const;
+
     /**
      * @brief Envoie un message MIDI Note On
      *
@@ -103,9 +122,18 @@ public:
     bool processMidiMessage(uint8_t status, uint8_t data1, uint8_t data2);
 
 private:
+    /**
+     * @brief Transfère les messages USB MIDI reçus vers HighPerformanceMidiManager
+     * @return Nombre de messages lus
+     */
+    uint32_t readIncomingUsb();
+
     std::shared_ptr<DependencyContainer> container_;
     std::shared_ptr<IConfiguration> configuration_;
     std::shared_ptr<MidiOutputPort> midiOut_;
+    std::shared_ptr<TeensyUsbMidiOut> usbMidiOut_;
+    std::shared_ptr<MidiOutputCoalescer> coalescer_;
+    std::shared_ptr<MidiOutputEventAdapter> eventAdapter_;
     std::unique_ptr<MidiMapper> midiMapper_;
     std::unique_ptr<HighPerformanceMidiManager> highPerformanceMidiManager_;
     std::shared_ptr<CommandManager> commandManager_;
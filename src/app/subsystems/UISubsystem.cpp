@@ -79,7 +79,7 @@ Result<bool> UISubsystem::init(bool enableFullUI) {
         // Créer DisplayManagerAdapter
         std::unique_ptr<DisplayManagerAdapter> displayManager = nullptr;
         if (m_lvglBridge) {
-            displayManager = std::make_unique<DisplayManagerAdapter>(m_lvglBridge);
+            displayManager = std::make_unique<DisplayManagerAdapter>(m_lvglBridge, eventBus);
         }
 
         // Initialiser UISystemAdapter avec tous les composants
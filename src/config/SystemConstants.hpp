@@ -40,6 +40,10 @@ namespace SystemConstants {
         constexpr int32_t MIN_DELTA_THRESHOLD = 1;
         constexpr int32_t MAX_DELTA_VALUE = INT_MAX;
         constexpr int32_t MIN_DELTA_VALUE = INT_MIN;
+
+        // Accélération (utilisée par EncoderAccelerator via EncoderConfig)
+        constexpr uint16_t ACCELERATION_THRESHOLD_MS = 100;  // Intervalle entre crans pour gain x1
+        constexpr float MAX_ACCELERATION = 5.0f;             // Gain atteint à un huitième du seuil
         
         // Actions par défaut (utilisées)
         constexpr NavigationAction DEFAULT_ACTION = NavigationAction::ITEM_NAVIGATOR;
@@ -55,6 +59,14 @@ namespace SystemConstants {
         constexpr NavigationAction DEFAULT_ACTION = NavigationAction::ITEM_VALIDATE;
         constexpr int DEFAULT_PARAMETER = 0;
         constexpr bool PROCESS_PRESS_ONLY = true;
+
+        // Boutons suivis (un bit par bouton : anti-rebond, derniers états, gestes)
+        constexpr size_t MAX_BUTTONS = 64;
+
+        // Gestes (ButtonGestureRecognizer)
+        constexpr uint16_t DEFAULT_LONG_PRESS_MS = 800;   // Si longPressMs absent de la config
+        constexpr uint16_t DOUBLE_CLICK_WINDOW_MS = 300;  // Relâchement -> second appui
+        constexpr uint16_t CHORD_WINDOW_MS = 80;          // Écart max entre appuis d'un accord
     }
     
     
@@ -100,6 +112,20 @@ namespace SystemConstants {
         // Pools et limitations MIDI (utilisées)
         constexpr size_t COMMAND_POOL_SIZE = 4;
         constexpr size_t MAX_ACTIVE_NOTES = 16;
+
+        // File de sortie USB MIDI (utilisée par TeensyUsbMidiOut)
+        constexpr bool USB_MIDI_BATCHING_DEFAULT = true;
+        constexpr uint8_t USB_MIDI_EVENTS_PER_PACKET = 128;  // 512 octets = paquet bulk High-Speed (Teensy 4.1)
+        constexpr uint32_t USB_MIDI_MAX_HOLD_US = 1000;      // Latence max avant envoi forcé
+
+        // Haute résolution 14 bits / NRPN (utilisée par MidiMapper)
+        constexpr uint16_t HIRES_VALUE_MAX = 16383;
+        constexpr uint16_t HIRES_DEFAULT_STEP = 64;  // Pas 14 bits par cran (128 = équivalent 7 bits)
+        constexpr size_t MAX_NRPN_UI_CONTROLLERS = 32;  // NRPN affichables (MidiOutputEventAdapter)
+
+        // Coalescence des CC sortants (utilisée par MidiOutputCoalescer)
+        constexpr uint32_t CC_COALESCE_WINDOW_US = 0;        // 0 = vidage à chaque tick MIDI
+        constexpr size_t CC_RATE_LIMITED_KEYS = 8;           // Clés à débit limité (setKeyMinInterval)
     }
     
     // ====================
@@ -165,7 +191,7 @@ namespace SystemConstants {
         // Buffers LVGL
         constexpr size_t LVGL_BUFFER_LINES = 120;
         constexpr size_t LVGL_BUFFER_SIZE = SCREEN_WIDTH * LVGL_BUFFER_LINES;
-        
+
         // Pins hardware ILI9341
         constexpr uint8_t CS_PIN = 28;
         constexpr uint8_t DC_PIN = 0;
@@ -195,6 +221,7 @@ namespace SystemConstants {
         // Configuration
         constexpr uint8_t MAX_CHANNELS = 16;
         constexpr uint16_t SWITCH_DELAY_US = 10; // Délai après changement de canal
+        constexpr uint32_t SNAPSHOT_MAX_AGE_US = 10000; // Au-delà, lecture directe du canal
 
         // État par défaut
         constexpr bool DEFAULT_ENABLED = true;
@@ -207,6 +234,15 @@ namespace SystemConstants {
     namespace Input {
         // Configuration encodeurs (utilisée)
         constexpr float DEFAULT_ENCODER_SENSITIVITY = 1.0f;
+
+        // Échantillonnage par timer matériel (TimerInputSampler)
+        constexpr bool TIMER_SAMPLING_ENABLED = false;   // true : boutons et encodeurs relevés en interruption
+        // Pins directes à chaque tick, un canal du multiplexeur par tick : avec
+        // 8 canaux câblés, un bouton du multiplexeur est relu toutes les 8 ms
+        constexpr uint32_t SAMPLING_PERIOD_US = 1000;
+        constexpr size_t SAMPLER_QUEUE_SIZE = 128;       // Instantanés boutons, puissance de 2 (RingBuffer)
+        constexpr size_t SAMPLER_ENCODER_QUEUE_SIZE = 64;  // Relevés d'encodeurs, puissance de 2
+        constexpr size_t SAMPLER_MAX_ENCODERS = 16;      // Au-delà, repli sur la scrutation
     }
     
     // ====================
@@ -226,6 +262,24 @@ namespace SystemConstants {
     constexpr unsigned long MIDI_TIME_INTERVAL = 3000;
     constexpr unsigned long UI_TIME_INTERVAL = 16667;
 
+    // Tâches MIDI et UI réveillées par leurs producteurs (false = polling périodique)
+    constexpr bool EVENT_DRIVEN_TASKS = true;
+    constexpr unsigned long MIDI_MAX_SLEEP_US = 10000;  // Réveil de secours sans notification
+    constexpr unsigned long UI_MAX_SLEEP_US = 50000;
+
+    // Cadence d'affichage adaptative (DisplayManagerAdapter)
+    constexpr unsigned long DISPLAY_IDLE_REFRESH_PERIOD_MS = 100;  // Timers LVGL au repos
+    constexpr unsigned long DISPLAY_ACTIVE_HOLD_MS = 500;          // Pleine cadence après une entrée
+
+    // Trace de latence entrée -> USB (build avec -DLATENCY_TRACE)
+    constexpr size_t LATENCY_TRACE_CAPACITY = 1024;  // Enregistrements de 8 octets (puissance de 2)
+
+    // Enregistrement du flux d'entrées pour rejeu (build avec -DINPUT_RECORDER)
+    constexpr size_t INPUT_RECORDER_CAPACITY = 4096;  // Enregistrements de 8 octets
+
+    // Profilage en cycles par tâche et par portée nommée (build avec -DCYCLE_PROFILER)
+    constexpr size_t CYCLE_PROFILER_MAX_SLOTS = 24;  // Histogrammes de ~500 octets
+
     // Rate limiting (utilisées)
     constexpr unsigned long DUPLICATE_CHECK_MS = 1.5;
     constexpr unsigned long ENCODER_RATE_LIMIT_MS = 5;
@@ -233,6 +287,8 @@ namespace SystemConstants {
 
     // Tailles ETL (utilisées pour éviter allocations dynamiques)
     constexpr size_t MAX_EVENT_SUBSCRIBERS = 32;
+    constexpr size_t MAX_EVENT_TYPES_PER_SUBSCRIPTION = 8;  // Filtre par types d'un abonnement
+    constexpr size_t MAX_EVENT_TYPE_BUCKETS = 16;           // Types distincts avec liste dédiée
     constexpr size_t MAX_MIDI_CALLBACKS = 24;
     constexpr size_t MAX_MIDI_PENDING_PARAMS = 128;
     constexpr size_t MAX_MIDI_MESSAGES_QUEUE = 256;
@@ -246,6 +302,10 @@ namespace SystemConstants {
     constexpr size_t MIDI_EVENT_POOL_SIZE = 256;
     constexpr size_t UI_EVENT_POOL_SIZE = 64;
 
+    // File d'événements différés (EventBus::publishDeferred)
+    constexpr size_t DEFERRED_EVENT_QUEUE_SIZE = 64;             // Puissance de 2 (RingBuffer)
+    constexpr uint32_t DEFERRED_EVENT_DRAIN_BUDGET_US = 2000;    // Budget par EventBus::update()
+
     // Performances temps réel (utilisées)
     constexpr unsigned long MAX_MIDI_LATENCY_US = 1000;
     }
@@ -9,13 +9,13 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
 
     // === BOUTONS STANDALONE (Navigation) ===
 
-    // Bouton Menu avec long press (sur MUX canal 0)
+    // Bouton Menu : appui = accueil, maintien 1 s = ouverture du menu (sur MUX canal 0)
     config->addControl(ControlBuilder(51, "menu_button")
                            .withLabel("Menu")
                            .inGroup("Navigation")
                            .withDescription("Bouton Menu")
                            .asButton(muxPin(9))
-                           .withLongPress(1000)
+                           .withLongPress(1000, NavigationAction::MENU_ENTER)
                            .asMenuButton()
                            .withDisplayOrder(1)
                            .build());
@@ -72,7 +72,8 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Enc 1x1")
                            .withDisplayOrder(1)
                            .asRotaryEncoder(22, 23, 24)
-                           .withStepPerDetent(true, 1)
+                           .withStepPerDetent(1)
+                           .withAcceleration()
                            .withMidiCC(1, 0, true)  // Encodeur -> CC 1
                            .build());
 
@@ -94,7 +95,8 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Enc 1x2")
                            .withDisplayOrder(2)
                            .asRotaryEncoder(18, 19, 24)
-                           .withStepPerDetent(true, 1)
+                           .withStepPerDetent(1)
+                           .withAcceleration()
                            .withMidiCC(2, 0, true)  // CC 2
                            .build());
 
@@ -116,7 +118,8 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Enc 1x3")
                            .withDisplayOrder(3)
                            .asRotaryEncoder(40, 41, 24)
-                           .withStepPerDetent(true, 1)
+                           .withStepPerDetent(1)
+                           .withAcceleration()
                            .withMidiCC(3, 0, true)
                            .build());
 
@@ -139,7 +142,8 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Enc 1x4")
                            .withDisplayOrder(4)
                            .asRotaryEncoder(36, 37, 24)
-                           .withStepPerDetent(true, 1)
+                           .withStepPerDetent(1)
+                           .withAcceleration()
                            .withMidiCC(4, 0, true)
                            .build());
 
@@ -161,7 +165,8 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Enc 2x1")
                            .withDisplayOrder(5)
                            .asRotaryEncoder(20, 21, 24)
-                           .withStepPerDetent(true, 1)
+                           .withStepPerDetent(1)
+                           .withAcceleration()
                            .withMidiCC(5, 0, true)
                            .build());
 
@@ -183,7 +188,8 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Enc 2x2")
                            .withDisplayOrder(6)
                            .asRotaryEncoder(16, 17, 24)
-                           .withStepPerDetent(true, 1)
+                           .withStepPerDetent(1)
+                           .withAcceleration()
                            .withMidiCC(6, 0, true)
                            .build());
 
@@ -205,7 +211,8 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Enc 2x3")
                            .withDisplayOrder(7)
                            .asRotaryEncoder(14, 15, 24)
-                           .withStepPerDetent(true, 1)
+                           .withStepPerDetent(1)
+                           .withAcceleration()
                            .withMidiCC(7, 0, true)
                            .build());
 
@@ -227,7 +234,8 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Enc 2x4")
                            .withDisplayOrder(8)
                            .asRotaryEncoder(38, 39, 24)
-                           .withStepPerDetent(true, 1)
+                           .withStepPerDetent(1)
+                           .withAcceleration()
                            .withMidiCC(8, 0, true)
                            .build());
 
@@ -252,7 +260,7 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Encodeur Navigation")
                            .withDisplayOrder(9)
                            .asRotaryEncoder(30, 31, 24)
-                           .withStepPerDetent(true, 4)
+                           .withStepPerDetent(4)  // Sans accélération : un cran = un item
                            .asItemNavigator()
                            .build());
 
@@ -276,7 +284,7 @@ std::unique_ptr<UnifiedConfiguration> ConfigurationFactory::createDefaultConfigu
                            .withDescription("Encodeur Precision")
                            .withDisplayOrder(10)
                            .asRotaryEncoder(34, 33, 600)
-                           .withStepPerDetent(true, 1)
+                           .withStepPerDetent(1)  // Sans accélération : réglage fin
                            .withMidiCC(10, 0, true)
                            .build());
 
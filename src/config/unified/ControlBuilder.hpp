@@ -1,5 +1,8 @@
 #pragma once
 
+#include <type_traits>
+
+#include "config/SystemConstants.hpp"
 #include "config/unified/ControlDefinition.hpp"
 #include "core/domain/navigation/NavigationAction.hpp"
 
@@ -74,11 +77,34 @@ public:
         return *this;
     }
 
-    ControlBuilder& withStepPerDetent(bool enable = true, uint8_t stepsPerDetent = 4) {
+    // Impulsions par cran mécanique (1 pour un encodeur sans crans, 0 ramené à 1).
+    // N'active plus l'accélération (ancienne signature withStepPerDetent(bool, uint8_t)) :
+    // l'appelant la demande explicitement avec withAcceleration()
+    ControlBuilder& withStepPerDetent(uint8_t stepsPerDetent = 4) {
+        if (std::holds_alternative<ControlDefinition::EncoderConfig>(control_.hardware.config)) {
+            auto& enc = std::get<ControlDefinition::EncoderConfig>(control_.hardware.config);
+            enc.stepsPerDetent = stepsPerDetent > 0 ? stepsPerDetent : 1;
+        }
+        return *this;
+    }
+
+    // Ancien withStepPerDetent(true) : serait converti en 1 pas par cran sans erreur
+    template <typename T>
+        requires std::is_same_v<T, bool>
+    ControlBuilder& withStepPerDetent(T) = delete;
+
+    // Accélération basée sur la vitesse : gain x1 au-delà de thresholdMs entre crans,
+    // jusqu'à maxAcceleration pour une rotation rapide. Désactivée par défaut
+    // (asRotaryEncoder) ; voir BM_EncoderAccelerator_Replay dans native/bench
+    ControlBuilder& withAcceleration(
+        bool enable = true,
+        uint16_t thresholdMs = SystemConstants::Encoders::ACCELERATION_THRESHOLD_MS,
+        float maxAcceleration = SystemConstants::Encoders::MAX_ACCELERATION) {
         if (std::holds_alternative<ControlDefinition::EncoderConfig>(control_.hardware.config)) {
             auto& enc = std::get<ControlDefinition::EncoderConfig>(control_.hardware.config);
             enc.enableAcceleration = enable;
-            enc.stepsPerDetent = stepsPerDetent;
+            enc.accelerationThresholdMs = thresholdMs;
+            enc.maxAcceleration = maxAcceleration;
         }
         return *this;
     }
@@ -113,10 +139,13 @@ public:
         return *this;
     }
 
-    ControlBuilder& withLongPress(uint16_t ms = 1000) {
+    // Sans action, l'appui long est seulement publié (ButtonGestureEvent) sur l'EventBus
+    ControlBuilder& withLongPress(uint16_t ms = 1000,
+                                  std::optional<NavigationAction> action = std::nullopt) {
         if (std::holds_alternative<ControlDefinition::ButtonConfig>(control_.hardware.config)) {
             auto& btn = std::get<ControlDefinition::ButtonConfig>(control_.hardware.config);
             btn.longPressMs = ms;
+            btn.longPressAction = action;
         }
         return *this;
     }
@@ -145,6 +174,31 @@ public:
         return *this;
     }
 
+    // CC 14 bits : msbCc (0-31) porte le MSB, msbCc + 32 le LSB. Au-delà de 31, le
+    // LSB tomberait sur un autre contrôleur : le mapping reste alors en CC 7 bits
+    ControlBuilder& withMidiCC14(uint8_t msbCc, uint8_t channel = 0, bool relative = true,
+                                 uint16_t stepPerDetent = 0) {
+        withMidiCC(msbCc, channel, relative);
+        if (msbCc > MAX_CC14_MSB) {
+            return *this;
+        }
+        auto& midi = std::get<ControlDefinition::MidiConfig>(control_.mappings.back().config);
+        midi.resolution = MidiResolution::CC_14BIT;
+        midi.hiResStep = stepPerDetent;
+        return *this;
+    }
+
+    // NRPN 14 bits : cc reste l'identifiant du paramètre côté UI
+    ControlBuilder& withMidiNRPN(uint16_t parameter, uint8_t cc, uint8_t channel = 0,
+                                 bool relative = true, uint16_t stepPerDetent = 0) {
+        withMidiCC(cc, channel, relative);
+        auto& midi = std::get<ControlDefinition::MidiConfig>(control_.mappings.back().config);
+        midi.resolution = MidiResolution::NRPN;
+        midi.nrpnParameter = parameter;
+        midi.hiResStep = stepPerDetent;
+        return *this;
+    }
+
     ControlBuilder& withMidiNote(uint8_t note, uint8_t channel = 0) {
         ControlDefinition::MappingSpec mapping;
         mapping.role = MappingRole::MIDI;
@@ -227,5 +281,7 @@ public:
     }
 
 private:
+    static constexpr uint8_t MAX_CC14_MSB = 31;
+
     ControlDefinition control_;
 };
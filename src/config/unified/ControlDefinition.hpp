@@ -29,6 +29,8 @@ struct ControlDefinition {
         float sensitivity;
         bool enableAcceleration;
         uint8_t stepsPerDetent;
+        uint16_t accelerationThresholdMs;  // 0 = valeur par défaut (SystemConstants::Encoders)
+        float maxAcceleration;             // 0 = valeur par défaut (SystemConstants::Encoders)
     };
 
     struct ButtonConfig {
@@ -37,6 +39,7 @@ struct ControlDefinition {
         ButtonMode mode;
         uint16_t debounceMs;
         std::optional<uint16_t> longPressMs;
+        std::optional<NavigationAction> longPressAction;  // Action de navigation sur appui long
     };
 
     struct HardwareSpec {
@@ -55,6 +58,10 @@ struct ControlDefinition {
         uint8_t channel;
         uint8_t control;
         bool isRelative;
+        // Champs haute résolution : valeur nulle (MidiConfig{}) = CC 7 bits classique
+        MidiResolution resolution;  ///< 7 bits, 14 bits ou NRPN
+        uint16_t nrpnParameter;     ///< Numéro NRPN (mode NRPN uniquement)
+        uint16_t hiResStep;         ///< Pas 14 bits par cran (0 = défaut système)
     };
 
     struct NavigationConfig {
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <unordered_set>
 
+#include "config/SystemConstants.hpp"
+
 UnifiedConfiguration::UnifiedConfiguration() {
     // === OPTIMISATIONS MÉMOIRE MCU 4.1 ===
     controls_.reserve(20);  // Pré-allocation pour éviter réallocations
@@ -58,6 +60,7 @@ std::vector<ControlDefinition> UnifiedConfiguration::getControlsByRole(MappingRo
 Result<void> UnifiedConfiguration::validate() const {
     // Vérifier l'unicité des IDs
     std::unordered_set<InputId> seenIds;
+    size_t buttonCount = 0;
 
     for (const auto& control : controls_) {
         // Vérifier l'ID principal
@@ -75,10 +78,32 @@ Result<void> UnifiedConfiguration::validate() const {
             if (!seenIds.insert(buttonId).second) {
                 return Result<void>::error({ErrorCode::ConfigurationError, "Duplicate encoder button ID found"});
             }
+            buttonCount++;
+        } else if (control.hardware.type == InputType::BUTTON) {
+            buttonCount++;
+        }
+
+        // Les boutons sont suivis sur des masques 64 bits : pas de troncature silencieuse
+        if (buttonCount > SystemConstants::Buttons::MAX_BUTTONS) {
+            return Result<void>::error({ErrorCode::ConfigurationError, "Too many buttons (64 max)"});
+        }
+
+        // Diviseur de QuadratureEncoder
+        if (auto enc = std::get_if<ControlDefinition::EncoderConfig>(&control.hardware.config)) {
+            if (enc->stepsPerDetent == 0) {
+                return Result<void>::error({ErrorCode::ConfigurationError, "Encoder stepsPerDetent cannot be 0"});
+            }
         }
 
         // Vérifier que chaque mapping a un rôle valide
         for (const auto& mapping : control.mappings) {
+            // CC 14 bits : le LSB part sur control + 32, qui doit rester un CC LSB (32-63)
+            if (auto midi = std::get_if<ControlDefinition::MidiConfig>(&mapping.config)) {
+                if (midi->resolution == MidiResolution::CC_14BIT && midi->control > 31) {
+                    return Result<void>::error({ErrorCode::ConfigurationError, "14-bit CC needs an MSB controller (0-31)"});
+                }
+            }
+
             // MappingRole n'a pas de valeur NONE, on vérifie juste la cohérence
             if (mapping.appliesTo == MappingControlType::ENCODER &&
                 control.hardware.type != InputType::ENCODER) {
@@ -1,89 +1,221 @@
 #include "TaskScheduler.hpp"
-#include <algorithm>
 
 // Instantiation du singleton global
 TaskScheduler scheduler;
 
-TaskScheduler::TaskScheduler() 
-    : cycleStartTime(0), totalExecutionTime(0), cpuUsage(0),
-      overruns(0), cycleCount(0) {
+TaskScheduler::TaskScheduler()
+    : cycleStartTime(0), cpuUsage(0),
+      overruns(0), cycleCount(0), idleCycles(0), currentTask(INVALID_TASK_HANDLE),
+      started(false) {
 }
 
-int TaskScheduler::addTask(TaskFunction func, uint32_t intervalMicros, uint8_t priority, const char* name) {
-    tasks.emplace_back(func, intervalMicros, priority, name);
-    
-    sortTasksByPriority();
-    return tasks.size() - 1;
+namespace {
+
+// Activation effective : une notification en attente avance l'activation
+uint32_t effectiveRelease(const Task& task) {
+    if (task.eventDriven && task.ready &&
+        static_cast<int32_t>(task.readySince - task.nextRelease) < 0) {
+        return task.readySince;
+    }
+    return task.nextRelease;
+}
+
+}  // namespace
+
+TaskHandle TaskScheduler::addTask(TaskFunction func, uint32_t intervalMicros, uint8_t priority, const char* name) {
+    tasks.emplace_back(std::move(func), intervalMicros, priority, name);
+    // Avant start(), l'activation initiale est posée au démarrage
+    tasks.back().nextRelease = started ? micros() : 0;
+#ifdef CYCLE_PROFILER
+    tasks.back().profileSlot = CycleProfiler::registerSlot(name, CycleProfiler::Kind::Task);
+#endif
+    ranInCycle.push_back(0);
+
+    // Les tâches ne sont jamais réordonnées : l'indice reste un handle valide
+    return static_cast<TaskHandle>(tasks.size() - 1);
+}
+
+TaskHandle TaskScheduler::addEventTask(TaskFunction func, uint32_t maxIntervalMicros,
+                                       uint8_t priority, const char* name, TaskReadyProbe probe) {
+    TaskHandle handle = addTask(std::move(func), maxIntervalMicros, priority, name);
+    Task& task = tasks[handle];
+    task.eventDriven = true;
+    task.probe = std::move(probe);
+    return handle;
+}
+
+void TaskScheduler::start() {
+    if (started) {
+        return;
+    }
+
+    uint32_t now = micros();
+    for (auto& task : tasks) {
+        task.nextRelease = now;
+    }
+    started = true;
+}
+
+void TaskScheduler::notify(TaskHandle taskIndex) {
+    if (taskIndex < 0 || taskIndex >= static_cast<int>(tasks.size())) {
+        return;
+    }
+
+    Task& task = tasks[taskIndex];
+    if (!task.ready) {
+        task.readySince = micros();
+        task.ready = true;
+    }
+}
+
+void TaskScheduler::wakeAfter(TaskHandle taskIndex, uint32_t delayMicros) {
+    if (taskIndex < 0 || taskIndex >= static_cast<int>(tasks.size())) {
+        return;
+    }
+
+    Task& task = tasks[taskIndex];
+    uint32_t wakeTime = micros() + delayMicros;
+    if (task.eventDriven && static_cast<int32_t>(wakeTime - task.nextRelease) < 0) {
+        task.nextRelease = wakeTime;
+    }
+}
+
+void TaskScheduler::pollProbes() {
+    for (auto& task : tasks) {
+        if (task.eventDriven && task.enabled && !task.ready && task.probe && task.probe()) {
+            task.readySince = micros();
+            task.ready = true;
+        }
+    }
 }
 
 void TaskScheduler::update(uint32_t maxMicros) {
+    start();
+
     uint32_t startTime = micros();
     uint32_t elapsedTime = 0;
-    
-    // Si c'est le premier cycle ou si on a bouclé sur micros()
-    if (cycleStartTime == 0 || startTime < cycleStartTime) {
+    bool ranAny = false;
+
+    // Premier cycle : pas de période de référence
+    if (cycleCount == 0) {
         cycleStartTime = startTime;
     }
-    
+
     // Calcul du temps entre cycles (pour le calcul de CPU usage)
     uint32_t cyclePeriod = startTime - cycleStartTime;
     cycleStartTime = startTime;
-    
+
     cycleCount++;
-    
-    // Exécute les tâches dues, en respectant le budget CPU
-    for (size_t i = 0; i < tasks.size(); i++) {
-        Task& task = tasks[i];
-        
-        if (!task.enabled) {
-            continue;
+
+    pollProbes();
+
+    // Exécute les tâches dues par priorité puis échéance, en respectant le budget CPU
+    while (true) {
+        TaskHandle next = pickNextDue(micros());
+        if (next == INVALID_TASK_HANDLE) {
+            break;
         }
-        
-        uint32_t now = micros();
-        uint32_t elapsed = now - task.lastRun;
-        
-        // Si la tâche est due (en tenant compte du débordement micros possible)
-        if (elapsed >= task.interval || now < task.lastRun) {
-            // Vérifie si on a assez de temps dans le budget
-            if (elapsedTime > maxMicros) {
-                overruns++;
-                break;
-            }
-            
-            // Exécute la tâche et mesure son temps
-            uint32_t taskTime = executeTask(i);
-            elapsedTime += taskTime;
-            
-            // Mise à jour des statistiques
-            totalExecutionTime = totalExecutionTime * 0.95 + elapsedTime * 0.05; // Moyenne glissante
+
+        // Budget épuisé : les tâches restantes gardent leur activation pour le cycle suivant
+        if (elapsedTime > maxMicros) {
+            overruns++;
+            break;
         }
+
+        elapsedTime += executeTask(next);
+        ranInCycle[next] = cycleCount;
+        ranAny = true;
+    }
+
+    if (!ranAny) {
+        idleCycles++;
     }
-    
-    // Calcul de l'utilisation CPU (moyenne glissante)
+
+    // Utilisation CPU (moyenne glissante entière, facteur 1/16)
     if (cyclePeriod > 0) {
-        uint32_t usage = (elapsedTime * 10000) / cyclePeriod; // *100 pour pourcentage, *100 pour 2 décimales
-        cpuUsage = cpuUsage * 0.95 + usage * 0.05;
+        uint32_t usage = static_cast<uint32_t>((static_cast<uint64_t>(elapsedTime) * 10000) / cyclePeriod);
+        if (usage > 10000) {
+            usage = 10000;
+        }
+        cpuUsage = (cpuUsage * 15 + usage) / 16;
     }
 }
 
-void TaskScheduler::enableTask(int taskIndex, bool enabled) {
+TaskHandle TaskScheduler::pickNextDue(uint32_t now) const {
+    TaskHandle best = INVALID_TASK_HANDLE;
+
+    for (size_t i = 0; i < tasks.size(); i++) {
+        const Task& task = tasks[i];
+        if (!task.enabled || ranInCycle[i] == cycleCount) {
+            continue;
+        }
+
+        // Activation atteinte (différence signée : robuste au débordement de micros)
+        bool due = static_cast<int32_t>(now - task.nextRelease) >= 0;
+        if (!due && !(task.eventDriven && task.ready)) {
+            continue;
+        }
+
+        if (best == INVALID_TASK_HANDLE) {
+            best = static_cast<TaskHandle>(i);
+            continue;
+        }
+
+        const Task& current = tasks[best];
+        if (task.priority < current.priority ||
+            (task.priority == current.priority &&
+             static_cast<int32_t>(effectiveRelease(task) + task.interval -
+                                  (effectiveRelease(current) + current.interval)) < 0)) {
+            best = static_cast<TaskHandle>(i);
+        }
+    }
+
+    return best;
+}
+
+void TaskScheduler::enableTask(TaskHandle taskIndex, bool enabled) {
     if (taskIndex >= 0 && taskIndex < static_cast<int>(tasks.size())) {
-        tasks[taskIndex].enabled = enabled;
+        Task& task = tasks[taskIndex];
+        if (enabled && !task.enabled) {
+            // Pas de retard comptabilisé pour la période désactivée
+            task.nextRelease = micros();
+        }
+        task.enabled = enabled;
     }
 }
 
-void TaskScheduler::setTaskInterval(int taskIndex, uint32_t intervalMicros) {
+void TaskScheduler::setTaskInterval(TaskHandle taskIndex, uint32_t intervalMicros) {
     if (taskIndex >= 0 && taskIndex < static_cast<int>(tasks.size())) {
         tasks[taskIndex].interval = intervalMicros;
     }
 }
 
-void TaskScheduler::runTaskNow(int taskIndex) {
+void TaskScheduler::runTaskNow(TaskHandle taskIndex) {
     if (taskIndex >= 0 && taskIndex < static_cast<int>(tasks.size())) {
-        executeTask(taskIndex);
+        Task& task = tasks[taskIndex];
+
+        // Exécution hors activation : seule la durée est mesurée
+        TaskHandle previous = currentTask;
+        currentTask = taskIndex;
+        uint32_t start = micros();
+        CYCLE_PROFILE_TIMESTAMP(cycleStart);
+        task.function();
+        CYCLE_PROFILE_RECORD(task.profileSlot, cycleStart);
+        uint32_t end = micros();
+        currentTask = previous;
+
+        task.runtime.record(end - start);
+        task.lastRun = end;
     }
 }
 
+const Task* TaskScheduler::getTask(TaskHandle taskIndex) const {
+    if (taskIndex >= 0 && taskIndex < static_cast<int>(tasks.size())) {
+        return &tasks[taskIndex];
+    }
+    return nullptr;
+}
+
 float TaskScheduler::getCpuUsage() const {
     return cpuUsage / 100.0f; // Conversion en pourcentage avec 2 décimales
 }
@@ -92,40 +224,166 @@ size_t TaskScheduler::getTaskCount() const {
     return tasks.size();
 }
 
-void TaskScheduler::sortTasksByPriority() {
-    std::sort(tasks.begin(), tasks.end(), [](const Task& a, const Task& b) {
-        return a.priority < b.priority;
-    });
-}
-
-uint32_t TaskScheduler::executeTask(int taskIndex) {
+uint32_t TaskScheduler::executeTask(TaskHandle taskIndex) {
     if (taskIndex < 0 || taskIndex >= static_cast<int>(tasks.size())) {
         return 0;
     }
-    
+
     Task& task = tasks[taskIndex];
-    
+
+    if (task.eventDriven) {
+        return executeEventTask(taskIndex);
+    }
+
+    currentTask = taskIndex;
     uint32_t start = micros();
+    CYCLE_PROFILE_TIMESTAMP(cycleStart);
     task.function();
+    CYCLE_PROFILE_RECORD(task.profileSlot, cycleStart);
     uint32_t end = micros();
-    
+    currentTask = INVALID_TASK_HANDLE;
+
     uint32_t executionTime = end - start;
+    task.startJitter.record(start - task.nextRelease);
+    task.runtime.record(executionTime);
+
+    // Échéance implicite : fin de la période commencée à l'activation
+    if (static_cast<int32_t>(end - (task.nextRelease + task.interval)) > 0) {
+        task.deadlineMisses++;
+    }
+
     task.lastRun = end;
-    
-    // Moyenne glissante pour le temps d'exécution
-    if (task.executionTime == 0) {
-        task.executionTime = executionTime;
+    advanceRelease(task, end);
+
+    return executionTime;
+}
+
+uint32_t TaskScheduler::executeEventTask(TaskHandle taskIndex) {
+    Task& task = tasks[taskIndex];
+
+    // Consommer la notification avant l'exécution : un producteur qui notifie
+    // pendant la tâche la réveillera au cycle suivant
+    noInterrupts();
+    bool notified = task.ready;
+    uint32_t readySince = task.readySince;
+    task.ready = false;
+    interrupts();
+
+    uint32_t start = micros();
+
+    // Réveil de secours ; la tâche peut l'avancer avec wakeAfter()
+    task.nextRelease = start + task.interval;
+
+    currentTask = taskIndex;
+    CYCLE_PROFILE_TIMESTAMP(cycleStart);
+    task.function();
+    CYCLE_PROFILE_RECORD(task.profileSlot, cycleStart);
+    uint32_t end = micros();
+    currentTask = INVALID_TASK_HANDLE;
+
+    uint32_t executionTime = end - start;
+    task.runtime.record(executionTime);
+    if (notified) {
+        task.wakeLatency.record(start - readySince);
+        task.notifiedRuns++;
     } else {
-        task.executionTime = task.executionTime * 0.9 + executionTime * 0.1;
+        task.timedRuns++;
     }
-    
+
+    task.lastRun = end;
     return executionTime;
 }
 
+void TaskScheduler::advanceRelease(Task& task, uint32_t now) {
+    if (task.interval == 0) {
+        task.nextRelease = now;
+        return;
+    }
+
+    task.nextRelease += task.interval;
+
+    // Retard de plus d'une période : sauter les activations manquées plutôt que
+    // de les rattraper en rafale
+    int32_t behind = static_cast<int32_t>(now - task.nextRelease);
+    if (behind >= 0) {
+        uint32_t skipped = static_cast<uint32_t>(behind) / task.interval + 1;
+        task.nextRelease += skipped * task.interval;
+        task.skippedReleases += skipped;
+    }
+}
+
+void TaskScheduler::resetStats() {
+    for (auto& task : tasks) {
+        task.startJitter.reset();
+        task.runtime.reset();
+        task.deadlineMisses = 0;
+        task.skippedReleases = 0;
+        task.wakeLatency.reset();
+        task.notifiedRuns = 0;
+        task.timedRuns = 0;
+    }
+    overruns = 0;
+    cycleCount = 0;
+    idleCycles = 0;
+    cpuUsage = 0;
+}
+
 void TaskScheduler::printDebugStats() {
-    return;
+    printStats(true);
 }
 
 void TaskScheduler::printStats(bool showDetailedStats) {
     // Affiche les statistiques CPU de base sur le port série (fonctionne même en mode non-DEBUG)
+    Serial.printf("[Scheduler] cycles=%lu idle=%lu overruns=%lu cpu=%lu.%02lu%%\n",
+                  static_cast<unsigned long>(cycleCount), static_cast<unsigned long>(idleCycles),
+                  static_cast<unsigned long>(overruns),
+                  static_cast<unsigned long>(cpuUsage / 100),
+                  static_cast<unsigned long>(cpuUsage % 100));
+    Serial.println("  task            prio period  runs    run avg/max us  jitter avg/max us  miss  skip");
+
+    for (const auto& task : tasks) {
+        Serial.printf("  %-15s %4u %6lu %6lu %7lu/%-7lu %8lu/%-8lu %5lu %5lu%s\n",
+                      task.name ? task.name : "?", static_cast<unsigned>(task.priority),
+                      static_cast<unsigned long>(task.interval),
+                      static_cast<unsigned long>(task.runtime.samples),
+                      static_cast<unsigned long>(task.runtime.averageUs()),
+                      static_cast<unsigned long>(task.runtime.maxUs),
+                      static_cast<unsigned long>(task.startJitter.averageUs()),
+                      static_cast<unsigned long>(task.startJitter.maxUs),
+                      static_cast<unsigned long>(task.deadlineMisses),
+                      static_cast<unsigned long>(task.skippedReleases),
+                      task.enabled ? "" : " (off)");
+
+        if (task.eventDriven) {
+            Serial.printf("    event: notified=%lu timed=%lu wake avg/max us=%lu/%lu\n",
+                          static_cast<unsigned long>(task.notifiedRuns),
+                          static_cast<unsigned long>(task.timedRuns),
+                          static_cast<unsigned long>(task.wakeLatency.averageUs()),
+                          static_cast<unsigned long>(task.wakeLatency.maxUs));
+        }
+
+        if (showDetailedStats) {
+            printHistogram("run", task.runtime);
+            if (task.eventDriven) {
+                printHistogram("wake", task.wakeLatency);
+            } else {
+                printHistogram("jitter", task.startJitter);
+            }
+        }
+    }
+}
+
+void TaskScheduler::printHistogram(const char* label, const TaskHistogram& histogram) {
+    Serial.printf("    %-6s", label);
+    for (size_t i = 0; i < TaskHistogram::BUCKET_COUNT; i++) {
+        if (i < TaskHistogram::BUCKET_COUNT - 1) {
+            Serial.printf(" <%lu:%lu", static_cast<unsigned long>(TaskHistogram::BUCKET_LIMITS_US[i]),
+                          static_cast<unsigned long>(histogram.counts[i]));
+        } else {
+            Serial.printf(" >=%lu:%lu",
+                          static_cast<unsigned long>(TaskHistogram::BUCKET_LIMITS_US[i - 1]),
+                          static_cast<unsigned long>(histogram.counts[i]));
+        }
+    }
+    Serial.println();
 }
@@ -3,9 +3,12 @@
 
 #include <Arduino.h>
 
+#include <array>
 #include <functional>
 #include <vector>
 
+#include "core/utils/CycleProfiler.hpp"
+
 /**
  * @brief Définition d'un type pour les fonctions de tâches
  */
@@ -16,30 +19,123 @@ using TaskFunction = std::function<void()>;
  */
 using AsyncTaskFunction = std::function<bool()>;
 
+/**
+ * @brief Sonde de disponibilité d'une tâche événementielle (true = travail en attente)
+ */
+using TaskReadyProbe = std::function<bool()>;
+
+/**
+ * @brief Identifiant stable d'une tâche (indice d'insertion, jamais réordonné)
+ */
+using TaskHandle = int;
+
+constexpr TaskHandle INVALID_TASK_HANDLE = -1;
+
+/**
+ * @brief Histogramme à seaux fixes (bornes en microsecondes, calcul entier)
+ */
+struct TaskHistogram {
+    static constexpr size_t BUCKET_COUNT = 8;
+
+    // Borne supérieure exclusive de chaque seau ; le dernier reçoit le reste
+    static constexpr uint32_t BUCKET_LIMITS_US[BUCKET_COUNT - 1] = {50,   100,  250, 500,
+                                                                    1000, 2500, 5000};
+
+    std::array<uint32_t, BUCKET_COUNT> counts{};
+    uint64_t totalUs = 0;
+    uint32_t maxUs = 0;
+    uint32_t samples = 0;
+
+    void record(uint32_t valueUs) {
+        size_t bucket = 0;
+        while (bucket < BUCKET_COUNT - 1 && valueUs >= BUCKET_LIMITS_US[bucket]) {
+            bucket++;
+        }
+        counts[bucket]++;
+        totalUs += valueUs;
+        if (valueUs > maxUs) {
+            maxUs = valueUs;
+        }
+        samples++;
+    }
+
+    uint32_t averageUs() const {
+        return samples > 0 ? static_cast<uint32_t>(totalUs / samples) : 0;
+    }
+
+    void reset() {
+        *this = TaskHistogram{};
+    }
+};
+
 /**
  * @brief Structure représentant une tâche exécutable
  */
 struct Task {
     TaskFunction function;   // Fonction à exécuter
-    uint32_t interval;       // Intervalle en microsecondes
-    uint32_t lastRun;        // Dernière exécution (micros)
-    uint32_t executionTime;  // Temps d'exécution (moyenne)
+    uint32_t interval;       // Période en microsecondes (échéance implicite = période)
+                             // ou attente maximale d'une tâche événementielle
+    uint32_t nextRelease;    // Prochaine activation (micros)
+    uint32_t lastRun;        // Dernière fin d'exécution (micros)
     uint8_t priority;        // Priorité (0 = plus haute)
     bool enabled;            // Tâche activée ?
     const char* name;        // Nom de la tâche pour le débogage
 
+    // Réveil sur événement
+    bool eventDriven;                // Exécutée sur notification, sinon après interval
+    volatile bool ready;             // Notifiée depuis la dernière exécution
+    volatile uint32_t readySince;    // Instant de la première notification en attente
+    TaskReadyProbe probe;            // Sonde optionnelle évaluée à chaque cycle
+
+    // Statistiques
+    TaskHistogram startJitter;  // Retard du démarrage sur l'activation
+    TaskHistogram runtime;      // Durée d'exécution
+    uint32_t deadlineMisses;    // Fins d'exécution après activation + période
+    uint32_t skippedReleases;   // Activations sautées (retard > une période)
+    TaskHistogram wakeLatency;  // Délai notification -> démarrage
+    uint32_t notifiedRuns;      // Exécutions déclenchées par une notification
+    uint32_t timedRuns;         // Exécutions sans notification (attente maximale, wakeAfter)
+#ifdef CYCLE_PROFILER
+    uint8_t profileSlot = CycleProfiler::NO_SLOT;  // Histogramme en cycles de task.function()
+#endif
+
     Task(TaskFunction func, uint32_t inter, uint8_t prio, const char* taskName)
-        : function(func),
+        : function(std::move(func)),
           interval(inter),
+          nextRelease(0),
           lastRun(0),
-          executionTime(0),
           priority(prio),
           enabled(true),
-          name(taskName) {}
+          name(taskName),
+          eventDriven(false),
+          ready(false),
+          readySince(0),
+          deadlineMisses(0),
+          skippedReleases(0),
+          notifiedRuns(0),
+          timedRuns(0) {}
 };
 
 /**
- * @brief Gestionnaire de tâches avec ordonnancement par priorité et budget CPU
+ * @brief Ordonnanceur coopératif : priorité fixe, puis échéance la plus proche
+ *
+ * À chaque update(), la tâche échue de plus haute priorité est exécutée ; à
+ * priorité égale, celle dont l'activation est la plus ancienne (EDF, échéance
+ * = activation + période). Chaque tâche s'exécute au plus une fois par cycle.
+ * Les handles renvoyés par addTask() restent valides : les tâches ne sont
+ * jamais réordonnées en mémoire.
+ *
+ * Lorsque le budget CPU du cycle est épuisé, les tâches restantes sont
+ * reportées au cycle suivant, sans perdre leur activation.
+ *
+ * Les tâches enregistrées avant start() (ou avant le premier update()) sont
+ * toutes activées au démarrage : le temps d'initialisation écoulé depuis leur
+ * enregistrement n'est compté ni en gigue ni en activations sautées.
+ *
+ * Les tâches événementielles (addEventTask) dorment jusqu'à ce qu'un
+ * producteur les notifie (notify(), ou leur sonde renvoie true), au plus
+ * tard jusqu'à leur attente maximale. Le délai entre notification et
+ * démarrage est mesuré dans wakeLatency.
  */
 class TaskScheduler {
 public:
@@ -51,9 +147,57 @@ public:
      * @param intervalMicros Intervalle en microsecondes
      * @param priority Priorité (0 = plus haute)
      * @param name Nom de la tâche pour le débogage
-     * @return Indice de la tâche
+     * @return Handle stable de la tâche
      */
-    int addTask(TaskFunction func, uint32_t intervalMicros, uint8_t priority, const char* name);
+    TaskHandle addTask(TaskFunction func, uint32_t intervalMicros, uint8_t priority, const char* name);
+
+    /**
+     * @brief Ajoute une tâche réveillée par ses producteurs
+     * @param func Fonction à exécuter
+     * @param maxIntervalMicros Attente maximale sans notification
+     * @param priority Priorité (0 = plus haute)
+     * @param name Nom de la tâche pour le débogage
+     * @param probe Sonde optionnelle, évaluée à chaque cycle tant que la tâche dort
+     * @return Handle stable de la tâche
+     */
+    TaskHandle addEventTask(TaskFunction func, uint32_t maxIntervalMicros, uint8_t priority,
+                            const char* name, TaskReadyProbe probe = nullptr);
+
+    /**
+     * @brief Démarre l'ordonnancement : première activation de chaque tâche à maintenant
+     *
+     * Appelé automatiquement par le premier update() ; sans effet ensuite.
+     * Une tâche ajoutée après le démarrage est activée à son enregistrement.
+     */
+    void start();
+
+    /**
+     * @brief Indique si l'ordonnanceur a démarré
+     */
+    bool isStarted() const {
+        return started;
+    }
+
+    /**
+     * @brief Marque une tâche événementielle comme prête (utilisable en interruption)
+     * @param taskIndex Handle de la tâche
+     */
+    void notify(TaskHandle taskIndex);
+
+    /**
+     * @brief Avance le prochain réveil d'une tâche événementielle
+     * @param taskIndex Handle de la tâche
+     * @param delayMicros Délai maximal avant la prochaine exécution
+     */
+    void wakeAfter(TaskHandle taskIndex, uint32_t delayMicros);
+
+    /**
+     * @brief Tâche en cours d'exécution
+     * @return Handle de la tâche, INVALID_TASK_HANDLE hors exécution
+     */
+    TaskHandle getCurrentTask() const {
+        return currentTask;
+    }
 
     /**
      * @brief Exécute les tâches planifiées en respectant le budget CPU
@@ -63,23 +207,30 @@ public:
 
     /**
      * @brief Active ou désactive une tâche
-     * @param taskIndex Indice de la tâche
+     * @param taskIndex Handle de la tâche
      * @param enabled État d'activation
      */
-    void enableTask(int taskIndex, bool enabled);
+    void enableTask(TaskHandle taskIndex, bool enabled);
 
     /**
      * @brief Modifie l'intervalle d'une tâche
-     * @param taskIndex Indice de la tâche
+     * @param taskIndex Handle de la tâche
      * @param intervalMicros Nouvel intervalle en microsecondes
      */
-    void setTaskInterval(int taskIndex, uint32_t intervalMicros);
+    void setTaskInterval(TaskHandle taskIndex, uint32_t intervalMicros);
 
     /**
      * @brief Exécute immédiatement une tâche, indépendamment de son intervalle
-     * @param taskIndex Indice de la tâche
+     * @param taskIndex Handle de la tâche
+     */
+    void runTaskNow(TaskHandle taskIndex);
+
+    /**
+     * @brief Accède à une tâche et à ses statistiques
+     * @param taskIndex Handle de la tâche
+     * @return Pointeur vers la tâche, nullptr si le handle est invalide
      */
-    void runTaskNow(int taskIndex);
+    const Task* getTask(TaskHandle taskIndex) const;
 
     /**
      * @brief Renvoie des statistiques sur l'utilisation du CPU
@@ -103,12 +254,25 @@ public:
 
     /**
      * @brief Renvoie le nombre de dépassements de budget CPU
-     * @return Nombre de dépassements
+     * @return Nombre de cycles ayant reporté au moins une tâche échue
      */
     uint32_t getOverruns() const {
         return overruns;
     }
 
+    /**
+     * @brief Renvoie le nombre de cycles sans aucune tâche exécutée
+     * @return Nombre de cycles inactifs
+     */
+    uint32_t getIdleCycles() const {
+        return idleCycles;
+    }
+
+    /**
+     * @brief Remet à zéro les histogrammes et compteurs
+     */
+    void resetStats();
+
     /**
      * @brief Affiche les statistiques de performance en mode debug
      */
@@ -116,34 +280,59 @@ public:
 
     /**
      * @brief Affiche les statistiques sur le port série
-     * @param showDetailedStats Afficher les détails des tâches
+     * @param showDetailedStats Afficher les histogrammes de chaque tâche
      */
     void printStats(bool showDetailedStats = false);
 
 private:
     std::vector<Task> tasks;
+    std::vector<uint32_t> ranInCycle;  // Numéro du dernier cycle d'exécution, par tâche
     uint32_t cycleStartTime;
-    uint32_t totalExecutionTime;
     uint32_t cpuUsage;  // en pourcentage * 100 (pour précision)
 
     // Métriques pour le diagnostic
     uint32_t overruns;    // Nombre de cycles ayant dépassé le budget
     uint32_t cycleCount;  // Nombre total de cycles
+    uint32_t idleCycles;  // Cycles sans aucune tâche exécutée
+
+    TaskHandle currentTask;  // Tâche en cours d'exécution
+    bool started;            // Activations initiales posées (start())
+
+    /**
+     * @brief Sélectionne la prochaine tâche échue (priorité, puis échéance)
+     * @param now Temps courant
+     * @return Handle de la tâche, INVALID_TASK_HANDLE si aucune n'est échue
+     */
+    TaskHandle pickNextDue(uint32_t now) const;
 
     /**
-     * @brief Trie les tâches par priorité
+     * @brief Évalue les sondes des tâches événementielles endormies
      */
-    void sortTasksByPriority();
+    void pollProbes();
 
     /**
      * @brief Exécute une tâche et mesure son temps d'exécution
-     * @param taskIndex Indice de la tâche
+     * @param taskIndex Handle de la tâche
      * @return Temps d'exécution en microsecondes
      */
-    uint32_t executeTask(int taskIndex);
+    uint32_t executeTask(TaskHandle taskIndex);
+
+    /**
+     * @brief Exécute une tâche événementielle et consomme sa notification
+     * @param taskIndex Handle de la tâche
+     * @return Temps d'exécution en microsecondes
+     */
+    uint32_t executeEventTask(TaskHandle taskIndex);
+
+    /**
+     * @brief Avance l'activation d'une tâche après exécution
+     */
+    static void advanceRelease(Task& task, uint32_t now);
+
+    static void printHistogram(const char* label, const TaskHistogram& histogram);
 };
 
 // Singleton global pour faciliter l'accès
 extern TaskScheduler scheduler;
 
-#endif  // TASK_SCHEDULER_HPP
\ No newline at end of file
+#endif  // TASK_SCHEDULER_HPP
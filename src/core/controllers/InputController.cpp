@@ -1,9 +1,12 @@
 #include "InputController.hpp"
 
+#include "core/domain/events/core/EventTypes.hpp"
+
 InputController::InputController(std::shared_ptr<NavigationConfigService> navigationConfig,
                                 std::shared_ptr<UnifiedConfiguration> unifiedConfig,
                                 std::shared_ptr<EventBus> eventBus)
-    : processorManager_(std::make_unique<InputProcessorManager>(navigationConfig, unifiedConfig, eventBus)) {
+    : processorManager_(std::make_unique<InputProcessorManager>(navigationConfig, unifiedConfig, eventBus)),
+      eventBus_(eventBus) {
 }
 
 void InputController::processEncoderTurn(EncoderId id, int32_t absolutePosition,
@@ -19,3 +22,25 @@ void InputController::processButtonPress(ButtonId id, bool pressed) {
     }
 }
 
+void InputController::processButtonGesture(const ButtonGesture& gesture) {
+    if (processorManager_) {
+        processorManager_->processButtonGesture(gesture);
+    }
+    if (!eventBus_) {
+        return;
+    }
+
+    EventType type = EventTypes::ButtonLongPress;
+    if (gesture.type == ButtonGesture::Type::DoubleClick) {
+        type = EventTypes::ButtonDoubleClick;
+    } else if (gesture.type == ButtonGesture::Type::Chord) {
+        type = EventTypes::ButtonChord;
+    }
+
+    ButtonGestureEvent event(type, gesture.id, gesture.timestampUs);
+    for (uint8_t i = 0; i < gesture.chordSize && i < ButtonGestureEvent::MAX_CHORD_BUTTONS; ++i) {
+        event.chordIds[i] = gesture.chordIds[i];
+    }
+    event.chordSize = gesture.chordSize;
+    eventBus_->publish(event);
+}
@@ -6,6 +6,7 @@
 #include "config/unified/UnifiedConfiguration.hpp"
 #include "core/domain/events/core/EventBus.hpp"
 #include "core/domain/types.hpp"
+#include "core/use_cases/ButtonGestureRecognizer.hpp"
 #include "InputProcessorManager.hpp"
 
 /**
@@ -43,7 +44,17 @@ public:
      */
     void processButtonPress(ButtonId id, bool pressed);
 
+    /**
+     * @brief Traite un geste bouton (appui long, double clic, accord)
+     *
+     * L'action de navigation éventuelle (appui long configuré) est émise par les
+     * processors, puis le geste est publié sur le bus (ButtonGestureEvent).
+     * @param gesture Geste reconnu par ButtonGestureRecognizer
+     */
+    void processButtonGesture(const ButtonGesture& gesture);
+
 private:
     // === SYSTÈME DE PROCESSORS ===
     std::unique_ptr<InputProcessorManager> processorManager_;
+    std::shared_ptr<EventBus> eventBus_;
 };
\ No newline at end of file
@@ -5,12 +5,14 @@
 #include "processors/MidiInputProcessor.hpp"
 #include "app/services/NavigationConfigService.hpp"
 #include "config/SystemConstants.hpp"
+#include "core/utils/LatencyTrace.hpp"
 
 /**
  * @brief Gestionnaire centralisé des processors d'input
  * 
  * Applique le Strategy Pattern pour déléguer le traitement des entrées
- * aux processors spécialisés appropriés (Navigation vs MIDI).
+ * aux processors spécialisés appropriés (Navigation vs MIDI). La table de
+ * routage est construite une fois à partir de la configuration unifiée.
  */
 class InputProcessorManager {
 public:
@@ -24,13 +26,27 @@ public:
                          std::shared_ptr<UnifiedConfiguration> unifiedConfig,
                          std::shared_ptr<EventBus> eventBus)
         : navigationConfig_(navigationConfig)
-        , navigationProcessor_(std::make_unique<NavigationInputProcessor>(unifiedConfig, eventBus))
-        , midiProcessor_(std::make_unique<MidiInputProcessor>(unifiedConfig, eventBus)) {}
+        , routingTable_(std::make_unique<InputRoutingTable>())
+        , navigationProcessor_(std::make_unique<NavigationInputProcessor>(unifiedConfig, eventBus, *routingTable_))
+        , midiProcessor_(std::make_unique<MidiInputProcessor>(unifiedConfig, eventBus)) {
+        if (unifiedConfig) {
+            routingTable_->rebuild(*unifiedConfig);
+        }
+    }
+
+    /**
+     * @brief Recalcule la table de routage après modification de la configuration
+     */
+    void rebuildRoutingTable(const UnifiedConfiguration& unifiedConfig) {
+        routingTable_->rebuild(unifiedConfig);
+    }
     
     /**
      * @brief Traite la rotation d'un encodeur
      */
     void processEncoderTurn(EncoderId id, int32_t absolutePosition, int8_t relativeChange) {
+        LATENCY_TRACE_STAGE(InputProcessor);
+
         // Priorité 1: Vérifier NavigationConfigService
         if (navigationConfig_ && navigationConfig_->isNavigationControl(id)) {
             navigationProcessor_->processEncoder(id, absolutePosition, relativeChange);
@@ -59,8 +75,17 @@ public:
         midiProcessor_->processButton(id, pressed);
     }
 
+    /**
+     * @brief Traite un geste bouton (appui long, double clic, accord)
+     * @return true si le geste a déclenché une action de navigation
+     */
+    bool processButtonGesture(const ButtonGesture& gesture) {
+        return navigationProcessor_->processButtonGesture(gesture);
+    }
+
 private:
     std::shared_ptr<NavigationConfigService> navigationConfig_;
+    std::unique_ptr<InputRoutingTable> routingTable_;  // Déclaré avant les processors qui le référencent
     std::unique_ptr<NavigationInputProcessor> navigationProcessor_;
     std::unique_ptr<MidiInputProcessor> midiProcessor_;
 };
\ No newline at end of file
@@ -27,8 +27,12 @@ void NavigationController::subscribeToEvents() {
         return;
     }
     
-    // S'abonner aux événements de navigation en tant qu'EventListener
-    eventBus_->subscribe(this);
+    // S'abonner aux seuls événements de navigation en tant qu'EventListener
+    eventBus_->subscribeToTypes(this,
+                                {NavigationEventTypes::NAVIGATION_REQUESTED,
+                                 NavigationEventTypes::STATE_CHANGE_REQUESTED,
+                                 NavigationEventTypes::BACK_REQUESTED,
+                                 NavigationEventTypes::HOME_REQUESTED});
 }
 
 void NavigationController::handleNavigationEvent(const NavigationEvent& event) {
@@ -36,24 +36,6 @@ protected:
         return unifiedConfig_ != nullptr && eventBus_ != nullptr;
     }
     
-    /**
-     * @brief Trouve la définition d'un contrôle
-     */
-    std::optional<ControlDefinition> findControlDefinition(InputId id) const {
-        if (!unifiedConfig_) {
-            return std::nullopt;
-        }
-        return unifiedConfig_->findControlById(id);
-    }
-    
-    /**
-     * @brief Vérifie si un contrôle a des mappings de navigation
-     */
-    bool hasNavigationMappings(const ControlDefinition& control) const {
-        auto navigationMappings = control.getMappingsForRole(MappingRole::NAVIGATION);
-        return !navigationMappings.empty();
-    }
-    
     /**
      * @brief Applique la sensibilité à un changement relatif
      */
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+#include "config/SystemConstants.hpp"
+#include "config/unified/UnifiedConfiguration.hpp"
+#include "core/domain/types.hpp"
+
+/**
+ * @brief Table de routage des entrées précalculée au démarrage
+ *
+ * Extrait de UnifiedConfiguration, une seule fois, les informations dont le
+ * chemin d'entrée a besoin à chaque événement (navigation, action, mapping
+ * MIDI, sensibilité) dans un tableau POD trié par InputId. La recherche se fait
+ * par dichotomie, sans copie de ControlDefinition ni allocation.
+ */
+class InputRoutingTable {
+public:
+    // Un contrôle encodeur peut aussi indexer l'ID de son bouton intégré
+    static constexpr size_t MAX_ROUTES = SystemConstants::Performance::MAX_CONTROL_DEFINITIONS * 2;
+
+    /**
+     * @brief Informations de routage d'une entrée
+     */
+    struct Route {
+        InputId id;
+        bool hasNavigation;              // Au moins un mapping NAVIGATION
+        bool isEncoderHardware;          // Contrôle matériel de type encodeur
+        bool hasMidi;                    // Au moins un mapping MIDI
+        NavigationAction encoderAction;  // Action de navigation pour la rotation
+        NavigationAction buttonAction;   // Action de navigation pour l'appui
+        bool hasLongPressAction;         // Action de navigation sur appui long
+        NavigationAction longPressAction;
+        uint8_t midiChannel;             // Premier mapping MIDI (si hasMidi)
+        uint8_t midiControl;
+        float sensitivity;               // Sensibilité de l'encodeur
+    };
+
+    InputRoutingTable() = default;
+
+    explicit InputRoutingTable(const UnifiedConfiguration& config) {
+        rebuild(config);
+    }
+
+    /**
+     * @brief Recalcule la table à partir de la configuration
+     */
+    void rebuild(const UnifiedConfiguration& config) {
+        count_ = 0;
+        dropped_ = 0;
+
+        for (const auto& control : config.getAllControls()) {
+            Route route = makeRoute(control);
+            addRoute(route);
+
+            InputId buttonId = control.getEncoderButtonId();
+            if (buttonId > 0) {
+                route.id = buttonId;
+                addRoute(route);
+            }
+        }
+
+        std::sort(routes_.begin(), routes_.begin() + count_,
+                  [](const Route& a, const Route& b) { return a.id < b.id; });
+    }
+
+    /**
+     * @brief Trouve la route d'une entrée
+     * @return Pointeur vers la route, nullptr si l'ID est inconnu
+     */
+    const Route* find(InputId id) const {
+        auto end = routes_.begin() + count_;
+        auto it = std::lower_bound(routes_.begin(), end, id,
+                                   [](const Route& route, InputId key) { return route.id < key; });
+        if (it == end || it->id != id) {
+            return nullptr;
+        }
+        return &(*it);
+    }
+
+    size_t size() const {
+        return count_;
+    }
+
+    /**
+     * @brief Nombre de routes ignorées faute de place
+     */
+    size_t getDroppedCount() const {
+        return dropped_;
+    }
+
+private:
+    static Route makeRoute(const ControlDefinition& control) {
+        Route route{};
+        route.id = control.id;
+        route.isEncoderHardware = control.hardware.type == InputType::ENCODER;
+        route.encoderAction = SystemConstants::Encoders::DEFAULT_ACTION;
+        route.buttonAction = SystemConstants::Buttons::DEFAULT_ACTION;
+        route.sensitivity = SystemConstants::Encoders::DEFAULT_SENSITIVITY;
+
+        if (auto enc = std::get_if<ControlDefinition::EncoderConfig>(&control.hardware.config)) {
+            route.sensitivity = enc->sensitivity;
+        }
+        if (auto btn = std::get_if<ControlDefinition::ButtonConfig>(&control.hardware.config)) {
+            if (btn->longPressAction) {
+                route.hasLongPressAction = true;
+                route.longPressAction = *btn->longPressAction;
+            }
+        }
+
+        bool encoderActionSet = false;
+        bool buttonActionSet = false;
+        for (const auto& mapping : control.mappings) {
+            if (mapping.role == MappingRole::NAVIGATION) {
+                route.hasNavigation = true;
+                auto nav = std::get_if<ControlDefinition::NavigationConfig>(&mapping.config);
+                if (!nav) {
+                    continue;
+                }
+                if (mapping.appliesTo == MappingControlType::ENCODER) {
+                    if (!encoderActionSet) {
+                        route.encoderAction = nav->action;
+                        encoderActionSet = true;
+                    }
+                } else if (!buttonActionSet) {
+                    route.buttonAction = nav->action;
+                    buttonActionSet = true;
+                }
+            } else if (mapping.role == MappingRole::MIDI && !route.hasMidi) {
+                if (auto midi = std::get_if<ControlDefinition::MidiConfig>(&mapping.config)) {
+                    route.hasMidi = true;
+                    route.midiChannel = midi->channel;
+                    route.midiControl = midi->control;
+                }
+            }
+        }
+
+        return route;
+    }
+
+    void addRoute(const Route& route) {
+        if (count_ >= MAX_ROUTES) {
+            dropped_++;
+            return;
+        }
+        routes_[count_++] = route;
+    }
+
+    std::array<Route, MAX_ROUTES> routes_{};
+    size_t count_ = 0;
+    size_t dropped_ = 0;
+};
@@ -1,19 +1,24 @@
 #pragma once
 
 #include "BaseInputProcessor.hpp"
+#include "InputRoutingTable.hpp"
 #include "core/domain/navigation/NavigationEvent.hpp"
 #include "config/SystemConstants.hpp"
+#include "core/use_cases/ButtonGestureRecognizer.hpp"
 
 /**
  * @brief Processor spécialisé pour les entrées de navigation
  * 
  * Gère le routage des entrées physiques vers les événements de navigation.
+ * Les informations de routage proviennent de la table précalculée, sans
+ * copie de ControlDefinition par événement.
  */
 class NavigationInputProcessor : public BaseInputProcessor {
 public:
     NavigationInputProcessor(std::shared_ptr<UnifiedConfiguration> unifiedConfig,
-                           std::shared_ptr<EventBus> eventBus)
-        : BaseInputProcessor(unifiedConfig, eventBus) {}
+                           std::shared_ptr<EventBus> eventBus,
+                           const InputRoutingTable& routingTable)
+        : BaseInputProcessor(unifiedConfig, eventBus), routingTable_(routingTable) {}
     
     /**
      * @brief Traite un encodeur pour navigation
@@ -23,20 +28,16 @@ public:
             return false;
         }
         
-        auto controlOpt = findControlDefinition(id);
-        if (!controlOpt.has_value()) {
+        const auto* route = routingTable_.find(id);
+        if (!route || !route->hasNavigation) {
             return false;
         }
         
-        const auto& control = controlOpt.value();
-        if (!hasNavigationMappings(control)) {
-            return false;
-        }
-        
-        NavigationAction action = extractNavigationAction(control, true);
-        int parameter = calculateEncoderParameter(control, relativeChange);
+        int parameter = route->isEncoderHardware
+                            ? applySensitivity(relativeChange, route->sensitivity)
+                            : SystemConstants::Encoders::DEFAULT_PARAMETER;
         
-        emitNavigationEvent(action, parameter);
+        emitNavigationEvent(route->encoderAction, parameter);
         return true;
     }
     
@@ -53,55 +54,44 @@ public:
             return false;
         }
         
-        auto controlOpt = findControlDefinition(id);
-        if (!controlOpt.has_value()) {
-            return false;
-        }
-        
-        const auto& control = controlOpt.value();
-        if (!hasNavigationMappings(control)) {
+        const auto* route = routingTable_.find(id);
+        if (!route || !route->hasNavigation) {
             return false;
         }
         
-        NavigationAction action = extractNavigationAction(control, false);
-        int parameter = SystemConstants::Buttons::DEFAULT_PARAMETER;
-        
-        emitNavigationEvent(action, parameter);
+        emitNavigationEvent(route->buttonAction, SystemConstants::Buttons::DEFAULT_PARAMETER);
         return true;
     }
 
-private:
-    NavigationAction extractNavigationAction(const ControlDefinition& control, bool isEncoder) const {
-        auto navigationMappings = control.getMappingsForRole(MappingRole::NAVIGATION);
-        
-        for (const auto& mapping : navigationMappings) {
-            bool mappingForEncoder = (mapping.appliesTo == MappingControlType::ENCODER);
-            if (mappingForEncoder == isEncoder) {
-                const auto& navConfig = std::get<ControlDefinition::NavigationConfig>(mapping.config);
-                return navConfig.action;
-            }
+    /**
+     * @brief Traite un geste bouton pour navigation
+     *
+     * Seul l'appui long a une action configurable (ControlBuilder::withLongPress).
+     */
+    bool processButtonGesture(const ButtonGesture& gesture) {
+        if (!isValidContext() || gesture.type != ButtonGesture::Type::LongPress) {
+            return false;
         }
-        
-        // Actions par défaut depuis les constantes
-        return isEncoder ? SystemConstants::Encoders::DEFAULT_ACTION 
-                        : SystemConstants::Buttons::DEFAULT_ACTION;
-    }
-    
-    int calculateEncoderParameter(const ControlDefinition& control, int8_t relativeChange) const {
-        if (control.hardware.type != InputType::ENCODER) {
-            return SystemConstants::Encoders::DEFAULT_PARAMETER;
+
+        const auto* route = routingTable_.find(gesture.id);
+        if (!route || !route->hasLongPressAction) {
+            return false;
         }
-        
-        const auto& encoderConfig = std::get<ControlDefinition::EncoderConfig>(control.hardware.config);
-        return applySensitivity(relativeChange, encoderConfig.sensitivity);
+
+        emitNavigationEvent(route->longPressAction, SystemConstants::Buttons::DEFAULT_PARAMETER);
+        return true;
     }
-    
+
+private:
     void emitNavigationEvent(NavigationAction action, int parameter) {
         if (!eventBus_) {
             return;
         }
         
+        // Différé : la machine d'états de navigation s'exécute dans la tâche UI
         NavigationEvent event(action, parameter);
-        eventBus_->publish(event);
+        eventBus_->publishDeferred(event);
     }
-};
\ No newline at end of file
+
+    const InputRoutingTable& routingTable_;
+};
@@ -1,5 +1,7 @@
 #include "core/domain/commands/CommandManager.hpp"
 
+#include "core/utils/LatencyTrace.hpp"
+
 void CommandManager::execute(std::unique_ptr<ICommand> command) {
     // Exécuter la commande
     command->execute();
@@ -16,6 +18,7 @@ void CommandManager::execute(std::unique_ptr<ICommand> command) {
 void CommandManager::executeShared(ICommand& command) {
     // Exécuter la commande sans l'ajouter à l'historique
     // Utilisé pour les commandes provenant d'un pool d'objets
+    LATENCY_TRACE_STAGE(CommandExecute);
     command.execute();
     
     // Nous ne gardons pas de trace de cette commande pour l'annulation
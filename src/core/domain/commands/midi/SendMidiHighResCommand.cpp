@@ -0,0 +1,57 @@
+#include "core/domain/commands/midi/SendMidiHighResCommand.hpp"
+
+#include <cstdio>  // Pour snprintf
+
+void SendMidiHighResCommand::reset(MidiOutputPort& midiOut, MidiResolution resolution,
+                                   uint8_t channel, uint16_t number, uint16_t value,
+                                   uint16_t previousValue, uint8_t source) {
+    midiOut_ = &midiOut;
+    resolution_ = resolution;
+    channel_ = channel;
+    number_ = number;
+    value_ = value;
+    source_ = source;
+    previousValue_ = previousValue;
+    hasExecuted_ = false;
+}
+
+void SendMidiHighResCommand::execute() {
+    if (!midiOut_) return;  // Vérification de sécurité
+
+    hasExecuted_ = true;
+    send(value_);
+}
+
+bool SendMidiHighResCommand::undo() {
+    if (!hasExecuted_ || !midiOut_) {
+        return false;
+    }
+
+    send(previousValue_);
+    return true;
+}
+
+bool SendMidiHighResCommand::isUndoable() const {
+    return hasExecuted_ && midiOut_ != nullptr;
+}
+
+const char* SendMidiHighResCommand::getDescription() const {
+    static char buffer[80];
+    snprintf(buffer,
+             sizeof(buffer),
+             "Send MIDI %s: source=%d ch=%d num=%d val=%d",
+             resolution_ == MidiResolution::NRPN ? "NRPN" : "CC14",
+             source_,
+             channel_ + 1,
+             number_,
+             value_);
+    return buffer;
+}
+
+void SendMidiHighResCommand::send(uint16_t value) {
+    if (resolution_ == MidiResolution::NRPN) {
+        midiOut_->sendNrpn(channel_, number_, value, source_);
+    } else {
+        midiOut_->sendControlChange14(channel_, static_cast<MidiCC>(number_), value, source_);
+    }
+}
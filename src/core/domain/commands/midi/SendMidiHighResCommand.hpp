@@ -0,0 +1,64 @@
+#pragma once
+
+#include "core/domain/commands/Command.hpp"
+#include "core/domain/types.hpp"
+#include "core/ports/output/MidiOutputPort.hpp"
+
+/**
+ * @brief Commande pour envoyer une valeur MIDI 14 bits (paire CC MSB/LSB ou NRPN)
+ */
+class SendMidiHighResCommand : public ICommand {
+public:
+    /**
+     * @brief Constructeur par défaut pour le pool d'objets
+     */
+    SendMidiHighResCommand() = default;
+
+    /**
+     * @brief Réinitialise la commande avec de nouveaux paramètres
+     * @param midiOut Interface de sortie MIDI
+     * @param resolution CC_14BIT ou NRPN
+     * @param channel Canal MIDI (0-15)
+     * @param number CC MSB (0-31) ou numéro NRPN (0-16383)
+     * @param value Valeur 14 bits (0-16383)
+     * @param previousValue Valeur 14 bits en place avant la commande (renvoyée par undo)
+     * @param source ID de la source (encodeur, bouton, etc.)
+     */
+    void reset(MidiOutputPort& midiOut, MidiResolution resolution, uint8_t channel,
+               uint16_t number, uint16_t value, uint16_t previousValue, uint8_t source = 0);
+
+    /**
+     * @brief Exécute la commande : envoie la paire MSB/LSB ou la séquence NRPN
+     */
+    void execute() override;
+
+    /**
+     * @brief Annule la commande en renvoyant la valeur précédente
+     * @return true si la commande a été annulée, false sinon
+     */
+    bool undo() override;
+
+    /**
+     * @brief Vérifie si la commande peut être annulée
+     * @return true si la commande est annulable, false sinon
+     */
+    bool isUndoable() const override;
+
+    /**
+     * @brief Obtient la description de la commande
+     * @return Description textuelle de la commande
+     */
+    const char* getDescription() const override;
+
+private:
+    void send(uint16_t value);
+
+    MidiOutputPort* midiOut_ = nullptr;
+    MidiResolution resolution_ = MidiResolution::CC_14BIT;
+    uint8_t channel_ = 0;
+    uint16_t number_ = 0;
+    uint16_t value_ = 0;
+    uint8_t source_ = 0;
+    uint16_t previousValue_ = 0;  // Pour l'annulation
+    bool hasExecuted_ = false;
+};
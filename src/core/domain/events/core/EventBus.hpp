@@ -4,10 +4,14 @@
 #include <atomic>
 #include <algorithm>
 #include <memory>
+#include <initializer_list>
 #include <mutex>
 #include <Arduino.h>
 #include "config/SystemConstants.hpp"
 #include "config/ETLConfig.hpp"
+#include "core/memory/RingBuffer.hpp"
+#include "core/utils/LatencyTrace.hpp"
+#include "core/domain/navigation/NavigationEvent.hpp"
 #include "../MidiEvents.hpp"
 #include "../UIEvent.hpp"
 
@@ -16,6 +20,15 @@
  * 
  * Combine EventBus et OptimizedEventBus en une seule classe moderne
  * qui implémente l'interface IEventBus pour l'injection de dépendance.
+ *
+ * Un abonnement peut être filtré par types d'événements ou par catégorie.
+ * Des listes d'abonnés par type (et par catégorie) sont recalculées à chaque
+ * (dés)abonnement, si bien que publish() ne visite que les écouteurs
+ * intéressés, dans l'ordre de priorité.
+ *
+ * publishDeferred() copie les événements à charge utile simple (navigation,
+ * MIDI CC/notes) dans une file circulaire vidée par update() avec un budget
+ * de temps ; les événements haute priorité sont toujours publiés immédiatement.
  */
 class EventBus : public MidiController::Events::IEventBus, public EventListener {
 public:
@@ -28,12 +41,31 @@ public:
         unsigned long status_update_interval_ms; ///< 10 FPS pour status
         bool coalesce_identical_values;          ///< Fusionner valeurs identiques
         bool enable_batching;                    ///< Activer le batching
+        uint32_t deferred_drain_budget_us;       ///< Budget de vidage de la file différée par update()
         
         Config() 
             : ui_update_interval_ms(SystemConstants::Performance::DISPLAY_REFRESH_PERIOD_MS)
             , status_update_interval_ms(100)
             , coalesce_identical_values(true)
-            , enable_batching(true) {}
+            , enable_batching(true)
+            , deferred_drain_budget_us(SystemConstants::Performance::DEFERRED_EVENT_DRAIN_BUDGET_US) {}
+    };
+    
+    /**
+     * @brief Statistiques de la file d'événements différés
+     */
+    struct DeferredStats {
+        uint32_t queued;           ///< Événements mis en file
+        uint32_t drained;          ///< Événements publiés depuis la file
+        uint32_t bypassed;         ///< Événements haute priorité publiés immédiatement
+        uint32_t unsupported;      ///< Types sans charge utile différable, publiés après vidage de la file
+        uint32_t overflows;        ///< File pleine : file vidée puis événement publié
+        uint32_t forced_flushes;   ///< Vidages complets hors update() pour préserver l'ordre
+        uint32_t budget_exceeded;  ///< update() interrompus par le budget de temps
+        size_t depth;              ///< Profondeur courante de la file
+        size_t high_water;         ///< Profondeur maximale atteinte
+        uint32_t last_drain_us;    ///< Durée du dernier vidage
+        uint32_t max_drain_us;     ///< Durée maximale d'un vidage
     };
     
     /**
@@ -66,22 +98,37 @@ public:
      * @return Identifiant d'abonnement, 0 si échec
      */
     SubscriptionId subscribe(EventListener* listener, EventPriority priority = EventPriority::PRIORITY_NORMAL) override {
-        if (!listener) {
+        return addSubscription(listener, priority, {}, EventCategory::None);
+    }
+    
+    /**
+     * @brief S'abonne uniquement à certains types d'événements
+     * @param listener Écouteur d'événements
+     * @param types Types d'événements reçus (MAX_EVENT_TYPES_PER_SUBSCRIPTION au plus)
+     * @param priority Niveau de priorité
+     * @return Identifiant d'abonnement, 0 si échec
+     */
+    SubscriptionId subscribeToTypes(EventListener* listener, std::initializer_list<EventType> types,
+                                    EventPriority priority = EventPriority::PRIORITY_NORMAL) override {
+        if (types.size() == 0 || types.size() > MAX_TYPES_PER_SUBSCRIPTION) {
             return 0;
         }
-        
-        Subscription sub;
-        sub.listener = listener;
-        sub.id = nextId_++;
-        sub.priority = priority;
-        sub.active = true;
-        
-        subscriptions_.push_back(sub);
-        
-        // Trier par priorité pour optimiser la publication
-        sortByPriority();
-        
-        return sub.id;
+        return addSubscription(listener, priority, types, EventCategory::None);
+    }
+    
+    /**
+     * @brief S'abonne uniquement à une catégorie d'événements
+     * @param listener Écouteur d'événements
+     * @param category Catégorie reçue
+     * @param priority Niveau de priorité
+     * @return Identifiant d'abonnement, 0 si échec
+     */
+    SubscriptionId subscribeToCategory(EventListener* listener, EventCategory category,
+                                       EventPriority priority = EventPriority::PRIORITY_NORMAL) override {
+        if (category == EventCategory::None) {
+            return 0;
+        }
+        return addSubscription(listener, priority, {}, category);
     }
     
     /**
@@ -127,6 +174,7 @@ public:
         
         if (it != subscriptions_.end()) {
             subscriptions_.erase(it);
+            rebuildBuckets();
             return true;
         }
         
@@ -157,26 +205,11 @@ public:
      * @return true si au moins un abonné a traité l'événement, false sinon
      */
     bool publish(Event& event) override {
-        bool handled = false;
-        
-        // Traiter tous les abonnements (déjà triés par priorité)
-        for (auto& subscription : subscriptions_) {
-            if (subscription.active && subscription.listener) {
-                if (subscription.listener->onEvent(event)) {
-                    handled = true;
-                    event.setHandled();
-                }
-                
-                // Arrêter la propagation si demandé
-                if (!event.shouldPropagate()) {
-                    break;
-                }
-            }
-        }
+        LATENCY_TRACE_STAGE(EventBusPublish);
+        bool handled = dispatch(event, 0);
         
         // Incrémenter les compteurs de performance pour les événements haute priorité
-        if (event.getType() >= EventTypes::HighPriorityEncoderChanged && 
-            event.getType() <= EventTypes::HighPriorityButtonPress) {
+        if (isHighPriorityType(event.getType())) {
             uint8_t index = event.getType() - EventTypes::HighPriorityEncoderChanged;
             if (index < eventCounters_.size()) {
                 eventCounters_[index].fetch_add(1, std::memory_order_relaxed);
@@ -196,11 +229,49 @@ public:
         return false;
     }
     
+    /**
+     * @brief Publie un événement de façon différée (au prochain update())
+     *
+     * Les événements haute priorité sont publiés immédiatement et doublent la
+     * file. Les types sans charge utile différable et les événements arrivant
+     * sur une file pleine sont publiés après vidage complet de la file, pour
+     * rester dans l'ordre de publication.
+     * @param event Événement à publier
+     * @return true si l'événement a été mis en file ou traité
+     */
+    bool publishDeferred(Event& event) override {
+        if (isHighPriorityType(event.getType())) {
+            deferredStats_.bypassed++;
+            return publish(event);
+        }
+        
+        DeferredEvent deferred{};
+        if (!started_ || !encodeDeferred(event, deferred)) {
+            deferredStats_.unsupported++;
+            flushDeferredEvents();
+            return publish(event);
+        }
+        
+        if (!deferredQueue_.write(deferred)) {
+            deferredStats_.overflows++;
+            flushDeferredEvents();
+            return publish(event);
+        }
+        
+        deferredStats_.queued++;
+        size_t depth = deferredQueue_.size();
+        if (depth > deferredStats_.high_water) {
+            deferredStats_.high_water = depth;
+        }
+        return true;
+    }
+    
     /**
      * @brief Supprime tous les abonnements
      */
     void clear() override {
         subscriptions_.clear();
+        rebuildBuckets();
     }
     
     /**
@@ -266,6 +337,37 @@ public:
         }
     }
     
+    /**
+     * @brief Obtient les statistiques de la file d'événements différés
+     */
+    DeferredStats getDeferredStats() const {
+        DeferredStats stats = deferredStats_;
+        stats.depth = deferredQueue_.size();
+        return stats;
+    }
+    
+    /**
+     * @brief Indique si update() a du travail à effectuer maintenant
+     * @return true si des événements différés attendent ou si le batch UI est dû
+     */
+    bool hasPendingWork() const {
+        if (!started_) {
+            return false;
+        }
+        if (!deferredQueue_.is_empty()) {
+            return true;
+        }
+        return config_.enable_batching && ui_batch_pending_ &&
+               (millis() - last_ui_batch_ms_) >= config_.ui_update_interval_ms;
+    }
+
+    /**
+     * @brief Réinitialise les statistiques de la file d'événements différés
+     */
+    void resetDeferredStats() {
+        deferredStats_ = DeferredStats{};
+    }
+    
     // === Nouvelles méthodes de gestion du cycle de vie (consolidées depuis EventManager) ===
     
     /**
@@ -330,6 +432,9 @@ public:
             return;
         }
         
+        // Publier les événements différés avant le batching UI
+        drainDeferredEvents();
+        
         // Traiter les batchs en attente
         if (config_.enable_batching) {
             processPendingBatches();
@@ -385,6 +490,52 @@ private:
         SubscriptionId id;
         EventPriority priority;
         bool active;
+        EventCategory category;  // None = toutes catégories
+        uint8_t typeCount;       // 0 = tous types
+        std::array<EventType, SystemConstants::Performance::MAX_EVENT_TYPES_PER_SUBSCRIPTION> types;
+        
+        bool acceptsType(EventType type) const {
+            for (uint8_t i = 0; i < typeCount; ++i) {
+                if (types[i] == type) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        
+        bool accepts(const Event& event) const {
+            if (typeCount > 0) {
+                return acceptsType(event.getType());
+            }
+            return category == EventCategory::None || category == event.getCategory();
+        }
+    };
+    
+    /**
+     * @brief Charge utile trivialement copiable d'un événement différé
+     */
+    struct DeferredEvent {
+        EventType type;
+        uint8_t a;      // action / état / canal
+        uint8_t b;      // paramètre / contrôleur / note
+        uint8_t c;      // sous-état / valeur / vélocité
+        uint8_t d;      // source
+        int32_t value;  // paramètre de navigation
+    };
+    
+    static constexpr size_t MAX_TYPES_PER_SUBSCRIPTION =
+        SystemConstants::Performance::MAX_EVENT_TYPES_PER_SUBSCRIPTION;
+    static constexpr size_t CATEGORY_COUNT = static_cast<size_t>(EventCategory::System) + 1;
+    
+    // Indices dans subscriptions_, dans l'ordre de priorité
+    using SubscriberIndexList = ETLConfig::EventSubscriptionVector<uint8_t>;
+    
+    /**
+     * @brief Abonnés candidats pour un type d'événement donné
+     */
+    struct TypeBucket {
+        EventType type;
+        SubscriberIndexList subscribers;
     };
     
     
@@ -392,6 +543,34 @@ private:
     EventBus(const EventBus&) = delete;
     EventBus& operator=(const EventBus&) = delete;
     
+    /**
+     * @brief Ajoute un abonnement (filtré ou non) et recalcule les listes
+     */
+    SubscriptionId addSubscription(EventListener* listener, EventPriority priority,
+                                   std::initializer_list<EventType> types, EventCategory category) {
+        if (!listener || subscriptions_.full()) {
+            return 0;
+        }
+        
+        Subscription sub{};
+        sub.listener = listener;
+        sub.id = nextId_++;
+        sub.priority = priority;
+        sub.active = true;
+        sub.category = category;
+        for (EventType type : types) {
+            sub.types[sub.typeCount++] = type;
+        }
+        
+        subscriptions_.push_back(sub);
+        
+        // Trier par priorité pour optimiser la publication
+        sortByPriority();
+        rebuildBuckets();
+        
+        return sub.id;
+    }
+    
     /**
      * @brief Trie les abonnements par priorité
      */
@@ -402,6 +581,270 @@ private:
                  });
     }
     
+    /**
+     * @brief Recalcule les listes d'abonnés par type et par catégorie
+     *
+     * Une liste par type contient les abonnés filtrés sur ce type, ceux filtrés
+     * par catégorie et les abonnés sans filtre. Les types sans liste dédiée
+     * utilisent la liste de leur catégorie.
+     */
+    void rebuildBuckets() {
+        typeBuckets_.clear();
+        for (auto& bucket : categoryBuckets_) {
+            bucket.clear();
+        }
+        
+        // Créer une liste par type filtré
+        for (const auto& sub : subscriptions_) {
+            for (uint8_t t = 0; t < sub.typeCount; ++t) {
+                if (!findTypeBucket(sub.types[t]) && !typeBuckets_.full()) {
+                    typeBuckets_.push_back(TypeBucket{sub.types[t], {}});
+                }
+            }
+        }
+        
+        // Remplir dans l'ordre de priorité de subscriptions_
+        for (size_t i = 0; i < subscriptions_.size(); ++i) {
+            const auto& sub = subscriptions_[i];
+            const uint8_t index = static_cast<uint8_t>(i);
+            
+            if (sub.typeCount > 0) {
+                for (auto& bucket : typeBuckets_) {
+                    if (sub.acceptsType(bucket.type)) {
+                        bucket.subscribers.push_back(index);
+                    }
+                }
+                
+                // Type sans liste dédiée (typeBuckets_ plein) : passer par les catégories
+                bool allTypesBucketed = true;
+                for (uint8_t t = 0; t < sub.typeCount; ++t) {
+                    allTypesBucketed = allTypesBucketed && findTypeBucket(sub.types[t]);
+                }
+                if (!allTypesBucketed) {
+                    for (auto& bucket : categoryBuckets_) {
+                        bucket.push_back(index);
+                    }
+                }
+                continue;
+            }
+            
+            // Catégorie ou sans filtre : candidats pour tous les types
+            for (auto& bucket : typeBuckets_) {
+                bucket.subscribers.push_back(index);
+            }
+            for (size_t c = 0; c < CATEGORY_COUNT; ++c) {
+                if (sub.category == EventCategory::None ||
+                    static_cast<size_t>(sub.category) == c) {
+                    categoryBuckets_[c].push_back(index);
+                }
+            }
+        }
+    }
+    
+    static bool isHighPriorityType(EventType type) {
+        return type >= EventTypes::HighPriorityEncoderChanged &&
+               type <= EventTypes::HighPriorityButtonPress;
+    }
+    
+    /**
+     * @brief Copie la charge utile d'un événement différable
+     * @return false si le type n'est pas pris en charge
+     */
+    static bool encodeDeferred(const Event& event, DeferredEvent& out) {
+        out.type = event.getType();
+        switch (event.getType()) {
+            case NavigationEventTypes::NAVIGATION_REQUESTED: {
+                const auto& nav = static_cast<const NavigationEvent&>(event);
+                out.a = static_cast<uint8_t>(nav.getAction());
+                out.value = nav.getParameter();
+                return true;
+            }
+            case NavigationEventTypes::STATE_CHANGE_REQUESTED: {
+                const auto& state = static_cast<const StateChangeEvent&>(event);
+                out.a = static_cast<uint8_t>(state.getNewState());
+                out.b = state.getParameter();
+                out.c = state.getSubState();
+                return true;
+            }
+            case NavigationEventTypes::BACK_REQUESTED:
+            case NavigationEventTypes::HOME_REQUESTED:
+            case NavigationEventTypes::MENU_ROOT_REQUESTED:
+                return true;
+            case EventTypes::MidiControlChange: {
+                const auto& cc = static_cast<const MidiCCEvent&>(event);
+                out.a = cc.channel;
+                out.b = cc.controller;
+                out.c = cc.value;
+                out.d = cc.source;
+                return true;
+            }
+            case EventTypes::MidiNoteOn: {
+                const auto& note = static_cast<const MidiNoteOnEvent&>(event);
+                out.a = note.channel;
+                out.b = note.note;
+                out.c = note.velocity;
+                out.d = note.source;
+                return true;
+            }
+            case EventTypes::MidiNoteOff: {
+                const auto& note = static_cast<const MidiNoteOffEvent&>(event);
+                out.a = note.channel;
+                out.b = note.note;
+                out.c = note.velocity;
+                out.d = note.source;
+                return true;
+            }
+            default:
+                return false;
+        }
+    }
+    
+    /**
+     * @brief Reconstruit et publie un événement différé
+     */
+    void publishDecoded(const DeferredEvent& deferred) {
+        switch (deferred.type) {
+            case NavigationEventTypes::NAVIGATION_REQUESTED: {
+                NavigationEvent event(static_cast<NavigationAction>(deferred.a), deferred.value);
+                publish(event);
+                break;
+            }
+            case NavigationEventTypes::STATE_CHANGE_REQUESTED: {
+                StateChangeEvent event(static_cast<AppState>(deferred.a), deferred.b, deferred.c);
+                publish(event);
+                break;
+            }
+            case NavigationEventTypes::BACK_REQUESTED: {
+                BackRequestedEvent event;
+                publish(event);
+                break;
+            }
+            case NavigationEventTypes::HOME_REQUESTED: {
+                HomeRequestedEvent event;
+                publish(event);
+                break;
+            }
+            case NavigationEventTypes::MENU_ROOT_REQUESTED: {
+                MenuRootRequestedEvent event;
+                publish(event);
+                break;
+            }
+            case EventTypes::MidiControlChange: {
+                MidiCCEvent event(deferred.a, deferred.b, deferred.c, deferred.d);
+                publish(event);
+                break;
+            }
+            case EventTypes::MidiNoteOn: {
+                MidiNoteOnEvent event(deferred.a, deferred.b, deferred.c, deferred.d);
+                publish(event);
+                break;
+            }
+            case EventTypes::MidiNoteOff: {
+                MidiNoteOffEvent event(deferred.a, deferred.b, deferred.c, deferred.d);
+                publish(event);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    
+    /**
+     * @brief Publie les événements différés dans la limite du budget de temps
+     *
+     * Au moins un événement est publié par appel pour garantir la progression.
+     */
+    void drainDeferredEvents() {
+        if (deferredQueue_.is_empty()) {
+            return;
+        }
+        
+        const uint32_t startUs = micros();
+        DeferredEvent deferred;
+        while (deferredQueue_.read(deferred)) {
+            publishDecoded(deferred);
+            deferredStats_.drained++;
+            
+            if (!deferredQueue_.is_empty() &&
+                (micros() - startUs) >= config_.deferred_drain_budget_us) {
+                deferredStats_.budget_exceeded++;
+                break;
+            }
+        }
+        
+        const uint32_t elapsedUs = micros() - startUs;
+        deferredStats_.last_drain_us = elapsedUs;
+        if (elapsedUs > deferredStats_.max_drain_us) {
+            deferredStats_.max_drain_us = elapsedUs;
+        }
+    }
+    
+    /**
+     * @brief Publie toute la file différée, sans budget de temps
+     *
+     * Appelé avant une publication immédiate depuis publishDeferred() : les
+     * événements déjà en file sortent en premier. Sûr tant que producteur et
+     * consommateur de la file tournent dans la même boucle coopérative.
+     */
+    void flushDeferredEvents() {
+        if (deferredQueue_.is_empty()) {
+            return;
+        }
+        
+        deferredStats_.forced_flushes++;
+        DeferredEvent deferred;
+        while (deferredQueue_.read(deferred)) {
+            publishDecoded(deferred);
+            deferredStats_.drained++;
+        }
+    }
+    
+    TypeBucket* findTypeBucket(EventType type) {
+        for (auto& bucket : typeBuckets_) {
+            if (bucket.type == type) {
+                return &bucket;
+            }
+        }
+        return nullptr;
+    }
+    
+    /**
+     * @brief Distribue un événement aux seuls abonnés intéressés
+     * @param excludedId Abonnement à ignorer (0 = aucun)
+     */
+    bool dispatch(Event& event, SubscriptionId excludedId) {
+        const SubscriberIndexList* candidates = nullptr;
+        if (const TypeBucket* bucket = findTypeBucket(event.getType())) {
+            candidates = &bucket->subscribers;
+        } else {
+            size_t category = static_cast<size_t>(event.getCategory());
+            candidates = &categoryBuckets_[category < CATEGORY_COUNT ? category : 0];
+        }
+        
+        bool handled = false;
+        
+        // Les candidats sont déjà triés par priorité
+        for (uint8_t index : *candidates) {
+            auto& subscription = subscriptions_[index];
+            if (!subscription.active || !subscription.listener || subscription.id == excludedId ||
+                !subscription.accepts(event)) {
+                continue;
+            }
+            
+            if (subscription.listener->onEvent(event)) {
+                handled = true;
+                event.setHandled();
+            }
+            
+            // Arrêter la propagation si demandé
+            if (!event.shouldPropagate()) {
+                break;
+            }
+        }
+        
+        return handled;
+    }
+    
     /**
      * @brief Active/désactive un abonnement
      */
@@ -422,6 +865,10 @@ private:
     ETLConfig::EventSubscriptionVector<Subscription> subscriptions_;
     SubscriptionId nextId_;
     
+    // Listes d'abonnés précalculées (voir rebuildBuckets)
+    etl::vector<TypeBucket, SystemConstants::Performance::MAX_EVENT_TYPE_BUCKETS> typeBuckets_;
+    std::array<SubscriberIndexList, CATEGORY_COUNT> categoryBuckets_;
+    
     // === Variables de cycle de vie ===
     bool initialized_;
     bool started_;
@@ -430,6 +877,10 @@ private:
     // Compteurs atomiques pour le suivi des événements traités (diagnostics)
     std::array<std::atomic<uint32_t>, 3> eventCounters_; // Un compteur par type d'événement haute priorité
     
+    // === File d'événements différés ===
+    RingBuffer<DeferredEvent, SystemConstants::Performance::DEFERRED_EVENT_QUEUE_SIZE> deferredQueue_;
+    DeferredStats deferredStats_{};
+    
     // === Variables de batching (intégrées depuis EventBatcher) ===
     struct PendingParameter {
         uint8_t controller;
@@ -442,6 +893,7 @@ private:
     
     ETLConfig::MidiPendingMap<uint16_t, PendingParameter> pending_parameters_; // Key: (channel << 8) | controller
     unsigned long last_ui_batch_ms_ = 0;
+    bool ui_batch_pending_ = false;  // Au moins un paramètre attend le prochain batch UI
     unsigned long last_status_batch_ms_ = 0;
     SubscriptionId batching_subscription_id_ = 0;
     
@@ -460,7 +912,8 @@ private:
     void startBatching() {
         if (batching_subscription_id_ == 0) {
             // S'abonner aux événements avec haute priorité pour traiter avant l'UI
-            batching_subscription_id_ = subscribe(this, EventPriority::PRIORITY_HIGH);
+            batching_subscription_id_ =
+                subscribeToTypes(this, {EventTypes::MidiControlChange}, EventPriority::PRIORITY_HIGH);
         }
     }
     
@@ -516,6 +969,7 @@ private:
             param.needs_ui_update = true;
             
             pending_parameters_[key] = param;
+            ui_batch_pending_ = true;
             
         } else {
             // Paramètre existant - mise à jour
@@ -529,6 +983,7 @@ private:
             param.value = midi_event.value;
             param.last_update_ms = now;
             param.needs_ui_update = true;
+            ui_batch_pending_ = true;
         }
     }
     
@@ -558,6 +1013,7 @@ private:
                 param.needs_ui_update = false;
             }
         }
+        ui_batch_pending_ = false;
     }
     
     /**
@@ -572,25 +1028,7 @@ private:
      * @brief Publication directe sans batching (pour éviter la récursion)
      */
     bool publishDirect(Event& event) {
-        bool handled = false;
-        
-        // Traiter tous les abonnements (déjà triés par priorité)
-        // Mais exclure l'abonnement du batching pour éviter la récursion
-        for (auto& subscription : subscriptions_) {
-            if (subscription.active && subscription.listener && 
-                subscription.id != batching_subscription_id_) {
-                if (subscription.listener->onEvent(event)) {
-                    handled = true;
-                    event.setHandled();
-                }
-                
-                // Arrêter la propagation si demandé
-                if (!event.shouldPropagate()) {
-                    break;
-                }
-            }
-        }
-        
-        return handled;
+        // Exclure l'abonnement du batching pour éviter la récursion
+        return dispatch(event, batching_subscription_id_);
     }
 };
\ No newline at end of file
@@ -11,6 +11,9 @@ namespace EventTypes {
     constexpr EventType EncoderButton = 2;
     constexpr EventType ButtonPressed = 3;
     constexpr EventType ButtonReleased = 4;
+    constexpr EventType ButtonLongPress = 5;
+    constexpr EventType ButtonDoubleClick = 6;
+    constexpr EventType ButtonChord = 7;
     
     // Types d'événements UI - plage 1000-1999
     constexpr EventType ScreenChange = 1000;
@@ -119,3 +122,28 @@ public:
     
     uint8_t id;   // Identifiant du bouton
 };
+
+/**
+ * @brief Événement de geste bouton (appui long, double clic, accord)
+ */
+class ButtonGestureEvent : public Event {
+public:
+    static constexpr uint8_t MAX_CHORD_BUTTONS = 4;
+
+    /**
+     * @brief Constructeur
+     * @param type ButtonLongPress, ButtonDoubleClick ou ButtonChord
+     * @param id Identifiant du bouton à l'origine du geste
+     * @param timestampUs Instant du geste (micros())
+     */
+    ButtonGestureEvent(EventType type, uint16_t id, uint32_t timestampUs)
+        : Event(type, EventCategory::Input),
+          id(id), timestampUs(timestampUs), chordSize(0), chordIds{} {}
+
+    virtual const char* getEventName() const override { return "ButtonGesture"; }
+
+    uint16_t id;            // Identifiant du bouton
+    uint32_t timestampUs;   // Instant du geste
+    uint8_t chordSize;      // Nombre de boutons de l'accord
+    uint16_t chordIds[MAX_CHORD_BUTTONS];  // Boutons de l'accord
+};
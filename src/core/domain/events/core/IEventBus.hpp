@@ -3,6 +3,7 @@
 #include "Event.hpp"
 #include "EventTypes.hpp"
 #include <cstdint>
+#include <initializer_list>
 
 // Identifiant d'abonnement
 using SubscriptionId = uint16_t;
@@ -66,6 +67,27 @@ public:
     virtual SubscriptionId subscribeNormal(EventListener* listener) = 0;
     virtual SubscriptionId subscribeLow(EventListener* listener) = 0;
     
+    /**
+     * @brief S'abonne uniquement à certains types d'événements
+     * @param listener Écouteur d'événements
+     * @param types Types d'événements reçus
+     * @param priority Niveau de priorité
+     * @return Identifiant d'abonnement, 0 si échec
+     */
+    virtual SubscriptionId subscribeToTypes(EventListener* listener,
+                                            std::initializer_list<EventType> types,
+                                            EventPriority priority = EventPriority::PRIORITY_NORMAL) = 0;
+    
+    /**
+     * @brief S'abonne uniquement à une catégorie d'événements
+     * @param listener Écouteur d'événements
+     * @param category Catégorie reçue
+     * @param priority Niveau de priorité
+     * @return Identifiant d'abonnement, 0 si échec
+     */
+    virtual SubscriptionId subscribeToCategory(EventListener* listener, EventCategory category,
+                                               EventPriority priority = EventPriority::PRIORITY_NORMAL) = 0;
+    
     /**
      * @brief Se désabonne du bus d'événements
      * @param id Identifiant d'abonnement
@@ -99,6 +121,13 @@ public:
      */
     virtual bool publish(Event* event) = 0;
     
+    /**
+     * @brief Publie un événement au prochain update() (file différée)
+     * @param event Événement à publier
+     * @return true si l'événement a été mis en file ou traité
+     */
+    virtual bool publishDeferred(Event& event) = 0;
+    
     /**
      * @brief Supprime tous les abonnements
      */
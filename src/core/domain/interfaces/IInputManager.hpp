@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "config/SystemConstants.hpp"
 #include "config/unified/ControlDefinition.hpp"
 #include "core/utils/Result.hpp"
 
@@ -24,8 +25,15 @@ public:
         bool enableEncoders;
         bool enableButtons;
         bool enableEventProcessing;
+        bool enableTimerSampling;     // Boutons et encodeurs relevés en interruption timer
+        uint32_t samplingPeriodUs;    // Période de l'échantillonnage en interruption
         
-        ManagerConfig() : enableEncoders(true), enableButtons(true), enableEventProcessing(true) {}
+        ManagerConfig()
+            : enableEncoders(true),
+              enableButtons(true),
+              enableEventProcessing(true),
+              enableTimerSampling(SystemConstants::Input::TIMER_SAMPLING_ENABLED),
+              samplingPeriodUs(SystemConstants::Input::SAMPLING_PERIOD_US) {}
     };
 
     /**
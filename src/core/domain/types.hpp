@@ -74,6 +74,15 @@ enum class MidiEventType {
     COMMON
 };
 
+/**
+ * @brief Résolution de sortie d'un mapping MIDI d'encodeur
+ */
+enum class MidiResolution : uint8_t {
+    CC_7BIT,                     ///< Control Change standard (0-127)
+    CC_14BIT,                    ///< Paire MSB/LSB (CC n / CC n+32, 0-16383)
+    NRPN                         ///< NRPN 14 bits (CC 99/98 + Data Entry 6/38)
+};
+
 /**
  * @brief Rôles des mappings dans le système unifié
  */
@@ -203,9 +203,10 @@ namespace MidiBuffers {
     /**
      * @brief Buffer pour messages MIDI sortants
      * 
-     * Taille plus petite car généralement moins de trafic sortant
+     * Taille 256 : contient un paquet USB High-Speed complet (128 événements)
+     * plus les messages arrivés pendant son envoi
      */
-    using OutgoingMidiBuffer = RingBuffer<MidiMessage, 128>;
+    using OutgoingMidiBuffer = RingBuffer<MidiMessage, 256>;
     
     /**
      * @brief Buffer pour événements MIDI haute priorité
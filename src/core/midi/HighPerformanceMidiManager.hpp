@@ -4,7 +4,10 @@
 #include "MidiBatchProcessor.hpp"
 #include "core/memory/RingBuffer.hpp"
 #include "core/memory/EventPoolManager.hpp"
+#include "core/domain/events/core/IEventBus.hpp"
+#include "core/domain/events/UIEvent.hpp"
 #include "config/SystemConstants.hpp"
+#include "core/utils/CycleProfiler.hpp"
 #include <memory>
 
 /**
@@ -15,6 +18,8 @@
  * - MidiBatchProcessor pour batching avec tableau statique
  * - RingBuffer pour queuing des messages
  * - Integration avec EventPoolManager pour événements
+ * - Publication des retours CC entrants (DAW) vers l'UI via EventBus, au plus
+ *   une mise à jour par paramètre et par intervalle d'affichage
  */
 class HighPerformanceMidiManager {
 public:
@@ -45,20 +50,24 @@ public:
         // Métriques agrégées
         uint32_t total_messages_per_second;
         uint32_t total_latency_us;
+        uint32_t ui_updates_published;  // UIParameterUpdateEvent publiés sur l'EventBus
         float system_load_ratio;
         bool is_realtime_capable;
     };
     
     /**
-     * @brief Constructeur avec configuration et pool manager
+     * @brief Constructeur avec configuration, pool manager et bus d'événements
+     * @param event_bus Bus recevant les UIParameterUpdateEvent batchés (optionnel)
      */
     explicit HighPerformanceMidiManager(
         const Config& config = Config(),
-        std::shared_ptr<EventPoolManager> pool_manager = nullptr)
+        std::shared_ptr<EventPoolManager> pool_manager = nullptr,
+        std::shared_ptr<MidiController::Events::IEventBus> event_bus = nullptr)
         : config_(config)
         , processor_(config.processor_config)
         , batch_processor_(config.batch_config)
         , pool_manager_(pool_manager)
+        , event_bus_(event_bus)
         , last_monitoring_ms_(0)
         , messages_last_second_(0) {
         
@@ -108,6 +117,14 @@ public:
         }
     }
     
+    /**
+     * @brief Indique si update() a du travail à effectuer maintenant
+     * @return true si des messages attendent ou si un batch est dû
+     */
+    bool hasPendingWork() const {
+        return processor_.hasIncomingMessages() || batch_processor_.hasDueBatches();
+    }
+
     /**
      * @brief Enregistre un callback pour Control Change
      * 
@@ -189,6 +206,7 @@ public:
         // Calculer les métriques agrégées
         global_stats.total_messages_per_second = messages_last_second_;
         global_stats.total_latency_us = processor_stats.avg_latency_us;
+        global_stats.ui_updates_published = ui_updates_published_;
         global_stats.system_load_ratio = calculateSystemLoad();
         global_stats.is_realtime_capable = isRealtimeCapable();
         
@@ -214,6 +232,7 @@ public:
         processor_.resetStats();
         batch_processor_.resetStats();
         messages_last_second_ = 0;
+        ui_updates_published_ = 0;
     }
     
     /**
@@ -240,6 +259,11 @@ public:
         info += "Realtime: " + String(global_stats.is_realtime_capable ? "YES" : "NO") + "\n";
         info += "Buffer Overruns: " + String(global_stats.processor_stats.buffer_overruns) + "\n";
         info += "Callback Errors: " + String(global_stats.processor_stats.callback_errors) + "\n";
+        info += "UI Updates: " + String(global_stats.ui_updates_published) + "\n";
+#ifdef CYCLE_PROFILER
+        // Cycles par tâche et par portée (dispatch, batch, mapper, coalescence, USB)
+        CycleProfiler::appendReport(info);
+#endif
         
         return info;
     }
@@ -285,22 +309,19 @@ private:
     
     /**
      * @brief Gère les événements UI batchés
+     *
+     * Appelé par MidiBatchProcessor au plus une fois par paramètre et par
+     * intervalle UI. L'événement est construit sur la pile sans nom : les vues
+     * affichent "CC<n>" par défaut, ce qui évite une allocation String par événement.
      */
     void handleUIBatchEvent(uint8_t controller, uint8_t channel, uint8_t value) {
-        if (config_.enable_event_integration && pool_manager_) {
-            // Créer un événement UI via le pool manager
-            auto* ui_event = pool_manager_->acquireUIParameterUpdateEvent(
-                controller, channel, value, "CC" + String(controller)
-            );
-            
-            if (ui_event) {
-                // TODO: Publier l'événement via EventBus
-                // Ceci nécessiterait une référence à EventBus
-                
-                // Pour l'instant, libérer l'événement
-                pool_manager_->releaseUIParameterUpdateEvent(ui_event);
-            }
+        if (!config_.enable_event_integration || !event_bus_) {
+            return;
         }
+        
+        UIParameterUpdateEvent ui_event(controller, channel, value);
+        event_bus_->publish(ui_event);
+        ui_updates_published_++;
     }
     
     /**
@@ -348,9 +369,11 @@ private:
     OptimizedMidiProcessor processor_;
     MidiBatchProcessor batch_processor_;
     std::shared_ptr<EventPoolManager> pool_manager_;
+    std::shared_ptr<MidiController::Events::IEventBus> event_bus_;
     
     // Monitoring
     uint32_t last_monitoring_ms_;
     uint32_t messages_last_second_;
     uint32_t last_message_count_ = 0;
+    uint32_t ui_updates_published_ = 0;
 };
\ No newline at end of file
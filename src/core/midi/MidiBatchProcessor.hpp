@@ -3,6 +3,7 @@
 #include "config/SystemConstants.hpp"
 #include "config/ETLConfig.hpp"
 #include "core/domain/types.hpp"
+#include "core/utils/CycleProfiler.hpp"
 #include <array>
 #include <atomic>
 #include <Arduino.h>
@@ -12,6 +13,14 @@
  * 
  * Cette classe remplace std::map par un tableau indexé pour
  * éliminer complètement les allocations dynamiques dans le batching MIDI.
+ * Une table directe (canal, CC) -> slot rend addParameter() O(1), et des
+ * listes de slots modifiés limitent les vidages aux seules entrées en attente.
+ *
+ * Un slot n'est occupé que le temps d'être vidé : il retourne à la pile libre
+ * dès que les vidages UI et status l'ont consommé, la dernière valeur de
+ * chaque clé restant mémorisée à part pour la coalescence. Si plus de
+ * MAX_MIDI_PENDING_PARAMS clés attendent en même temps, les batchs sont
+ * vidés avant l'échéance pour libérer des slots : aucune valeur n'est perdue.
  */
 class MidiBatchProcessor {
 public:
@@ -78,6 +87,7 @@ public:
         for (auto& param : parameters_) {
             param = PendingParameter{};
         }
+        resetIndex();
     }
     
     /**
@@ -115,49 +125,55 @@ public:
      */
     bool addParameter(uint8_t controller, uint8_t channel, uint8_t value) {
         uint32_t now = millis();
-        
-        // Chercher un paramètre existant
-        int index = findParameter(controller, channel);
-        
-        if (index >= 0) {
-            // Paramètre existant - mise à jour
+        const uint16_t key = makeKey(controller, channel);
+        uint8_t index = slot_index_[key];
+
+        // Vérifier coalescing des valeurs identiques (en attente ou déjà vidée)
+        if (config_.coalesce_identical_values && last_values_[key] == value) {
+            parameters_coalesced_.fetch_add(1, std::memory_order_relaxed);
+            return true; // Valeur identique, pas de mise à jour nécessaire
+        }
+        last_values_[key] = value;
+
+        if (index != NO_SLOT) {
+            // Paramètre en attente - mise à jour
             PendingParameter& param = parameters_[index];
             
-            // Vérifier coalescing des valeurs identiques
-            if (config_.coalesce_identical_values && param.value == value) {
-                return true; // Valeur identique, pas de mise à jour nécessaire
+            if (param.needs_ui_update) {
+                // Valeur précédente écrasée avant d'atteindre l'UI
+                parameters_coalesced_.fetch_add(1, std::memory_order_relaxed);
             }
             
             param.value = value;
             param.last_update_ms = now;
-            
-            if (config_.enable_ui_batching) {
-                param.needs_ui_update = true;
-            }
-            if (config_.enable_status_batching) {
-                param.needs_status_update = true;
-            }
-            
+            markDirty(index, param);
+            releaseIfConsumed(index);
             return true;
-        } else {
-            // Nouveau paramètre - chercher un slot libre
-            index = findFreeSlot();
-            if (index < 0) {
-                return false; // Pas de slot libre
+        }
+        
+        // Nouveau paramètre - prendre un slot libre, en vidant les batchs si aucun
+        if (free_count_ == 0) {
+            pool_flushes_.fetch_add(1, std::memory_order_relaxed);
+            flushAllBatches();
+            if (free_count_ == 0) {
+                return false; // Vidage réentrant depuis un callback
             }
-            
-            PendingParameter& param = parameters_[index];
-            param.controller = controller;
-            param.channel = channel;
-            param.value = value;
-            param.last_update_ms = now;
-            param.needs_ui_update = config_.enable_ui_batching;
-            param.needs_status_update = config_.enable_status_batching;
-            param.active = true;
-            
-            active_parameter_count_.fetch_add(1, std::memory_order_relaxed);
-            return true;
         }
+        index = free_slots_[--free_count_];
+        slot_index_[key] = index;
+        
+        PendingParameter& param = parameters_[index];
+        param.controller = controller;
+        param.channel = channel;
+        param.value = value;
+        param.last_update_ms = now;
+        param.needs_ui_update = false;
+        param.needs_status_update = false;
+        param.active = true;
+        active_parameter_count_.fetch_add(1, std::memory_order_relaxed);
+        markDirty(index, param);
+        releaseIfConsumed(index);  // Aucun batching actif : rien à attendre
+        return true;
     }
     
     /**
@@ -167,6 +183,7 @@ public:
      * les événements batchés selon les intervalles configurés.
      */
     void processPendingBatches() {
+        CYCLE_PROFILE_SCOPE("midi.batch");
         uint32_t now = millis();
         
         // Traiter le batch UI si nécessaire
@@ -184,6 +201,16 @@ public:
         }
     }
     
+    /**
+     * @brief Indique si un batch en attente doit être envoyé maintenant
+     */
+    bool hasDueBatches() const {
+        uint32_t now = millis();
+        return (ui_dirty_count_ > 0 && (now - last_ui_batch_ms_) >= config_.ui_update_interval_ms) ||
+               (status_dirty_count_ > 0 &&
+                (now - last_status_batch_ms_) >= config_.status_update_interval_ms);
+    }
+
     /**
      * @brief Force l'envoi immédiat de tous les batchs
      */
@@ -208,6 +235,7 @@ public:
         uint32_t ui_batches_sent;
         uint32_t status_batches_sent;
         uint32_t parameters_coalesced;
+        uint32_t pool_flushes;  // Vidages anticipés faute de slot libre
     };
     
     /**
@@ -221,7 +249,8 @@ public:
             static_cast<float>(active) / static_cast<float>(SystemConstants::Performance::MAX_MIDI_PENDING_PARAMS),
             ui_batches_sent_.load(std::memory_order_relaxed),
             status_batches_sent_.load(std::memory_order_relaxed),
-            parameters_coalesced_.load(std::memory_order_relaxed)
+            parameters_coalesced_.load(std::memory_order_relaxed),
+            pool_flushes_.load(std::memory_order_relaxed)
         };
     }
     
@@ -232,6 +261,7 @@ public:
         ui_batches_sent_.store(0, std::memory_order_relaxed);
         status_batches_sent_.store(0, std::memory_order_relaxed);
         parameters_coalesced_.store(0, std::memory_order_relaxed);
+        pool_flushes_.store(0, std::memory_order_relaxed);
     }
     
     /**
@@ -240,7 +270,10 @@ public:
     void clear() {
         for (auto& param : parameters_) {
             param.active = false;
+            param.needs_ui_update = false;
+            param.needs_status_update = false;
         }
+        resetIndex();
         active_parameter_count_.store(0, std::memory_order_relaxed);
     }
     
@@ -256,54 +289,83 @@ private:
     MidiBatchProcessor(const MidiBatchProcessor&) = delete;
     MidiBatchProcessor& operator=(const MidiBatchProcessor&) = delete;
     
+    static constexpr size_t MAX_PARAMS = SystemConstants::Performance::MAX_MIDI_PENDING_PARAMS;
+    static constexpr size_t KEY_COUNT = 16 * 128;  // (canal, CC)
+    static constexpr uint8_t NO_SLOT = 0xFF;
+    static constexpr uint8_t NO_VALUE = 0xFF;  // Hors de 0-127
+    static_assert(MAX_PARAMS < NO_SLOT, "Slot indices must fit in uint8_t");
+    
     /**
-     * @brief Cherche un paramètre existant
-     * 
-     * @param controller Numéro du contrôleur
-     * @param channel Canal MIDI
-     * @return Index du paramètre, ou -1 si non trouvé
+     * @brief Clé directe (canal << 7 | CC)
      */
-    int findParameter(uint8_t controller, uint8_t channel) const {
-        for (size_t i = 0; i < SystemConstants::Performance::MAX_MIDI_PENDING_PARAMS; ++i) {
-            const auto& param = parameters_[i];
-            if (param.active && param.controller == controller && param.channel == channel) {
-                return static_cast<int>(i);
-            }
+    static uint16_t makeKey(uint8_t controller, uint8_t channel) {
+        return static_cast<uint16_t>((channel & 0x0F) << 7 | (controller & 0x7F));
+    }
+    
+    /**
+     * @brief Réinitialise la table d'index et la pile de slots libres
+     */
+    void resetIndex() {
+        slot_index_.fill(NO_SLOT);
+        last_values_.fill(NO_VALUE);
+        for (size_t i = 0; i < MAX_PARAMS; ++i) {
+            // Pile inversée pour attribuer les slots dans l'ordre 0, 1, 2...
+            free_slots_[i] = static_cast<uint8_t>(MAX_PARAMS - 1 - i);
         }
-        return -1;
+        free_count_ = MAX_PARAMS;
+        ui_dirty_count_ = 0;
+        status_dirty_count_ = 0;
     }
     
     /**
-     * @brief Cherche un slot libre dans le tableau
-     * 
-     * @return Index du slot libre, ou -1 si aucun disponible
+     * @brief Inscrit un slot dans les listes de mise à jour (une seule fois)
      */
-    int findFreeSlot() const {
-        for (size_t i = 0; i < SystemConstants::Performance::MAX_MIDI_PENDING_PARAMS; ++i) {
-            if (!parameters_[i].active) {
-                return static_cast<int>(i);
-            }
+    void markDirty(uint8_t index, PendingParameter& param) {
+        if (config_.enable_ui_batching && !param.needs_ui_update) {
+            param.needs_ui_update = true;
+            ui_dirty_[ui_dirty_count_++] = index;
+        }
+        if (config_.enable_status_batching && !param.needs_status_update) {
+            param.needs_status_update = true;
+            status_dirty_[status_dirty_count_++] = index;
         }
-        return -1;
     }
     
     /**
-     * @brief Envoie les événements UI batchés
+     * @brief Rend un slot à la pile libre une fois consommé par les deux vidages
      */
-    void flushUIBatch() {
-        if (!ui_callback_) {
+    void releaseIfConsumed(uint8_t index) {
+        PendingParameter& param = parameters_[index];
+        if (!param.active || param.needs_ui_update || param.needs_status_update) {
             return;
         }
-        
+        param.active = false;
+        slot_index_[makeKey(param.controller, param.channel)] = NO_SLOT;
+        free_slots_[free_count_++] = index;
+        active_parameter_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Envoie les événements UI batchés
+     *
+     * Sans callback, les valeurs sont abandonnées mais les slots libérés.
+     */
+    void flushUIBatch() {
         size_t sent_count = 0;
         
-        for (auto& param : parameters_) {
+        for (size_t i = 0; i < ui_dirty_count_; ++i) {
+            const uint8_t index = ui_dirty_[i];
+            auto& param = parameters_[index];
             if (param.active && param.needs_ui_update) {
-                ui_callback_(param.controller, param.channel, param.value, ui_userdata_);
+                if (ui_callback_) {
+                    ui_callback_(param.controller, param.channel, param.value, ui_userdata_);
+                    sent_count++;
+                }
                 param.needs_ui_update = false;
-                sent_count++;
+                releaseIfConsumed(index);
             }
         }
+        ui_dirty_count_ = 0;
         
         if (sent_count > 0) {
             ui_batches_sent_.fetch_add(1, std::memory_order_relaxed);
@@ -314,24 +376,23 @@ private:
      * @brief Envoie les événements status batchés
      */
     void flushStatusBatch() {
-        if (!status_callback_) {
-            return;
-        }
-        
         // Collecter tous les paramètres qui ont besoin d'une mise à jour status
         static std::array<PendingParameter, SystemConstants::Performance::MAX_MIDI_PENDING_PARAMS> status_params;
         size_t count = 0;
         
-        for (auto& param : parameters_) {
-            if (param.active && param.needs_status_update && 
-                count < SystemConstants::Performance::MAX_MIDI_PENDING_PARAMS) {
+        for (size_t i = 0; i < status_dirty_count_; ++i) {
+            const uint8_t index = status_dirty_[i];
+            auto& param = parameters_[index];
+            if (param.active && param.needs_status_update) {
                 status_params[count] = param;
                 param.needs_status_update = false;
+                releaseIfConsumed(index);
                 count++;
             }
         }
+        status_dirty_count_ = 0;
         
-        if (count > 0) {
+        if (count > 0 && status_callback_) {
             status_callback_(status_params.data(), count, status_userdata_);
             status_batches_sent_.fetch_add(1, std::memory_order_relaxed);
         }
@@ -344,6 +405,22 @@ private:
     // Tableau statique pour les paramètres (remplace std::map)
     std::array<PendingParameter, SystemConstants::Performance::MAX_MIDI_PENDING_PARAMS> parameters_;
     
+    // Index direct (canal, CC) -> slot, NO_SLOT si absent
+    std::array<uint8_t, KEY_COUNT> slot_index_;
+    
+    // Dernière valeur reçue par clé, NO_VALUE si aucune (coalescence)
+    std::array<uint8_t, KEY_COUNT> last_values_;
+
+    // Pile des slots libres
+    std::array<uint8_t, MAX_PARAMS> free_slots_;
+    size_t free_count_ = 0;
+    
+    // Slots en attente de vidage, dans l'ordre de première modification
+    std::array<uint8_t, MAX_PARAMS> ui_dirty_;
+    size_t ui_dirty_count_ = 0;
+    std::array<uint8_t, MAX_PARAMS> status_dirty_;
+    size_t status_dirty_count_ = 0;
+    
     // Timers pour les batchs
     uint32_t last_ui_batch_ms_;
     uint32_t last_status_batch_ms_;
@@ -361,4 +438,5 @@ private:
     mutable std::atomic<uint32_t> ui_batches_sent_{0};
     mutable std::atomic<uint32_t> status_batches_sent_{0};
     mutable std::atomic<uint32_t> parameters_coalesced_{0};
+    mutable std::atomic<uint32_t> pool_flushes_{0};
 };
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "core/memory/RingBuffer.hpp"
 #include "core/domain/types.hpp"
 #include "config/SystemConstants.hpp"
+#include "core/utils/CycleProfiler.hpp"
 #include <functional>
 #include <array>
 #include <atomic>
@@ -239,6 +240,13 @@ public:
         return processed_count;
     }
     
+    /**
+     * @brief Indique si des messages attendent dans le buffer d'entrée
+     */
+    bool hasIncomingMessages() const {
+        return !incoming_buffer_.is_empty();
+    }
+
     /**
      * @brief Méthode d'entrée rapide pour messages MIDI depuis ISR
      * 
@@ -314,6 +322,7 @@ private:
      * @brief Traite un message MIDI individuel
      */
     void processMessage(const MidiBuffers::MidiMessage& message) {
+        CYCLE_PROFILE_SCOPE("midi.in_dispatch");
         uint8_t status = message.status;
         uint8_t type = status & 0xF0;
         uint8_t channel = status & 0x0F;
@@ -41,6 +41,35 @@ public:
      */
     virtual void sendControlChange(MidiChannel ch, MidiCC cc, uint8_t value) = 0;
 
+    /**
+     * @brief Envoie un Control Change 14 bits (paire MSB/LSB)
+     * Implémentation par défaut : CC msbCc puis CC msbCc + 32, toujours émis ensemble
+     * @param ch Canal MIDI (0-15)
+     * @param msbCc Numéro du contrôleur MSB (0-31)
+     * @param value Valeur 14 bits (0-16383)
+     * @param source ID de la source (encodeur, bouton, etc.)
+     */
+    virtual void sendControlChange14(MidiChannel ch, MidiCC msbCc, uint16_t value,
+                                     uint8_t source) {
+        sendCc(ch, msbCc, (value >> 7) & 0x7F, source);
+        sendCc(ch, msbCc + 32, value & 0x7F, source);
+    }
+
+    /**
+     * @brief Envoie un NRPN 14 bits
+     * Implémentation par défaut : CC 99/98 (numéro) puis CC 6/38 (Data Entry)
+     * @param ch Canal MIDI (0-15)
+     * @param parameter Numéro de paramètre NRPN (0-16383)
+     * @param value Valeur 14 bits (0-16383)
+     * @param source ID de la source (encodeur, bouton, etc.)
+     */
+    virtual void sendNrpn(MidiChannel ch, uint16_t parameter, uint16_t value, uint8_t source) {
+        sendCc(ch, 99, (parameter >> 7) & 0x7F, source);
+        sendCc(ch, 98, parameter & 0x7F, source);
+        sendCc(ch, 6, (value >> 7) & 0x7F, source);
+        sendCc(ch, 38, value & 0x7F, source);
+    }
+
     /**
      * @brief Envoie un message MIDI Note On
      * @param ch Canal MIDI (0-15)
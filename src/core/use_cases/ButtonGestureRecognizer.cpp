@@ -0,0 +1,163 @@
+#include "core/use_cases/ButtonGestureRecognizer.hpp"
+
+#include <bit>
+
+ButtonGestureRecognizer::ButtonGestureRecognizer(const Config& config) : config_(config) {}
+
+bool ButtonGestureRecognizer::addButton(ButtonId id, uint16_t longPressMs) {
+    if (buttonCount_ >= MAX_BUTTONS || findIndex(id) >= 0) {
+        return false;
+    }
+
+    ButtonState& state = buttons_[buttonCount_++];
+    state = ButtonState{};
+    state.id = id;
+    state.longPressUs = static_cast<uint32_t>(longPressMs) * 1000;
+    state.timer = Wheel::INVALID_HANDLE;
+    return true;
+}
+
+void ButtonGestureRecognizer::setCallback(GestureCallback callback) {
+    callback_ = std::move(callback);
+}
+
+void ButtonGestureRecognizer::onButtonEvent(ButtonId id, bool pressed, uint32_t timestampUs) {
+    const int index = findIndex(id);
+    if (index < 0) {
+        return;
+    }
+
+    // Les échéances antérieures à l'événement passent avant lui
+    advance(timestampUs);
+
+    if (pressed) {
+        onPress(static_cast<size_t>(index), timestampUs);
+    } else {
+        onRelease(static_cast<size_t>(index), timestampUs);
+    }
+}
+
+void ButtonGestureRecognizer::advance(uint32_t nowUs) {
+    wheel_.advance(nowUs, [this](uint16_t index, uint32_t deadlineUs) {
+        onLongPressExpired(index, deadlineUs);
+    });
+}
+
+int ButtonGestureRecognizer::findIndex(ButtonId id) const {
+    for (size_t i = 0; i < buttonCount_; ++i) {
+        if (buttons_[i].id == id) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void ButtonGestureRecognizer::onPress(size_t index, uint32_t timestampUs) {
+    ButtonState& state = buttons_[index];
+    const uint64_t bit = uint64_t{1} << index;
+
+    state.pressUs = timestampUs;
+    state.gestureConsumed = false;
+    cancelLongPress(state);
+
+    // Accord : boutons déjà enfoncés dont l'appui est dans la fenêtre
+    uint64_t chord = 0;
+    if (config_.chordWindowMs > 0) {
+        const uint32_t windowUs = static_cast<uint32_t>(config_.chordWindowMs) * 1000;
+        uint64_t others = held_;
+        while (others) {
+            const size_t other = static_cast<size_t>(std::countr_zero(others));
+            others &= others - 1;
+            if (timestampUs - buttons_[other].pressUs <= windowUs) {
+                chord |= uint64_t{1} << other;
+            }
+        }
+    }
+    held_ |= bit;
+
+    if (chord) {
+        chord |= bit;
+        // Les membres d'un accord ne produisent ni appui long ni clic
+        uint64_t members = chord;
+        while (members) {
+            ButtonState& member = buttons_[std::countr_zero(members)];
+            members &= members - 1;
+            cancelLongPress(member);
+            member.gestureConsumed = true;
+            member.hasLastClick = false;
+        }
+        emit(ButtonGesture::Type::Chord, state.id, timestampUs, chord);
+        return;
+    }
+
+    if (config_.doubleClickMs > 0 && state.hasLastClick &&
+        timestampUs - state.lastClickUs <= static_cast<uint32_t>(config_.doubleClickMs) * 1000) {
+        state.hasLastClick = false;
+        state.gestureConsumed = true;
+        emit(ButtonGesture::Type::DoubleClick, state.id, timestampUs);
+        return;
+    }
+
+    if (state.longPressUs > 0) {
+        state.timer = wheel_.schedule(timestampUs, state.longPressUs, static_cast<uint16_t>(index));
+        if (state.timer == Wheel::INVALID_HANDLE) {
+            stats_.timer_overflows++;
+        }
+    }
+}
+
+void ButtonGestureRecognizer::onRelease(size_t index, uint32_t timestampUs) {
+    ButtonState& state = buttons_[index];
+    held_ &= ~(uint64_t{1} << index);
+    cancelLongPress(state);
+
+    // Seul un clic simple peut ouvrir une fenêtre de double clic
+    state.hasLastClick = !state.gestureConsumed;
+    state.lastClickUs = timestampUs;
+    state.gestureConsumed = false;
+}
+
+void ButtonGestureRecognizer::onLongPressExpired(uint16_t index, uint32_t deadlineUs) {
+    ButtonState& state = buttons_[index];
+    state.timer = Wheel::INVALID_HANDLE;
+    if (!(held_ & (uint64_t{1} << index))) {
+        return;
+    }
+    state.gestureConsumed = true;
+    emit(ButtonGesture::Type::LongPress, state.id, deadlineUs);
+}
+
+void ButtonGestureRecognizer::cancelLongPress(ButtonState& state) {
+    if (state.timer != Wheel::INVALID_HANDLE) {
+        wheel_.cancel(state.timer);
+        state.timer = Wheel::INVALID_HANDLE;
+    }
+}
+
+void ButtonGestureRecognizer::emit(ButtonGesture::Type type, ButtonId id, uint32_t timestampUs,
+                                   uint64_t chordMask) {
+    ButtonGesture gesture{};
+    gesture.type = type;
+    gesture.id = id;
+    gesture.timestampUs = timestampUs;
+
+    switch (type) {
+        case ButtonGesture::Type::LongPress:
+            stats_.long_presses++;
+            break;
+        case ButtonGesture::Type::DoubleClick:
+            stats_.double_clicks++;
+            break;
+        case ButtonGesture::Type::Chord:
+            stats_.chords++;
+            while (chordMask && gesture.chordSize < ButtonGesture::MAX_CHORD_BUTTONS) {
+                gesture.chordIds[gesture.chordSize++] = buttons_[std::countr_zero(chordMask)].id;
+                chordMask &= chordMask - 1;
+            }
+            break;
+    }
+
+    if (callback_) {
+        callback_(gesture);
+    }
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+
+#include "config/SystemConstants.hpp"
+#include "core/domain/types.hpp"
+#include "core/utils/TimerWheel.hpp"
+
+/**
+ * @brief Geste reconnu sur un ou plusieurs boutons
+ */
+struct ButtonGesture {
+    static constexpr size_t MAX_CHORD_BUTTONS = 4;
+
+    enum class Type : uint8_t {
+        LongPress,    // Maintien au-delà de longPressMs
+        DoubleClick,  // Second appui moins de doubleClickMs après un clic
+        Chord         // Plusieurs boutons enfoncés dans la fenêtre d'accord
+    };
+
+    Type type;
+    ButtonId id;           // Bouton à l'origine du geste (dernier appuyé pour un accord)
+    uint32_t timestampUs;  // Instant exact du geste (échéance pour un appui long)
+    uint8_t chordSize;     // Nombre de boutons de l'accord (0 sinon)
+    std::array<ButtonId, MAX_CHORD_BUTTONS> chordIds;
+};
+
+/**
+ * @brief Reconnaissance d'appuis longs, doubles clics et accords
+ *
+ * Consomme le flux d'événements débouncés (id, état, horodatage) et produit
+ * des ButtonGesture. Les appuis longs sont temporisés par une roue à taille
+ * fixe (TimerWheel) : aucun traitement n'a lieu pour les boutons inactifs,
+ * seuls les événements et les échéances coûtent du temps.
+ *
+ * Le temps est toujours passé explicitement, pour rejouer des chronologies
+ * synthétiques sur hôte.
+ */
+class ButtonGestureRecognizer {
+public:
+    static constexpr size_t MAX_BUTTONS = SystemConstants::Buttons::MAX_BUTTONS;
+
+    /**
+     * @brief Fenêtres temporelles de reconnaissance
+     */
+    struct Config {
+        uint16_t doubleClickMs;  // Délai max entre relâchement et second appui (0 = désactivé)
+        uint16_t chordWindowMs;  // Écart max entre appuis d'un accord (0 = désactivé)
+
+        Config()
+            : doubleClickMs(SystemConstants::Buttons::DOUBLE_CLICK_WINDOW_MS),
+              chordWindowMs(SystemConstants::Buttons::CHORD_WINDOW_MS) {}
+    };
+
+    /**
+     * @brief Compteurs de gestes
+     */
+    struct Stats {
+        uint32_t long_presses;
+        uint32_t double_clicks;
+        uint32_t chords;
+        uint32_t timer_overflows;  // Appuis longs non temporisés (roue pleine)
+    };
+
+    using GestureCallback = std::function<void(const ButtonGesture&)>;
+
+    explicit ButtonGestureRecognizer(const Config& config = Config());
+
+    /**
+     * @brief Déclare un bouton à surveiller
+     * @param id Identifiant du bouton
+     * @param longPressMs Seuil d'appui long (0 = pas d'appui long)
+     * @return false si le nombre maximal de boutons est atteint
+     */
+    bool addButton(ButtonId id, uint16_t longPressMs);
+
+    void setCallback(GestureCallback callback);
+
+    /**
+     * @brief Intègre un changement d'état débouncé
+     * @param id Identifiant du bouton (ignoré s'il n'a pas été déclaré)
+     * @param pressed Nouvel état
+     * @param timestampUs Instant du changement
+     */
+    void onButtonEvent(ButtonId id, bool pressed, uint32_t timestampUs);
+
+    /**
+     * @brief Déclenche les appuis longs échus à nowUs
+     */
+    void advance(uint32_t nowUs);
+
+    const Stats& getStats() const {
+        return stats_;
+    }
+
+    void resetStats() {
+        stats_ = Stats{};
+    }
+
+private:
+    // Roue : 64 cases de 4,096 ms, soit un tour de 262 ms
+    using Wheel = TimerWheel<64, 16, 12>;
+
+    struct ButtonState {
+        ButtonId id;
+        uint32_t longPressUs;     // 0 = pas d'appui long
+        uint32_t pressUs;         // Instant du dernier appui
+        uint32_t lastClickUs;     // Instant du dernier relâchement d'un clic simple
+        Wheel::Handle timer;      // Temporisation d'appui long en cours
+        bool hasLastClick;        // lastClickUs valide pour un double clic
+        bool gestureConsumed;     // Appui déjà converti en geste (pas de clic au relâchement)
+    };
+
+    int findIndex(ButtonId id) const;
+    void onPress(size_t index, uint32_t timestampUs);
+    void onRelease(size_t index, uint32_t timestampUs);
+    void onLongPressExpired(uint16_t index, uint32_t deadlineUs);
+    void cancelLongPress(ButtonState& state);
+    void emit(ButtonGesture::Type type, ButtonId id, uint32_t timestampUs, uint64_t chordMask = 0);
+
+    Config config_;
+    GestureCallback callback_;
+    Stats stats_{};
+
+    std::array<ButtonState, MAX_BUTTONS> buttons_{};
+    size_t buttonCount_ = 0;
+    uint64_t held_ = 0;  // Bit n = buttons_[n] enfoncé
+
+    Wheel wheel_;
+};
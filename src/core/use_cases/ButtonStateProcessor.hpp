@@ -1,24 +1,32 @@
 #pragma once
 
-#include <functional>
+#include <cstdint>
 #include <vector>
 
+#include "config/SystemConstants.hpp"
+
 /**
  * @brief Template pour traiter les changements d'état de boutons
  * 
  * Factorisation de la logique commune entre boutons normaux et boutons d'encodeurs.
- * Évite la duplication de code tout en gardant les performances optimales.
+ * Les derniers états sont conservés dans un masque (bit n = port n) et le callback
+ * est un paramètre template, appelé sans std::function. Au-delà de
+ * SystemConstants::Buttons::MAX_BUTTONS ports, la configuration est rejetée par
+ * UnifiedConfiguration::validate() et ProcessButtons signale l'excédent.
  */
-template<typename Port>
-void processButtonChanges(const std::vector<Port*>& ports, 
-                         std::vector<bool>& lastStates,
-                         std::function<void(uint16_t, bool)> callback) {
-    for (size_t i = 0; i < ports.size(); ++i) {
-        bool pressed = ports[i]->isPressed();
-        if (pressed != lastStates[i]) {
-            lastStates[i] = pressed;
-            uint16_t buttonId = ports[i]->getId();
-            callback(buttonId, pressed);
+template<typename Port, typename Callback>
+void processButtonChanges(const std::vector<Port*>& ports,
+                         uint64_t& lastStates,
+                         Callback&& callback) {
+    constexpr size_t MAX_PORTS = SystemConstants::Buttons::MAX_BUTTONS;
+    static_assert(MAX_PORTS <= 64, "lastStates: un bit par port");
+    const size_t count = ports.size() < MAX_PORTS ? ports.size() : MAX_PORTS;
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t bit = uint64_t{1} << i;
+        const bool pressed = ports[i]->isPressed();
+        if (pressed != ((lastStates & bit) != 0)) {
+            lastStates ^= bit;
+            callback(ports[i]->getId(), pressed);
         }
     }
-}
\ No newline at end of file
+}
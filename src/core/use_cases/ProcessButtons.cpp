@@ -2,18 +2,29 @@
 
 #include "core/use_cases/ButtonStateProcessor.hpp"
 
+#include <Arduino.h>
+
 
 ProcessButtons::ProcessButtons(const std::vector<ButtonPort*>& buttons)
     : buttons_(buttons),
-      lastPressed_(buttons.size(), false),
+      lastPressed_(0),
       initialized_(false),
       onButtonStateChangedCallback_(nullptr),
       inputController_(nullptr),
-      useInputController_(false) {}
+      useInputController_(false) {
+    if (buttons_.size() > SystemConstants::Buttons::MAX_BUTTONS) {
+        Serial.print("[ProcessButtons] ERROR: Too many buttons, ignoring ");
+        Serial.println(buttons_.size() - SystemConstants::Buttons::MAX_BUTTONS);
+        buttons_.resize(SystemConstants::Buttons::MAX_BUTTONS);
+    }
+}
 
 void ProcessButtons::initStates() {
+    lastPressed_ = 0;
     for (size_t i = 0; i < buttons_.size(); ++i) {
-        lastPressed_[i] = buttons_[i]->isPressed();
+        if (buttons_[i]->isPressed()) {
+            lastPressed_ |= uint64_t{1} << i;
+        }
     }
     initialized_ = true;
 }
@@ -43,7 +43,7 @@ public:
 
 private:
     std::vector<ButtonPort*> buttons_;
-    std::vector<bool> lastPressed_;
+    uint64_t lastPressed_;  // Bit n = dernier état de buttons_[n]
     bool initialized_;
     ButtonStateChangedCallback onButtonStateChangedCallback_;
     InputController* inputController_;
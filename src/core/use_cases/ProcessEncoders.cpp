@@ -1,5 +1,7 @@
 #include "core/use_cases/ProcessEncoders.hpp"
 
+#include "core/utils/LatencyTrace.hpp"
+
 
 ProcessEncoders::ProcessEncoders(const std::vector<EncoderPort*>& encoders)
     : encoders_(encoders),
@@ -20,8 +22,10 @@ void ProcessEncoders::setInputController(InputController* inputController) {
 void ProcessEncoders::update() {
     // Process rotations
     for (auto* encoder : encoders_) {
+        LATENCY_TRACE_TIMESTAMP(readStart);
         int8_t delta = encoder->readDelta();
         if (delta != 0) {
+            LATENCY_TRACE_BEGIN(readStart);
             int32_t absPos = encoder->getAbsolutePosition();
 
             if (onEncoderTurnedCallback_) {
@@ -29,6 +33,7 @@ void ProcessEncoders::update() {
             } else if (useInputController_) {
                 inputController_->processEncoderTurn(encoder->getId(), absPos, delta);
             }
+            LATENCY_TRACE_END();
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,288 @@
+#pragma once
+
+/**
+ * @brief Profilage en cycles par tâche et par portée nommée
+ *
+ * Chaque emplacement (une tâche de TaskScheduler ou une portée
+ * CYCLE_PROFILE_SCOPE) accumule ses durées dans un histogramme logarithmique
+ * à seaux fixes, d'où sont tirés min, p50, p99 et max. La résolution est le
+ * cycle CPU (compteur DWT CYCCNT du Cortex-M7), là où micros() ne distingue
+ * pas les chemins de dispatch MIDI qui durent moins d'une microseconde.
+ *
+ * Horodatage : CYCCNT sur Teensy (boucle toutes les ~7,2 s à 600 MHz, les
+ * durées mesurées restent justes en dessous), std::chrono::steady_clock en
+ * nanosecondes sur l'hôte.
+ * Lecture : commande série "profile" / "profile reset" (voir
+ * DiagnosticsManager) et HighPerformanceMidiManager::getDiagnosticInfo().
+ *
+ * Sans -DCYCLE_PROFILER, les macros CYCLE_PROFILE_* ne génèrent aucun code.
+ */
+
+#ifdef CYCLE_PROFILER
+
+#include <Arduino.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#ifdef NATIVE_HOST
+#include <chrono>
+#endif
+
+#include "config/SystemConstants.hpp"
+
+/**
+ * @brief Histogramme logarithmique à seaux fixes (4 seaux par octave)
+ *
+ * Les valeurs 0 à 3 ont chacune leur seau ; au-delà, chaque puissance de
+ * deux est découpée en 4. Un percentile est rendu au milieu de son seau,
+ * soit une erreur relative d'au plus 12,5 %. min et max sont exacts.
+ */
+class CycleHistogram {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 2;
+    static constexpr uint32_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT = (32 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    void record(uint32_t ticks) {
+        counts_[bucketIndex(ticks)]++;
+        if (samples_ == 0 || ticks < min_) {
+            min_ = ticks;
+        }
+        if (ticks > max_) {
+            max_ = ticks;
+        }
+        samples_++;
+    }
+
+    /**
+     * @brief Percentile, milieu du seau qui le contient
+     * @param perMille Rang en pour mille (500 = médiane, 990 = p99)
+     */
+    uint32_t percentile(uint32_t perMille) const {
+        if (samples_ == 0) {
+            return 0;
+        }
+        const uint64_t rank = (static_cast<uint64_t>(samples_) * perMille + 999) / 1000;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKET_COUNT; i++) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                const uint32_t middle = bucketLowerBound(i) + (bucketUpperBound(i) - bucketLowerBound(i)) / 2;
+                return middle < min_ ? min_ : (middle > max_ ? max_ : middle);
+            }
+        }
+        return max_;
+    }
+
+    uint32_t min() const { return min_; }
+    uint32_t max() const { return max_; }
+    uint32_t samples() const { return samples_; }
+
+    void reset() {
+        *this = CycleHistogram{};
+    }
+
+    static size_t bucketIndex(uint32_t ticks) {
+        if (ticks < SUB_BUCKETS) {
+            return ticks;
+        }
+        const uint32_t msb = 31 - static_cast<uint32_t>(__builtin_clz(ticks));
+        const uint32_t sub = (ticks >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+        return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+    }
+
+    static uint32_t bucketLowerBound(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return static_cast<uint32_t>(index);
+        }
+        const uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKETS) - 1;
+        return (SUB_BUCKETS + static_cast<uint32_t>(index % SUB_BUCKETS)) << shift;
+    }
+
+    static uint32_t bucketUpperBound(size_t index) {
+        if (index < SUB_BUCKETS) {
+            return static_cast<uint32_t>(index);
+        }
+        const uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKETS) - 1;
+        const uint64_t lower = static_cast<uint64_t>(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+        return static_cast<uint32_t>(lower + (1ULL << shift) - 1);
+    }
+
+private:
+    std::array<uint32_t, BUCKET_COUNT> counts_{};
+    uint32_t min_ = 0;
+    uint32_t max_ = 0;
+    uint32_t samples_ = 0;
+};
+
+class CycleProfiler {
+public:
+    static constexpr size_t MAX_SLOTS = SystemConstants::Performance::CYCLE_PROFILER_MAX_SLOTS;
+    static constexpr uint8_t NO_SLOT = 0xFF;
+    static_assert(MAX_SLOTS < NO_SLOT, "Slot indices must fit in uint8_t");
+
+    enum class Kind : uint8_t {
+        Task,   ///< Tâche de TaskScheduler (durée de task.function())
+        Scope   ///< Portée nommée CYCLE_PROFILE_SCOPE
+    };
+
+    /**
+     * @brief Mesure la durée d'une portée C++ dans un emplacement
+     */
+    class Scope {
+    public:
+        explicit Scope(uint8_t slot) : slot_(slot), start_(now()) {}
+        ~Scope() { record(slot_, now() - start_); }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        uint8_t slot_;
+        uint32_t start_;
+    };
+
+    /**
+     * @brief Horodatage courant (cycles, ou ns sur l'hôte)
+     */
+    static inline uint32_t now() {
+#if defined(ARM_DWT_CYCCNT) && !defined(NATIVE_HOST)
+        return ARM_DWT_CYCCNT;
+#elif defined(NATIVE_HOST)
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+#else
+        return micros();
+#endif
+    }
+
+    /**
+     * @brief Fréquence de l'horodatage (ticks par seconde)
+     */
+    static uint32_t ticksPerSecond() {
+#if defined(ARM_DWT_CYCCNT) && !defined(NATIVE_HOST)
+        return F_CPU_ACTUAL;
+#elif defined(NATIVE_HOST)
+        return 1000000000UL;
+#else
+        return 1000000UL;
+#endif
+    }
+
+    /**
+     * @brief Réserve un emplacement (ou retrouve celui du même nom et type)
+     * @param name Nom stable (littéral), affiché dans les rapports
+     * @return Indice de l'emplacement, NO_SLOT si la table est pleine
+     */
+    static uint8_t registerSlot(const char* name, Kind kind) {
+        if (!name) {
+            name = "?";
+        }
+        for (size_t i = 0; i < count_; i++) {
+            if (slots_[i].kind == kind && strcmp(slots_[i].name, name) == 0) {
+                return static_cast<uint8_t>(i);
+            }
+        }
+        if (count_ >= MAX_SLOTS) {
+            return NO_SLOT;
+        }
+        slots_[count_].name = name;
+        slots_[count_].kind = kind;
+        return static_cast<uint8_t>(count_++);
+    }
+
+    static void record(uint8_t slot, uint32_t ticks) {
+        if (slot < count_) {
+            slots_[slot].histogram.record(ticks);
+        }
+    }
+
+    static void reset() {
+        for (size_t i = 0; i < count_; i++) {
+            slots_[i].histogram.reset();
+        }
+    }
+
+    /**
+     * @brief Affiche le rapport sur le port série
+     */
+    static void print() {
+        char line[LINE_SIZE];
+        formatHeader(line, sizeof(line));
+        Serial.print(line);
+        for (size_t i = 0; i < count_; i++) {
+            formatSlot(line, sizeof(line), slots_[i]);
+            Serial.print(line);
+        }
+    }
+
+    /**
+     * @brief Ajoute le rapport à un texte de diagnostic
+     */
+    static void appendReport(String& out) {
+        char line[LINE_SIZE];
+        formatHeader(line, sizeof(line));
+        out += line;
+        for (size_t i = 0; i < count_; i++) {
+            formatSlot(line, sizeof(line), slots_[i]);
+            out += line;
+        }
+    }
+
+private:
+    static constexpr size_t LINE_SIZE = 160;
+
+    struct Slot {
+        const char* name;
+        Kind kind;
+        CycleHistogram histogram;
+    };
+
+    static void formatHeader(char* line, size_t size) {
+        snprintf(line, size,
+                 "[Profiler] hz=%lu slots=%u/%u\n"
+                 "  kind  name                  count       min       p50       p99       max  p99 ns\n",
+                 static_cast<unsigned long>(ticksPerSecond()), static_cast<unsigned>(count_),
+                 static_cast<unsigned>(MAX_SLOTS));
+    }
+
+    static void formatSlot(char* line, size_t size, const Slot& slot) {
+        const CycleHistogram& h = slot.histogram;
+        const uint32_t p99 = h.percentile(990);
+        snprintf(line, size, "  %-5s %-18s %9lu %9lu %9lu %9lu %9lu %7lu\n",
+                 slot.kind == Kind::Task ? "task" : "scope", slot.name,
+                 static_cast<unsigned long>(h.samples()), static_cast<unsigned long>(h.min()),
+                 static_cast<unsigned long>(h.percentile(500)), static_cast<unsigned long>(p99),
+                 static_cast<unsigned long>(h.max()), static_cast<unsigned long>(toNanos(p99)));
+    }
+
+    static uint32_t toNanos(uint32_t ticks) {
+        return static_cast<uint32_t>(static_cast<uint64_t>(ticks) * 1000000000ULL / ticksPerSecond());
+    }
+
+    static inline std::array<Slot, MAX_SLOTS> slots_{};
+    static inline size_t count_ = 0;
+};
+
+#define CYCLE_PROFILE_CONCAT_INNER(a, b) a##b
+#define CYCLE_PROFILE_CONCAT(a, b) CYCLE_PROFILE_CONCAT_INNER(a, b)
+
+// Emplacement résolu une fois (statique locale), puis mesure jusqu'à la fin de la portée
+#define CYCLE_PROFILE_SCOPE(name)                                                               \
+    static const uint8_t CYCLE_PROFILE_CONCAT(cycleProfileSlot_, __LINE__) =                   \
+        CycleProfiler::registerSlot(name, CycleProfiler::Kind::Scope);                         \
+    CycleProfiler::Scope CYCLE_PROFILE_CONCAT(cycleProfileScope_, __LINE__)(                   \
+        CYCLE_PROFILE_CONCAT(cycleProfileSlot_, __LINE__))
+#define CYCLE_PROFILE_TIMESTAMP(name) const uint32_t name = CycleProfiler::now()
+#define CYCLE_PROFILE_RECORD(slot, start) CycleProfiler::record(slot, CycleProfiler::now() - (start))
+
+#else
+
+#define CYCLE_PROFILE_SCOPE(name) ((void)0)
+#define CYCLE_PROFILE_TIMESTAMP(name) ((void)0)
+#define CYCLE_PROFILE_RECORD(slot, start) ((void)0)
+
+#endif
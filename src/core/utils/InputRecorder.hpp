@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Format d'enregistrement du flux d'entrées brut
+ *
+ * Fichier binaire little-endian : un en-tête de 16 octets puis des
+ * enregistrements de 8 octets, horodatés en µs depuis le début de
+ * l'enregistrement. Produit par native/tools/input_capture.py à partir de la
+ * commande série "record dump", rejoué sur l'hôte par InputReplayPlayer.
+ *
+ * Les entrées sont relevées au niveau des ports matériels, avant
+ * anti-rebond et accélération : le rejeu les réinjecte au même niveau (pins,
+ * multiplexeur et encodeurs simulés) et repasse par tout le traitement.
+ *
+ * Champs selon le type :
+ * - EncoderTurn : id = pin A de l'encodeur, value = pas de quadrature (int8)
+ * - PinLevel    : id = pin MCU d'un bouton, value = niveau électrique
+ * - MidiIn      : value = status, id = data1 | data2 << 8
+ * - MuxLevel    : id = canal du multiplexeur, value = niveau électrique
+ */
+namespace InputRecording {
+
+constexpr char MAGIC[4] = {'M', 'C', 'I', 'R'};
+constexpr uint16_t VERSION = 2;
+
+enum class Kind : uint8_t {
+    EncoderTurn = 1,
+    PinLevel = 2,
+    MidiIn = 3,
+    MuxLevel = 4
+};
+
+struct FileHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t count;
+    uint32_t reserved;
+};
+static_assert(sizeof(FileHeader) == 16, "Recording header must stay 16 bytes");
+
+struct Record {
+    uint32_t timestamp_us;
+    uint16_t id;
+    uint8_t kind;
+    uint8_t value;
+};
+static_assert(sizeof(Record) == 8, "Recording record must stay 8 bytes");
+
+}  // namespace InputRecording
+
+/**
+ * @brief Enregistreur du flux d'entrées (build avec -DINPUT_RECORDER)
+ *
+ * Capture, une fois armé par "record start", les pas de quadrature lus par
+ * QuadratureEncoder, les changements de niveau des boutons lus par
+ * DigitalButtonManager (horodatés au relevé, y compris en mode timer) ainsi
+ * que le MIDI USB entrant, dans un tampon RAM de taille fixe. Appelé depuis
+ * la tâche d'entrée uniquement, jamais en interruption. L'enregistrement
+ * s'arrête quand le tampon est plein (un rejeu a besoin d'un flux contigu
+ * depuis le début).
+ *
+ * Sans -DINPUT_RECORDER, les macros INPUT_RECORD_* ne génèrent aucun code.
+ */
+#ifdef INPUT_RECORDER
+
+#include <Arduino.h>
+#include <array>
+
+#include "config/SystemConstants.hpp"
+
+class InputRecorder {
+public:
+    static constexpr size_t CAPACITY = SystemConstants::Performance::INPUT_RECORDER_CAPACITY;
+
+    /**
+     * @brief Vide le tampon et arme l'enregistrement
+     */
+    static void start() {
+        count_ = 0;
+        overflows_ = 0;
+        startUs_ = micros();
+        session_++;
+        recording_ = true;
+    }
+
+    static void stop() {
+        recording_ = false;
+    }
+
+    static bool isRecording() { return recording_; }
+
+    /**
+     * @brief Numéro de l'enregistrement en cours (change à chaque start())
+     *
+     * Permet aux sources d'état (niveaux des boutons) de réémettre leur état
+     * complet au début d'un nouvel enregistrement.
+     */
+    static uint32_t session() { return session_; }
+
+    /**
+     * @brief Pas de quadrature lus sur un encodeur (découpés en int8)
+     */
+    static void recordEncoder(uint8_t pinA, int32_t counts, uint32_t timestampUs) {
+        while (counts != 0) {
+            const int32_t chunk = counts > INT8_MAX ? INT8_MAX : (counts < INT8_MIN ? INT8_MIN : counts);
+            push(InputRecording::Kind::EncoderTurn, pinA, static_cast<uint8_t>(chunk), timestampUs);
+            counts -= chunk;
+        }
+    }
+
+    static void recordPin(uint8_t pin, bool level, uint32_t timestampUs) {
+        push(InputRecording::Kind::PinLevel, pin, level ? 1 : 0, timestampUs);
+    }
+
+    static void recordMux(uint8_t channel, bool level, uint32_t timestampUs) {
+        push(InputRecording::Kind::MuxLevel, channel, level ? 1 : 0, timestampUs);
+    }
+
+    static void recordMidi(uint8_t status, uint8_t data1, uint8_t data2) {
+        push(InputRecording::Kind::MidiIn, static_cast<uint16_t>(data1 | (data2 << 8)), status,
+             micros());
+    }
+
+    static size_t size() { return count_; }
+
+    static const InputRecording::Record* records() { return records_.data(); }
+
+    /**
+     * @brief Vide les enregistrements sur le port série
+     *
+     * Format : une ligne d'en-tête, une ligne hexadécimale
+     * "timestamp id kind value" par enregistrement, puis une ligne de fin.
+     */
+    static void dump() {
+        Serial.printf("IREC BEGIN v%u records=%lu overflows=%lu%s\n",
+                      static_cast<unsigned>(InputRecording::VERSION),
+                      static_cast<unsigned long>(count_),
+                      static_cast<unsigned long>(overflows_),
+                      recording_ ? " recording" : "");
+        for (size_t i = 0; i < count_; ++i) {
+            const InputRecording::Record& r = records_[i];
+            Serial.printf("%08lx %04x %02x %02x\n", static_cast<unsigned long>(r.timestamp_us),
+                          static_cast<unsigned>(r.id), static_cast<unsigned>(r.kind),
+                          static_cast<unsigned>(r.value));
+        }
+        Serial.printf("IREC END\n");
+    }
+
+private:
+    static void push(InputRecording::Kind kind, uint16_t id, uint8_t value, uint32_t timestampUs) {
+        if (!recording_) {
+            return;
+        }
+        if (count_ >= CAPACITY) {
+            overflows_++;
+            recording_ = false;
+            return;
+        }
+        // Relevé antérieur au start() (file du timer vidée après) : début de l'enregistrement
+        const int32_t offsetUs = static_cast<int32_t>(timestampUs - startUs_);
+        InputRecording::Record& r = records_[count_++];
+        r.timestamp_us = offsetUs > 0 ? static_cast<uint32_t>(offsetUs) : 0;
+        r.id = id;
+        r.kind = static_cast<uint8_t>(kind);
+        r.value = value;
+    }
+
+    static inline std::array<InputRecording::Record, CAPACITY> records_{};
+    static inline size_t count_ = 0;
+    static inline uint32_t overflows_ = 0;
+    static inline uint32_t startUs_ = 0;
+    static inline uint32_t session_ = 0;
+    static inline bool recording_ = false;
+};
+
+#define INPUT_RECORD_ENCODER(pinA, counts, timestampUs) \
+    InputRecorder::recordEncoder(pinA, counts, timestampUs)
+#define INPUT_RECORD_MIDI(status, data1, data2) InputRecorder::recordMidi(status, data1, data2)
+
+#else
+
+#define INPUT_RECORD_ENCODER(pinA, counts, timestampUs) ((void)0)
+#define INPUT_RECORD_MIDI(status, data1, data2) ((void)0)
+
+#endif
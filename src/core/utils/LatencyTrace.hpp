@@ -0,0 +1,218 @@
+#pragma once
+
+/**
+ * @brief Trace de latence entrée -> USB, étage par étage
+ *
+ * Chaque cran d'encodeur reçoit un identifiant de trace ; chaque étage du
+ * chemin (lecture encodeur, ProcessEncoders, InputProcessorManager,
+ * EventBus::publish, MidiMapper, CommandManager, coalescence, file USB,
+ * envoi USB) y ajoute un enregistrement horodaté de 8 octets dans un anneau
+ * binaire de taille fixe. Les plus anciens enregistrements sont écrasés.
+ *
+ * L'identifiant courant suit la chaîne synchrone ; les étages asynchrones
+ * (MidiOutputCoalescer, file de TeensyUsbMidiOut) le mémorisent avec le
+ * message en attente et le restaurent à l'envoi.
+ *
+ * Horodatage : compteur de cycles DWT sur Teensy, micros() sur l'hôte.
+ * Vidage : commande série "trace dump" (voir DiagnosticsManager), décodé par
+ * native/tools/latency_decode.py.
+ *
+ * Sans -DLATENCY_TRACE, les macros LATENCY_TRACE_* ne génèrent aucun code.
+ */
+
+#ifdef LATENCY_TRACE
+
+#include <Arduino.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "config/SystemConstants.hpp"
+
+class LatencyTrace {
+public:
+    static constexpr size_t CAPACITY = SystemConstants::Performance::LATENCY_TRACE_CAPACITY;
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "Trace capacity must be a power of 2");
+
+    /**
+     * @brief Étages du chemin encodeur -> USB, dans l'ordre de traversée
+     */
+    enum class Stage : uint8_t {
+        EncoderRead = 0,     ///< Avant QuadratureEncoder::readDelta()
+        ProcessEncoders,     ///< Delta non nul, avant dispatch
+        InputProcessor,      ///< InputProcessorManager::processEncoderTurn()
+        EventBusPublish,     ///< EventBus::publish()
+        MidiMapper,          ///< MidiMapper::processEncoderChange()
+        CommandExecute,      ///< CommandManager::executeShared()
+        CoalescerFlush,      ///< Sortie de MidiOutputCoalescer
+        UsbEnqueue,          ///< Entrée dans la file de TeensyUsbMidiOut
+        UsbSend,             ///< usbMIDI.send_now() du paquet
+        Count
+    };
+
+    /**
+     * @brief Enregistrement binaire (8 octets)
+     */
+    struct Record {
+        uint32_t ticks;      ///< Compteur de cycles (ou µs sur l'hôte)
+        uint16_t id;         ///< Identifiant de trace (0 = aucun)
+        uint8_t stage;       ///< Stage
+        uint8_t reserved;
+    };
+    static_assert(sizeof(Record) == 8, "Trace record must stay 8 bytes");
+
+    /**
+     * @brief Identifiant courant restauré pour la durée d'une portée
+     *
+     * Utilisé par les étages asynchrones pour rattacher l'envoi différé à
+     * la trace qui l'a produit.
+     */
+    class ScopedId {
+    public:
+        explicit ScopedId(uint16_t id) : previous_(currentId_) { currentId_ = id; }
+        ~ScopedId() { currentId_ = previous_; }
+        ScopedId(const ScopedId&) = delete;
+        ScopedId& operator=(const ScopedId&) = delete;
+
+    private:
+        uint16_t previous_;
+    };
+
+    /**
+     * @brief Horodatage courant
+     */
+    static inline uint32_t now() {
+#if defined(ARM_DWT_CYCCNT) && !defined(NATIVE_HOST)
+        return ARM_DWT_CYCCNT;
+#else
+        return micros();
+#endif
+    }
+
+    /**
+     * @brief Fréquence de l'horodatage (ticks par seconde)
+     */
+    static uint32_t ticksPerSecond() {
+#if defined(ARM_DWT_CYCCNT) && !defined(NATIVE_HOST)
+        return F_CPU_ACTUAL;
+#else
+        return 1000000UL;
+#endif
+    }
+
+    /**
+     * @brief Ouvre une trace pour un cran d'encodeur
+     * @param readTicks Horodatage pris avant la lecture de l'encodeur
+     */
+    static void begin(uint32_t readTicks) {
+        if (++nextId_ == 0) {
+            nextId_ = 1;
+        }
+        currentId_ = nextId_;
+        push(readTicks, currentId_, Stage::EncoderRead);
+        push(now(), currentId_, Stage::ProcessEncoders);
+    }
+
+    /**
+     * @brief Ferme la trace synchrone courante
+     */
+    static void end() {
+        currentId_ = 0;
+    }
+
+    /**
+     * @brief Horodate un étage pour la trace courante (ignoré hors trace)
+     */
+    static inline void stage(Stage s) {
+        if (currentId_ != 0) {
+            push(now(), currentId_, s);
+        }
+    }
+
+    /**
+     * @brief Horodate un étage pour une trace donnée (ignoré si id == 0)
+     */
+    static inline void stageFor(uint16_t id, Stage s) {
+        if (id != 0) {
+            push(now(), id, s);
+        }
+    }
+
+    static uint16_t currentId() { return currentId_; }
+
+    /**
+     * @brief Nombre total d'enregistrements écrits (y compris écrasés)
+     */
+    static uint32_t totalRecords() { return written_; }
+
+    /**
+     * @brief Vide l'anneau
+     */
+    static void clear() {
+        written_ = 0;
+    }
+
+    /**
+     * @brief Nom d'un étage (décodage lisible)
+     */
+    static const char* stageName(Stage s) {
+        static constexpr const char* NAMES[] = {
+            "encoder_read", "process_encoders", "input_processor", "event_bus",
+            "midi_mapper",  "command",          "coalescer",       "usb_enqueue",
+            "usb_send"};
+        static_assert(sizeof(NAMES) / sizeof(NAMES[0]) == static_cast<size_t>(Stage::Count));
+        const auto index = static_cast<size_t>(s);
+        return index < static_cast<size_t>(Stage::Count) ? NAMES[index] : "?";
+    }
+
+    /**
+     * @brief Vide les enregistrements sur le port série, du plus ancien au plus récent
+     *
+     * Format : une ligne d'en-tête, une ligne hexadécimale "ticks id stage"
+     * par enregistrement, puis une ligne de fin.
+     */
+    static void dump() {
+        const uint32_t count = written_ < CAPACITY ? written_ : static_cast<uint32_t>(CAPACITY);
+        const uint32_t first = written_ - count;
+
+        Serial.printf("LTRACE BEGIN v1 hz=%lu records=%lu dropped=%lu\n",
+                      static_cast<unsigned long>(ticksPerSecond()),
+                      static_cast<unsigned long>(count),
+                      static_cast<unsigned long>(first));
+        for (uint32_t i = first; i != written_; ++i) {
+            const Record& r = records_[i & (CAPACITY - 1)];
+            Serial.printf("%08lx %04x %02x\n", static_cast<unsigned long>(r.ticks),
+                          static_cast<unsigned>(r.id), static_cast<unsigned>(r.stage));
+        }
+        Serial.printf("LTRACE END\n");
+    }
+
+private:
+    static inline void push(uint32_t ticks, uint16_t id, Stage s) {
+        Record& r = records_[written_ & (CAPACITY - 1)];
+        r.ticks = ticks;
+        r.id = id;
+        r.stage = static_cast<uint8_t>(s);
+        r.reserved = 0;
+        ++written_;
+    }
+
+    static inline std::array<Record, CAPACITY> records_{};
+    static inline uint32_t written_ = 0;
+    static inline uint16_t nextId_ = 0;
+    static inline uint16_t currentId_ = 0;
+};
+
+#define LATENCY_TRACE_TIMESTAMP(name) const uint32_t name = LatencyTrace::now()
+#define LATENCY_TRACE_BEGIN(readTicks) LatencyTrace::begin(readTicks)
+#define LATENCY_TRACE_END() LatencyTrace::end()
+#define LATENCY_TRACE_STAGE(name) LatencyTrace::stage(LatencyTrace::Stage::name)
+
+#else
+
+#define LATENCY_TRACE_TIMESTAMP(name) ((void)0)
+#define LATENCY_TRACE_BEGIN(readTicks) ((void)0)
+#define LATENCY_TRACE_END() ((void)0)
+#define LATENCY_TRACE_STAGE(name) ((void)0)
+
+#endif
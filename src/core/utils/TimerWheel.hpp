@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Roue de temporisation à taille fixe (hashed timer wheel)
+ *
+ * Les échéances sont rangées dans Slots cases de 2^TickShift µs ; une échéance
+ * au-delà d'un tour de roue reste dans sa case jusqu'au tour concerné.
+ * Planifier et annuler sont en O(1), sans allocation. advance() ne parcourt
+ * que les cases écoulées depuis le dernier appel et ne coûte rien lorsque
+ * aucune temporisation n'est active.
+ *
+ * Le pas en puissance de 2 garde l'indexation des cases continue lors du
+ * rebouclage de micros().
+ *
+ * @tparam Slots Nombre de cases (puissance de 2)
+ * @tparam MaxTimers Nombre maximal de temporisations simultanées (< 255)
+ * @tparam TickShift Pas de la roue : 2^TickShift microsecondes
+ */
+template <size_t Slots, size_t MaxTimers, uint8_t TickShift>
+class TimerWheel {
+public:
+    static_assert(Slots > 0 && (Slots & (Slots - 1)) == 0, "Slots must be a power of 2");
+    static_assert(MaxTimers > 0 && MaxTimers < 255, "MaxTimers must fit in uint8_t handles");
+
+    using Handle = uint8_t;
+    static constexpr Handle INVALID_HANDLE = 0xFF;
+
+    TimerWheel() {
+        clear();
+    }
+
+    /**
+     * @brief Annule toutes les temporisations
+     */
+    void clear() {
+        heads_.fill(INVALID_HANDLE);
+        freeHead_ = 0;
+        for (size_t i = 0; i < MaxTimers; ++i) {
+            timers_[i] = Timer{};
+            timers_[i].next = (i + 1 < MaxTimers) ? static_cast<Handle>(i + 1) : INVALID_HANDLE;
+        }
+        active_ = 0;
+    }
+
+    /**
+     * @brief Planifie une échéance
+     * @param nowUs Temps courant (référence de la roue si elle était vide)
+     * @param delayUs Délai avant expiration
+     * @param payload Valeur restituée à l'expiration
+     * @return Handle de la temporisation, INVALID_HANDLE si la roue est pleine
+     */
+    Handle schedule(uint32_t nowUs, uint32_t delayUs, uint16_t payload) {
+        if (freeHead_ == INVALID_HANDLE) {
+            return INVALID_HANDLE;
+        }
+        if (active_ == 0) {
+            lastTick_ = tickOf(nowUs);
+        }
+
+        const Handle handle = freeHead_;
+        Timer& timer = timers_[handle];
+        freeHead_ = timer.next;
+
+        timer.deadlineUs = nowUs + delayUs;
+        timer.payload = payload;
+        timer.slot = slotOf(timer.deadlineUs);
+        timer.inUse = true;
+        link(handle);
+
+        active_++;
+        return handle;
+    }
+
+    /**
+     * @brief Annule une temporisation en attente
+     * @return false si le handle n'est pas actif
+     */
+    bool cancel(Handle handle) {
+        if (handle >= MaxTimers || !timers_[handle].inUse) {
+            return false;
+        }
+        unlink(handle);
+        release(handle);
+        return true;
+    }
+
+    /**
+     * @brief Déclenche les échéances atteintes à nowUs
+     * @param nowUs Temps courant
+     * @param onExpired Appelé avec (payload, deadlineUs) pour chaque échéance ;
+     *        il peut planifier, mais ne doit pas annuler d'autre temporisation
+     * @return Nombre d'échéances déclenchées
+     */
+    template <typename Callback>
+    size_t advance(uint32_t nowUs, Callback&& onExpired) {
+        const uint32_t nowTick = tickOf(nowUs);
+        if (active_ == 0) {
+            lastTick_ = nowTick;
+            return 0;
+        }
+
+        // Au-delà d'un tour, chaque case n'a besoin d'être visitée qu'une fois
+        uint32_t elapsed = nowTick - lastTick_;
+        if (elapsed > Slots) {
+            elapsed = Slots;
+        }
+
+        size_t fired = 0;
+        for (uint32_t step = elapsed; step > 0 && active_ > 0; --step) {
+            fired += expireSlot(static_cast<uint16_t>((nowTick - step + 1) & (Slots - 1)), nowUs,
+                                onExpired);
+        }
+        lastTick_ = nowTick;
+        return fired;
+    }
+
+    size_t activeCount() const {
+        return active_;
+    }
+
+private:
+    struct Timer {
+        uint32_t deadlineUs = 0;
+        uint16_t payload = 0;
+        uint16_t slot = 0;
+        Handle next = INVALID_HANDLE;
+        Handle prev = INVALID_HANDLE;
+        bool inUse = false;
+    };
+
+    static uint32_t tickOf(uint32_t us) {
+        return us >> TickShift;
+    }
+
+    uint16_t slotOf(uint32_t deadlineUs) const {
+        // Case du premier pas où l'échéance est atteinte (jamais en avance),
+        // au plus tôt le prochain pas visité par advance()
+        uint32_t dueTick = tickOf(deadlineUs + ((1u << TickShift) - 1));
+        if (static_cast<int32_t>(dueTick - lastTick_) <= 0) {
+            dueTick = lastTick_ + 1;
+        }
+        return static_cast<uint16_t>(dueTick & (Slots - 1));
+    }
+
+    template <typename Callback>
+    size_t expireSlot(uint16_t slot, uint32_t nowUs, Callback& onExpired) {
+        size_t fired = 0;
+        Handle handle = heads_[slot];
+        while (handle != INVALID_HANDLE) {
+            Timer& timer = timers_[handle];
+            const Handle next = timer.next;
+            if (static_cast<int32_t>(nowUs - timer.deadlineUs) >= 0) {
+                const uint16_t payload = timer.payload;
+                const uint32_t deadlineUs = timer.deadlineUs;
+                unlink(handle);
+                release(handle);
+                fired++;
+                onExpired(payload, deadlineUs);  // Peut replanifier
+            }
+            handle = next;
+        }
+        return fired;
+    }
+
+    void link(Handle handle) {
+        Timer& timer = timers_[handle];
+        timer.prev = INVALID_HANDLE;
+        timer.next = heads_[timer.slot];
+        if (timer.next != INVALID_HANDLE) {
+            timers_[timer.next].prev = handle;
+        }
+        heads_[timer.slot] = handle;
+    }
+
+    void unlink(Handle handle) {
+        Timer& timer = timers_[handle];
+        if (timer.prev != INVALID_HANDLE) {
+            timers_[timer.prev].next = timer.next;
+        } else {
+            heads_[timer.slot] = timer.next;
+        }
+        if (timer.next != INVALID_HANDLE) {
+            timers_[timer.next].prev = timer.prev;
+        }
+    }
+
+    void release(Handle handle) {
+        Timer& timer = timers_[handle];
+        timer.inUse = false;
+        timer.prev = INVALID_HANDLE;
+        timer.next = freeHead_;
+        freeHead_ = handle;
+        active_--;
+    }
+
+    std::array<Timer, MaxTimers> timers_;
+    std::array<Handle, Slots> heads_{};
+    Handle freeHead_ = 0;
+    size_t active_ = 0;
+    uint32_t lastTick_ = 0;
+};
@@ -1,6 +1,9 @@
 #include "Diagnostics.hpp"
 
+#include "core/utils/CycleProfiler.hpp"
 #include "core/utils/Error.hpp"
+#include "core/utils/InputRecorder.hpp"
+#include "core/utils/LatencyTrace.hpp"
 
 // Initialisation des variables statiques
 TaskScheduler* DiagnosticsManager::_scheduler = nullptr;
@@ -145,10 +148,70 @@ bool DiagnosticsManager::handleCommand(const String& command) {
         return true;
     }
 #endif
+
+#ifdef LATENCY_TRACE
+    if (command == "trace dump") {
+        LatencyTrace::dump();
+        return true;
+    }
+    else if (command == "trace clear") {
+        LatencyTrace::clear();
+        return true;
+    }
+#endif
+
+#ifdef CYCLE_PROFILER
+    if (command == "profile") {
+        CycleProfiler::print();
+        return true;
+    }
+    else if (command == "profile reset") {
+        CycleProfiler::reset();
+        return true;
+    }
+#endif
+
+#ifdef INPUT_RECORDER
+    if (command == "record start") {
+        InputRecorder::start();
+        return true;
+    }
+    else if (command == "record stop") {
+        InputRecorder::stop();
+        return true;
+    }
+    else if (command == "record dump") {
+        InputRecorder::dump();
+        return true;
+    }
+#endif
     
     return false;  // Commande non reconnue
 }
 
+void DiagnosticsManager::pollSerialCommands() {
+#if defined(DEBUG) || defined(LATENCY_TRACE) || defined(INPUT_RECORDER) || defined(CYCLE_PROFILER)
+    static char line[32];
+    static size_t length = 0;
+
+    while (Serial.available() > 0) {
+        const int c = Serial.read();
+        if (c < 0) {
+            break;
+        }
+        if (c == '\n' || c == '\r') {
+            if (length > 0) {
+                line[length] = '\0';
+                handleCommand(String(line));
+                length = 0;
+            }
+        } else if (length < sizeof(line) - 1) {
+            line[length++] = static_cast<char>(c);
+        }
+    }
+#endif
+}
+
 void DiagnosticsManager::printError(const Result<bool>& result, const char* prefix) {
     if (result.isError()) {
         // TODO DEBUG MSG
@@ -156,8 +219,9 @@ void DiagnosticsManager::printError(const Result<bool>& result, const char* pref
 }
 
 void DiagnosticsManager::printSchedulerStats(bool showDetails) {
-    // TODO DEBUG MSG
-    return;
+    if (_scheduler) {
+        _scheduler->printStats(showDetails);
+    }
 }
 
 void DiagnosticsManager::printMemoryStats() {
@@ -53,12 +53,19 @@ public:
 
     /**
      * @brief Traite les commandes de diagnostics venant du port série
-     * Cette fonction doit être appelée depuis handleSerialCommands()
+     * Appelée par pollSerialCommands() pour chaque ligne reçue
      * @param command Commande à traiter
      * @return true si la commande a été traitée, false sinon
      */
     static bool handleCommand(const String& command);
 
+    /**
+     * @brief Lit les commandes reçues sur le port série (une par ligne)
+     * et les transmet à handleCommand(). Ne fait rien sans DEBUG, LATENCY_TRACE,
+     * INPUT_RECORDER ni CYCLE_PROFILER
+     */
+    static void pollSerialCommands();
+
     /**
      * @brief Active ou désactive les diagnostics basés sur les événements
      * @param enable État d'activation
@@ -0,0 +1,91 @@
+#include "InputReplay.hpp"
+
+#ifdef NATIVE_HOST
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+#include "config/SystemConstants.hpp"
+#include "core/utils/Error.hpp"
+
+Result<bool> InputReplayPlayer::load(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return Result<bool>::error({ErrorCode::InvalidArgument, "Cannot open recording"});
+    }
+
+    InputRecording::FileHeader header{};
+    const bool headerRead = fread(&header, sizeof(header), 1, file) == 1;
+    if (!headerRead || memcmp(header.magic, InputRecording::MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != InputRecording::VERSION ||
+        header.record_size != sizeof(InputRecording::Record)) {
+        fclose(file);
+        return Result<bool>::error({ErrorCode::InvalidArgument, "Not a recording (bad header)"});
+    }
+
+    records_.resize(header.count);
+    const size_t read = fread(records_.data(), sizeof(InputRecording::Record), records_.size(), file);
+    fclose(file);
+    if (read != records_.size()) {
+        records_.clear();
+        return Result<bool>::error({ErrorCode::InvalidArgument, "Truncated recording"});
+    }
+
+    // Relevés du timer enregistrés au vidage de sa file : rejeu dans l'ordre des horodatages
+    std::stable_sort(records_.begin(), records_.end(),
+                     [](const InputRecording::Record& a, const InputRecording::Record& b) {
+                         return a.timestamp_us < b.timestamp_us;
+                     });
+    next_ = 0;
+    return Result<bool>::success(true);
+}
+
+void InputReplayPlayer::beforeSetup() {
+    // Rien à substituer : le rejeu agit sur les pins et encodeurs simulés
+}
+
+void InputReplayPlayer::beforeLoop(uint64_t elapsedUs) {
+    while (next_ < records_.size() && records_[next_].timestamp_us <= elapsedUs) {
+        apply(records_[next_]);
+        next_++;
+    }
+}
+
+void InputReplayPlayer::apply(const InputRecording::Record& record) {
+    switch (static_cast<InputRecording::Kind>(record.kind)) {
+    case InputRecording::Kind::EncoderTurn:
+        host::turnEncoder(static_cast<uint8_t>(record.id), static_cast<int8_t>(record.value));
+        break;
+
+    case InputRecording::Kind::PinLevel:
+        host::setPin(static_cast<uint8_t>(record.id), record.value != 0);
+        break;
+
+    case InputRecording::Kind::MuxLevel:
+        host::setMuxInput(SystemConstants::Multiplexer::SIGNAL_PIN,
+                          static_cast<uint8_t>(record.id), record.value != 0);
+        break;
+
+    case InputRecording::Kind::MidiIn:
+        // usbMIDI sépare le type (nibble haut) et le canal 1-16
+        host::injectMidi(record.value & 0xF0, (record.value & 0x0F) + 1,
+                         record.id & 0xFF, record.id >> 8);
+        break;
+    }
+}
+
+host::InputSource* host::createReplaySource(const char* path) {
+    auto player = std::make_unique<InputReplayPlayer>();
+    auto result = player->load(path);
+    if (result.isError()) {
+        fprintf(stderr, "[replay] %s: %s\n", path, result.error()->message);
+        return nullptr;
+    }
+    fprintf(stderr, "[replay] %s: %u records\n", path,
+            static_cast<unsigned>(player->getRecordCount()));
+    return player.release();
+}
+
+#endif  // NATIVE_HOST
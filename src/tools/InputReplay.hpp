@@ -0,0 +1,45 @@
+#pragma once
+
+#ifdef NATIVE_HOST
+
+#include <HostRuntime.h>
+
+#include <vector>
+
+#include "core/utils/InputRecorder.hpp"
+#include "core/utils/Result.hpp"
+
+/**
+ * @brief Rejeu déterministe d'un enregistrement d'entrées (build native)
+ *
+ * Charge un fichier produit par native/tools/input_capture.py. À chaque
+ * loop(), les relevés échus sur l'horloge virtuelle sont réappliqués au
+ * niveau où ils ont été enregistrés : pas de quadrature sur les encodeurs
+ * simulés, niveaux sur les pins et le multiplexeur simulés. Ils repassent
+ * donc par le timer, l'anti-rebond, les crans et l'accélération comme des
+ * entrées physiques. Le MIDI entrant est injecté dans la file usbMIDI lue par
+ * MidiSubsystem.
+ */
+class InputReplayPlayer : public host::InputSource {
+public:
+    /**
+     * @brief Charge et valide un enregistrement
+     * @param path Chemin du fichier binaire
+     */
+    Result<bool> load(const char* path);
+
+    void beforeSetup() override;
+    void beforeLoop(uint64_t elapsedUs) override;
+    bool finished() const override { return next_ >= records_.size(); }
+    uint32_t eventsFed() const override { return static_cast<uint32_t>(next_); }
+
+    size_t getRecordCount() const { return records_.size(); }
+
+private:
+    std::vector<InputRecording::Record> records_;
+    size_t next_ = 0;
+
+    void apply(const InputRecording::Record& record);
+};
+
+#endif  // NATIVE_HOST